@@ -27,5 +27,6 @@
 
 #include <cxxblacs/blacsgrid.hpp>
 #include <cxxblacs/scalapack.hpp>
+#include <cxxblacs/algorithms.hpp>
 
 #endif
@@ -0,0 +1,35 @@
+/*
+ *  A simple C++ Wrapper for BLACS along with minimal extra functionality to 
+ *  aid the the high-level development of distributed memory linear algebra.
+ *  Copyright (C) 2016-2018 David Williams-Young
+
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef __INCLUDED_CXXBLACS_ALGORITHMS_HPP__
+#define __INCLUDED_CXXBLACS_ALGORITHMS_HPP__
+
+#include <cxxblacs/algorithms/util.hpp>
+#include <cxxblacs/algorithms/cholqr.hpp>
+#include <cxxblacs/algorithms/twostage.hpp>
+#include <cxxblacs/algorithms/chebfsi.hpp>
+#include <cxxblacs/algorithms/tsqr.hpp>
+#include <cxxblacs/algorithms/summa.hpp>
+#include <cxxblacs/algorithms/gemm25d.hpp>
+#include <cxxblacs/algorithms/batched.hpp>
+#include <cxxblacs/algorithms/adaptive.hpp>
+#include <cxxblacs/algorithms/mixed.hpp>
+#include <cxxblacs/algorithms/newtonschulz.hpp>
+#include <cxxblacs/algorithms/purification.hpp>
+
+#endif
@@ -0,0 +1,450 @@
+/*
+ *  A simple C++ Wrapper for BLACS along with minimal extra functionality to 
+ *  aid the the high-level development of distributed memory linear algebra.
+ *  Copyright (C) 2016-2018 David Williams-Young
+
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef __INCLUDED_CXXBLACS_ALGORITHMS_ADAPTIVE_HPP__
+#define __INCLUDED_CXXBLACS_ALGORITHMS_ADAPTIVE_HPP__
+
+#include <cxxblacs/config.hpp>
+#include <cxxblacs/mpi.hpp>
+#include <cxxblacs/misc.hpp>
+#include <cxxblacs/lapack.hpp>
+#include <cxxblacs/scalapack.hpp>
+#include <cxxblacs/blacsgrid.hpp>
+
+#include <vector>
+#include <limits>
+#include <algorithm>
+#include <cctype>
+
+namespace CXXBLACS {
+
+  /**
+   * \brief Thresholds for adaptive (grid shrinking) execution
+   *
+   * A problem of WORK flops is performed on 
+   * min(NPROC, WORK / workPerProc) processes, or serially on a single 
+   * process if WORK <= serialWork. The defaults place an N = 500 
+   * eigendecomposition on O(10) processes and solve N < ~150 serially.
+   */
+  struct AdaptiveGridPolicy {
+
+    double workPerProc; ///< Minimum flops per process 
+    double serialWork;  ///< Flops at or below which LAPACK is used
+
+    AdaptiveGridPolicy( double wpp = 5.e7, double sw = 3.e7 ) :
+      workPerProc(wpp), serialWork(sw) { }
+
+  };
+
+  /**
+   * \brief Number of processes (out of NPROC) on which to perform a
+   * problem of WORK flops under POLICY
+   */
+  inline CB_INT AdaptiveProcCount(const double WORK, const CB_INT NPROC,
+    const AdaptiveGridPolicy &POLICY = AdaptiveGridPolicy()) {
+
+    if( WORK <= POLICY.serialWork ) return 1;
+    if( POLICY.workPerProc <= 0. )  return NPROC;
+
+    const double NP = WORK / POLICY.workPerProc;
+    return NP >= NPROC ? NPROC : std::max(CB_INT(NP),CB_INT(1));
+
+  }
+
+
+
+  /**
+   * \brief Redistribution helper for adaptive (grid shrinking) execution
+   *
+   * Selects the number of processes NP for a problem of WORK flops
+   * (AdaptiveProcCount) and forms a grid over the first NP ranks of GRID.
+   * Operands distributed on GRID are moved onto it with toSub, the 
+   * routine is performed on the participating processes (with serial 
+   * LAPACK on rank 0 of GRID if serial(), in which case the operands are
+   * stored column major with leading dimension DESCSUB[8]) and results 
+   * are moved back with fromSub. If full(), no subgrid is formed and the
+   * routine should be performed on GRID directly.
+   *
+   * Construction, toSub, fromSub and bcast are collective over GRID.
+   */
+  class AdaptiveGrid {
+
+    const BlacsGrid &grid_; ///< Grid on which the operands are distributed
+    CB_INT           np_;   ///< Number of processes selected
+    BlacsGrid        sub_;  ///< Grid over the first np_ ranks of grid_
+
+  public:
+
+    AdaptiveGrid(const BlacsGrid &GRID, const double WORK,
+      const AdaptiveGridPolicy &POLICY = AdaptiveGridPolicy()) :
+      grid_(GRID), np_(AdaptiveProcCount(WORK,GRID.nProc(),POLICY)),
+      sub_(GRID.split( 
+        (np_ < GRID.nProc() and GRID.iProc() < np_) ? 0 : -1 )) { }
+
+    inline CB_INT nProc()  const noexcept { return np_;                 }
+    inline bool   full()   const noexcept { return np_ == grid_.nProc(); }
+    inline bool   serial() const noexcept { return np_ == 1;            }
+
+    inline bool i_participate() const noexcept { 
+      return sub_.i_participate(); 
+    }
+
+    /**
+     * \brief Descriptor of an M x N matrix distributed on GRID with local
+     * leading dimension LDA
+     */
+    inline ScaLAPACK_Desc_t desc(const CB_INT M, const CB_INT N, 
+      const CB_INT LDA) const {
+
+      return DescInit(M,N,grid_.MB(),grid_.NB(),grid_.iSrc(),grid_.jSrc(),
+        grid_.iContxt(),LDA);
+
+    }
+
+    /**
+     * \brief Redistribute the M x N matrix A (local leading dimension LDA
+     * on GRID) onto the selected processes
+     *
+     * \returns the local part of A on the subgrid, described by DESCSUB
+     */
+    template <typename Field>
+    std::vector<Field> toSub(const CB_INT M, const CB_INT N, const Field *A,
+      const CB_INT LDA, ScaLAPACK_Desc_t &DESCSUB) {
+
+      CB_INT MLoc, NLoc;
+      std::tie(MLoc,NLoc) = sub_.getLocalDims(M,N);
+
+      std::vector<Field> ASub(MLoc * NLoc);
+      DESCSUB = sub_.descInit(M,N,0,0,MLoc);
+
+      PGEMR2D(M,N,A,1,1,desc(M,N,LDA),ASub.data(),1,1,DESCSUB,
+        grid_.iContxt());
+
+      return ASub;
+
+    }
+
+    /**
+     * \brief Redistribute the M x N matrix ASub (described by DESCSUB on
+     * the selected processes) back into A (local leading dimension LDA on
+     * GRID)
+     */
+    template <typename Field>
+    void fromSub(const CB_INT M, const CB_INT N, const Field *ASub,
+      const ScaLAPACK_Desc_t &DESCSUB, Field *A, const CB_INT LDA) const {
+
+      PGEMR2D(M,N,ASub,1,1,DESCSUB,A,1,1,desc(M,N,LDA),grid_.iContxt());
+
+    }
+
+    /**
+     * \brief Replicate X (length N) from the root of the selected 
+     * processes (rank 0 of GRID) over GRID
+     */
+    template <typename T>
+    void bcast(T *X, const CB_INT N) const {
+
+      MPI_Bcast(X,N,MPIType<T>(),0,grid_.comm());
+
+    }
+
+  };
+
+
+
+  /**
+   * \brief Hermitian eigensolver with adaptive grid shrinking
+   *
+   * Drop-in replacement for P?HEEVD on the N x N matrix A distributed on 
+   * GRID (local leading dimension LDA, eigenvectors returned in Z with 
+   * local leading dimension LDZ). The number of processes is selected by
+   * AdaptiveGrid from a flop model of the solve (~9 N^3 with 
+   * eigenvectors, ~4/3 N^3 without):
+   *   - All of GRID: P?HEEVD is called directly
+   *   - Fewer: A is redistributed onto a grid of the first NP ranks 
+   *     (PGEMR2D), solved there and Z is redistributed back
+   *   - One: A is collected on rank 0 and solved with ?HEEVD
+   *
+   * W is replicated on all of GRID on exit, A is destroyed. For real 
+   * fields this is equivalent to PSYEVD_ADAPTIVE. Collective over GRID.
+   *
+   * \returns INFO of the underlying solver (on all processes)
+   */
+  template <typename Field, typename RealField>
+  inline CB_INT PHEEVD_ADAPTIVE(const BlacsGrid &GRID, const char JOBZ,
+    const char UPLO, const CB_INT N, Field *A, const CB_INT LDA, 
+    RealField *W, Field *Z, const CB_INT LDZ,
+    const AdaptiveGridPolicy &POLICY = AdaptiveGridPolicy()) {
+
+    if( N == 0 ) return 0;
+
+    const bool   wantZ = JOBZ == 'V' or JOBZ == 'v';
+    const double N3    = double(N) * double(N) * double(N);
+
+    AdaptiveGrid AG(GRID, (wantZ ? 9. : 4./3.) * N3, POLICY);
+
+    if( AG.full() )
+      return PHEEVD(JOBZ,UPLO,N,A,1,1,AG.desc(N,N,LDA),W,Z,1,1,
+        AG.desc(N,N,LDZ));
+
+    ScaLAPACK_Desc_t DescASub;
+    auto ASub = AG.toSub(N,N,A,LDA,DescASub);
+    std::vector<Field> ZSub;
+
+    CB_INT INFO = 0;
+    if( AG.i_participate() ) {
+
+      // Serial: eigenvectors overwrite A
+      if( AG.serial() ) INFO = HEEVD(JOBZ,UPLO,N,ASub.data(),N,W);
+      else {
+
+        ZSub.resize(ASub.size());
+        INFO = PHEEVD(JOBZ,UPLO,N,ASub.data(),1,1,DescASub,W,ZSub.data(),
+          1,1,DescASub);
+
+      }
+
+    }
+
+    AG.bcast(&INFO,1);
+    AG.bcast(W,N);
+
+    if( wantZ and INFO == 0 )
+      AG.fromSub(N,N,AG.serial() ? ASub.data() : ZSub.data(),DescASub,Z,
+        LDZ);
+
+    return INFO;
+
+  }
+
+  /**
+   * \brief Symmetric eigensolver with adaptive grid shrinking (see
+   * PHEEVD_ADAPTIVE)
+   */
+  template <typename Field>
+  inline CB_INT PSYEVD_ADAPTIVE(const BlacsGrid &GRID, const char JOBZ,
+    const char UPLO, const CB_INT N, Field *A, const CB_INT LDA, Field *W,
+    Field *Z, const CB_INT LDZ,
+    const AdaptiveGridPolicy &POLICY = AdaptiveGridPolicy()) {
+
+    return PHEEVD_ADAPTIVE<Field,Field>(GRID,JOBZ,UPLO,N,A,LDA,W,Z,LDZ,
+      POLICY);
+
+  }
+
+
+
+
+  /**
+   * \brief General linear solver with adaptive grid shrinking
+   *
+   * Solves A * X = B for the N x N matrix A and N x NRHS matrix B 
+   * distributed on GRID (local leading dimensions LDA / LDB) with P?GESV
+   * on the processes selected by AdaptiveGrid (~2/3 N^3 + 2 N^2 NRHS 
+   * flops), or ?GESV on rank 0. 
+   *
+   * B is overwritten with X and A with the LU factors of P * A. The pivots
+   * are local to the grid on which the factorization was performed and
+   * are not returned. Collective over GRID.
+   *
+   * \returns INFO of the underlying solver (on all processes)
+   */
+  template <typename Field>
+  inline CB_INT PGESV_ADAPTIVE(const BlacsGrid &GRID, const CB_INT N,
+    const CB_INT NRHS, Field *A, const CB_INT LDA, Field *B, 
+    const CB_INT LDB, 
+    const AdaptiveGridPolicy &POLICY = AdaptiveGridPolicy()) {
+
+    if( N == 0 ) return 0;
+
+    const double N2 = double(N) * double(N);
+
+    AdaptiveGrid AG(GRID, 2./3. * N2 * N + 2. * N2 * NRHS, POLICY);
+
+    if( AG.full() ) {
+
+      CB_INT MLoc, NLoc;
+      std::tie(MLoc,NLoc) = GRID.getLocalDims(N,N);
+
+      std::vector<CB_INT> IPIV(MLoc + GRID.MB());
+      return PGESV(N,NRHS,A,1,1,AG.desc(N,N,LDA),IPIV.data(),B,1,1,
+        AG.desc(N,NRHS,LDB));
+
+    }
+
+    ScaLAPACK_Desc_t DescASub, DescBSub;
+    auto ASub = AG.toSub(N,N,A,LDA,DescASub);
+    auto BSub = AG.toSub(N,NRHS,B,LDB,DescBSub);
+
+    CB_INT INFO = 0;
+    if( AG.i_participate() ) {
+
+      std::vector<CB_INT> IPIV(DescASub[8] + DescASub[4]);
+
+      if( AG.serial() ) 
+        INFO = GESV(N,NRHS,ASub.data(),DescASub[8],IPIV.data(),BSub.data(),
+          DescBSub[8]);
+      else
+        INFO = PGESV(N,NRHS,ASub.data(),1,1,DescASub,IPIV.data(),
+          BSub.data(),1,1,DescBSub);
+
+    }
+
+    AG.bcast(&INFO,1);
+
+    AG.fromSub(N,N,ASub.data(),DescASub,A,LDA);
+    AG.fromSub(N,NRHS,BSub.data(),DescBSub,B,LDB);
+
+    return INFO;
+
+  }
+
+
+
+
+  /**
+   * \brief Hermitian positive definite solver with adaptive grid 
+   * shrinking
+   *
+   * Solves A * X = B for the N x N matrix A (UPLO triangle referenced) and
+   * N x NRHS matrix B distributed on GRID (local leading dimensions 
+   * LDA / LDB) with P?POTRF / P?POTRS on the processes selected by 
+   * AdaptiveGrid (~1/3 N^3 + 2 N^2 NRHS flops), or ?POTRF / ?POTRS on 
+   * rank 0.
+   *
+   * B is overwritten with X and the UPLO triangle of A with its Cholesky
+   * factor, as by P?POTRF. Collective over GRID.
+   *
+   * \returns INFO of the underlying factorization (on all processes)
+   */
+  template <typename Field>
+  inline CB_INT PPOSV_ADAPTIVE(const BlacsGrid &GRID, const char UPLO,
+    const CB_INT N, const CB_INT NRHS, Field *A, const CB_INT LDA, 
+    Field *B, const CB_INT LDB,
+    const AdaptiveGridPolicy &POLICY = AdaptiveGridPolicy()) {
+
+    if( N == 0 ) return 0;
+
+    const double N2 = double(N) * double(N);
+
+    AdaptiveGrid AG(GRID, N2 * N / 3. + 2. * N2 * NRHS, POLICY);
+
+    if( AG.full() ) {
+
+      auto DescA = AG.desc(N,N,LDA);
+      auto DescB = AG.desc(N,NRHS,LDB);
+
+      auto INFO = PPOTRF(UPLO,N,A,1,1,DescA);
+      if( INFO == 0 ) INFO = PPOTRS(UPLO,N,NRHS,A,1,1,DescA,B,1,1,DescB);
+      return INFO;
+
+    }
+
+    ScaLAPACK_Desc_t DescASub, DescBSub;
+    auto ASub = AG.toSub(N,N,A,LDA,DescASub);
+    auto BSub = AG.toSub(N,NRHS,B,LDB,DescBSub);
+
+    CB_INT INFO = 0;
+    if( AG.i_participate() ) {
+
+      if( AG.serial() ) {
+
+        INFO = POTRF(UPLO,N,ASub.data(),DescASub[8]);
+        if( INFO == 0 )
+          INFO = POTRS(UPLO,N,NRHS,ASub.data(),DescASub[8],BSub.data(),
+            DescBSub[8]);
+
+      } else {
+
+        INFO = PPOTRF(UPLO,N,ASub.data(),1,1,DescASub);
+        if( INFO == 0 )
+          INFO = PPOTRS(UPLO,N,NRHS,ASub.data(),1,1,DescASub,BSub.data(),
+            1,1,DescBSub);
+
+      }
+
+    }
+
+    AG.bcast(&INFO,1);
+
+    AG.fromSub(N,N,ASub.data(),DescASub,A,LDA);
+    if( INFO == 0 ) AG.fromSub(N,NRHS,BSub.data(),DescBSub,B,LDB);
+
+    return INFO;
+
+  }
+
+
+
+
+  /**
+   * \brief Matrix multiply with adaptive grid shrinking
+   *
+   * C = ALPHA * op(A) * op(B) + BETA * C for op(A) M x K, op(B) K x N and
+   * C M x N distributed on GRID (local leading dimensions LDA / LDB / 
+   * LDC), performed with P?GEMM on the processes selected by AdaptiveGrid 
+   * (2 M N K flops), or ?GEMM on rank 0. Collective over GRID.
+   */
+  template <typename Field>
+  inline void PGEMM_ADAPTIVE(const BlacsGrid &GRID, const char TRANSA, 
+    const char TRANSB, const CB_INT M, const CB_INT N, const CB_INT K, 
+    const Field ALPHA, const Field *A, const CB_INT LDA, const Field *B, 
+    const CB_INT LDB, const Field BETA, Field *C, const CB_INT LDC,
+    const AdaptiveGridPolicy &POLICY = AdaptiveGridPolicy()) {
+
+    if( M == 0 or N == 0 ) return;
+
+    const bool NoTransA = std::toupper(TRANSA) == 'N';
+    const bool NoTransB = std::toupper(TRANSB) == 'N';
+
+    const CB_INT MRowsA = NoTransA ? M : K, NColsA = NoTransA ? K : M;
+    const CB_INT MRowsB = NoTransB ? K : N, NColsB = NoTransB ? N : K;
+
+    AdaptiveGrid AG(GRID, 2. * double(M) * double(N) * double(K), POLICY);
+
+    if( AG.full() ) {
+
+      PGEMM(TRANSA,TRANSB,M,N,K,ALPHA,A,1,1,AG.desc(MRowsA,NColsA,LDA),
+        B,1,1,AG.desc(MRowsB,NColsB,LDB),BETA,C,1,1,AG.desc(M,N,LDC));
+      return;
+
+    }
+
+    ScaLAPACK_Desc_t DescASub, DescBSub, DescCSub;
+    auto ASub = AG.toSub(MRowsA,NColsA,A,LDA,DescASub);
+    auto BSub = AG.toSub(MRowsB,NColsB,B,LDB,DescBSub);
+    auto CSub = AG.toSub(M,N,C,LDC,DescCSub);
+
+    if( AG.i_participate() ) {
+
+      if( AG.serial() )
+        GEMM(TRANSA,TRANSB,M,N,K,ALPHA,ASub.data(),DescASub[8],BSub.data(),
+          DescBSub[8],BETA,CSub.data(),DescCSub[8]);
+      else
+        PGEMM(TRANSA,TRANSB,M,N,K,ALPHA,ASub.data(),1,1,DescASub,
+          BSub.data(),1,1,DescBSub,BETA,CSub.data(),1,1,DescCSub);
+
+    }
+
+    AG.fromSub(M,N,CSub.data(),DescCSub,C,LDC);
+
+  }
+
+}; // namespace CXXBLACS
+
+#endif
@@ -0,0 +1,223 @@
+/*
+ *  A simple C++ Wrapper for BLACS along with minimal extra functionality to 
+ *  aid the the high-level development of distributed memory linear algebra.
+ *  Copyright (C) 2016-2018 David Williams-Young
+
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef __INCLUDED_CXXBLACS_ALGORITHMS_BATCHED_HPP__
+#define __INCLUDED_CXXBLACS_ALGORITHMS_BATCHED_HPP__
+
+#include <cxxblacs/config.hpp>
+#include <cxxblacs/misc.hpp>
+#include <cxxblacs/scalapack.hpp>
+#include <cxxblacs/blacsgrid.hpp>
+
+#include <vector>
+#include <numeric>
+#include <algorithm>
+#include <cctype>
+
+namespace CXXBLACS {
+
+  /**
+   * \brief Largest-first (LPT) assignment of independent tasks to groups
+   *
+   * Tasks are visited in order of decreasing COST and each is assigned to
+   * the group which would finish it first, i.e. which minimizes 
+   * (LOAD + COST) / SIZE where SIZE is the number of processes in the group.
+   *
+   * @param[in] COST Cost of each task
+   * @param[in] SIZE Number of processes in each group
+   * @returns   Group index of each task
+   */
+  inline std::vector<CB_INT> ScheduleLPT(const std::vector<double> &COST,
+    const std::vector<CB_INT> &SIZE) {
+
+    std::vector<CB_INT> order(COST.size()), assign(COST.size());
+    std::iota(order.begin(),order.end(),0);
+    std::stable_sort(order.begin(),order.end(),
+      [&]( CB_INT i, CB_INT j ){ return COST[i] > COST[j]; });
+
+    std::vector<double> load(SIZE.size(),0.);
+    for( auto i : order ) {
+
+      CB_INT best = 0;
+      for( size_t g = 1; g < SIZE.size(); g++ )
+        if( (load[g]    + COST[i]) / SIZE[g] < 
+            (load[best] + COST[i]) / SIZE[best] ) best = g;
+
+      assign[i] = best;
+      load[best] += COST[i];
+
+    }
+
+    return assign;
+
+  }
+
+
+
+  /**
+   * \brief A single problem C = ALPHA * op(A) * op(B) + BETA * C of a 
+   * batched PGEMM.
+   *
+   * A, B and C are local buffers in the block-cyclic layout of the grid
+   * passed to PGEMMBatched (leading dimensions LDA, LDB and LDC).
+   */
+  template <typename Field>
+  struct GEMMBatchEntry {
+
+    char         TRANSA, TRANSB;
+    CB_INT       M, N, K;
+    Field        ALPHA;
+    const Field *A;
+    CB_INT       LDA;
+    const Field *B;
+    CB_INT       LDB;
+    Field        BETA;
+    Field       *C;
+    CB_INT       LDC;
+
+  };
+
+
+  /**
+   * \brief Batched PGEMM over independent subgrids
+   *
+   * The processes of GRID are partitioned into NGROUPS subgrids of 
+   * (nearly) equal size, each with its own BlacsGrid context (same MB / NB).
+   * The problems of BATCH are assigned to the subgrids by ScheduleLPT on
+   * their flop counts, redistributed onto their subgrid (PGEMR2D), 
+   * multiplied concurrently by PGEMM on each subgrid, and redistributed
+   * back onto GRID.
+   *
+   * Each process holds its subgrid's share of all of the problems assigned
+   * to it simultaneously.
+   *
+   * @param[in] GRID    Grid on which all matrices of BATCH are distributed
+   * @param[in] BATCH   Problems to perform
+   * @param[in] NGROUPS Number of subgrids (default: min(#problems,NPROC))
+   *
+   * Collective over GRID.
+   */
+  template <typename Field>
+  inline void PGEMMBatched(const BlacsGrid &GRID, 
+    const std::vector<GEMMBatchEntry<Field>> &BATCH, CB_INT NGROUPS = 0) {
+
+    const CB_INT NPROB = BATCH.size();
+    const CB_INT NPROC = GRID.nProc();
+    if( NPROB == 0 ) return;
+
+    if( NGROUPS <= 0 ) NGROUPS = std::min(NPROB,NPROC);
+    NGROUPS = std::min(NGROUPS,NPROC);
+
+    const CB_INT MB = GRID.MB(), NB = GRID.NB();
+    const CB_INT BaseCtxt = GRID.iContxt();
+
+
+    // Subgrids of consecutive ranks
+    std::vector<CB_INT> groupSize(NGROUPS,NPROC / NGROUPS);
+    for( CB_INT g = 0; g < NPROC % NGROUPS; g++ ) groupSize[g]++;
+
+    CB_INT myGroup = 0;
+    for( CB_INT first = 0; myGroup < NGROUPS; myGroup++ ) {
+      first += groupSize[myGroup];
+      if( GRID.iProc() < first ) break;
+    }
+
+    // Largest-first assignment by flop count
+    std::vector<double> cost(NPROB);
+    for( CB_INT i = 0; i < NPROB; i++ )
+      cost[i] = 2. * BATCH[i].M * BATCH[i].N * BATCH[i].K;
+
+    auto assign = ScheduleLPT(cost,groupSize);
+
+
+    BlacsGrid group = GRID.split(myGroup);
+
+    std::vector<std::vector<Field>> AG(NPROB), BG(NPROB), CG(NPROB);
+    std::vector<ScaLAPACK_Desc_t> DescAG(NPROB), DescBG(NPROB), 
+      DescCG(NPROB), DescA(NPROB), DescB(NPROB), DescC(NPROB);
+
+    // Descriptors (and local storage) of a problem on its subgrid 
+    auto groupMat = [&]( CB_INT i, CB_INT M, CB_INT N, 
+      std::vector<Field> &X ) {
+
+      if( assign[i] != myGroup ) return DescNull(M,N,MB,NB);
+
+      CB_INT MLoc, NLoc;
+      std::tie(MLoc,NLoc) = group.getLocalDims(M,N);
+      X.resize(MLoc * NLoc);
+
+      return DescInit(M,N,MB,NB,0,0,group.iContxt(),MLoc);
+
+    };
+
+
+    // Redistribute the problems onto their subgrids
+    for( CB_INT i = 0; i < NPROB; i++ ) {
+
+      const auto &P = BATCH[i];
+
+      const bool NoTransA = std::toupper(P.TRANSA) == 'N';
+      const bool NoTransB = std::toupper(P.TRANSB) == 'N';
+
+      const CB_INT MRowsA = NoTransA ? P.M : P.K;
+      const CB_INT NColsA = NoTransA ? P.K : P.M;
+      const CB_INT MRowsB = NoTransB ? P.K : P.N;
+      const CB_INT NColsB = NoTransB ? P.N : P.K;
+
+      const CB_INT ISRC = GRID.iSrc(), JSRC = GRID.jSrc();
+
+      DescA[i] = DescInit(MRowsA,NColsA,MB,NB,ISRC,JSRC,BaseCtxt,P.LDA);
+      DescB[i] = DescInit(MRowsB,NColsB,MB,NB,ISRC,JSRC,BaseCtxt,P.LDB);
+      DescC[i] = DescInit(P.M   ,P.N   ,MB,NB,ISRC,JSRC,BaseCtxt,P.LDC);
+
+      DescAG[i] = groupMat(i,MRowsA,NColsA,AG[i]);
+      DescBG[i] = groupMat(i,MRowsB,NColsB,BG[i]);
+      DescCG[i] = groupMat(i,P.M   ,P.N   ,CG[i]);
+
+      PGEMR2D(MRowsA,NColsA,P.A,1,1,DescA[i],AG[i].data(),1,1,DescAG[i],
+        BaseCtxt);
+      PGEMR2D(MRowsB,NColsB,P.B,1,1,DescB[i],BG[i].data(),1,1,DescBG[i],
+        BaseCtxt);
+      PGEMR2D(P.M   ,P.N   ,P.C,1,1,DescC[i],CG[i].data(),1,1,DescCG[i],
+        BaseCtxt);
+
+    }
+
+
+    // Subgrids perform their problems concurrently
+    for( CB_INT i = 0; i < NPROB; i++ ) 
+    if( assign[i] == myGroup ) {
+
+      const auto &P = BATCH[i];
+      PGEMM(P.TRANSA,P.TRANSB,P.M,P.N,P.K,P.ALPHA,AG[i].data(),1,1,
+        DescAG[i],BG[i].data(),1,1,DescBG[i],P.BETA,CG[i].data(),1,1,
+        DescCG[i]);
+
+    }
+
+
+    // Redistribute the results back onto GRID
+    for( CB_INT i = 0; i < NPROB; i++ ) 
+      PGEMR2D(BATCH[i].M,BATCH[i].N,CG[i].data(),1,1,DescCG[i],BATCH[i].C,
+        1,1,DescC[i],BaseCtxt);
+
+  }
+
+}; // namespace CXXBLACS
+
+#endif
@@ -0,0 +1,254 @@
+/*
+ *  A simple C++ Wrapper for BLACS along with minimal extra functionality to 
+ *  aid the the high-level development of distributed memory linear algebra.
+ *  Copyright (C) 2016-2018 David Williams-Young
+
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef __INCLUDED_CXXBLACS_ALGORITHMS_CHEBFSI_HPP__
+#define __INCLUDED_CXXBLACS_ALGORITHMS_CHEBFSI_HPP__
+
+#include <cxxblacs/config.hpp>
+#include <cxxblacs/blacs.hpp>
+#include <cxxblacs/misc.hpp>
+#include <cxxblacs/scalapack.hpp>
+#include <cxxblacs/algorithms/cholqr.hpp>
+#include <cxxblacs/algorithms/twostage.hpp>
+
+#include <vector>
+#include <algorithm>
+#include <limits>
+
+namespace CXXBLACS {
+
+  /**
+   * \brief Settings for the Chebyshev-filtered subspace iteration (ChebFSI)
+   */
+  template <typename RealField>
+  struct ChebFSISettings {
+
+    CB_INT    degree     = 10;    ///< Degree of the Chebyshev filter
+    CB_INT    maxIter    = 50;    ///< Max number of filter applications
+    CB_INT    nGuard     = 0;     ///< Trailing columns of X excluded from
+                                  ///< the convergence check
+    RealField tol        = 1e-8;  ///< Convergence criteria on 
+                                  ///< ||A*x - x*w|| / ||A||_inf
+    bool      warmStart  = false; ///< X holds orthonormal approximate 
+                                  ///< eigenvectors on entry
+    RealField upperBound = 0.;    ///< Upper bound of the spectrum of A. If
+                                  ///< not above the filter cutoff, 
+                                  ///< ||A||_inf is used instead
+
+  };
+
+
+  /**
+   * \brief Chebyshev-filtered subspace iteration for the K lowest 
+   * eigenpairs of a Hermitian matrix.
+   *
+   * Each iteration applies a scaled Chebyshev filter of degree 
+   * settings.degree (PGEMM), orthonormalizes the filtered block through 
+   * CholeskyQR2 (PHERK / PPOTRF / PTRSM), and performs a Rayleigh-Ritz 
+   * projection onto the K-dimensional subspace.
+   * The unwanted part of the spectrum is estimated from the current Ritz 
+   * values, so supplying the eigenvectors from a previous (nearby) problem
+   * through settings.warmStart typically requires only a handful of 
+   * iterations.
+   *
+   * A must be stored in full (both triangles). X (N x K) and A are 
+   * distributed on the same BLACS context with IA = JA = IX = JX = 1. On 
+   * exit, X and W contain the Ritz pairs in ascending order.
+   *
+   * \returns The number of unconverged eigenpairs (0 on success)
+   */
+  template <typename Field, typename RealField>
+  inline CB_INT ChebFSI(const CB_INT N, const CB_INT K, const Field *A,
+    const CB_INT *DESCA, RealField *W, Field *X, const CB_INT *DESCX,
+    const ChebFSISettings<RealField> &settings = 
+      ChebFSISettings<RealField>()) {
+
+    const CB_INT ICTXT = DESCX[1];
+
+    CB_INT NPROW, NPCOL, MYROW, MYCOL;
+    BlacsGridInfo(ICTXT,NPROW,NPCOL,MYROW,MYCOL);
+
+    const CB_INT LLDX  = DESCX[8];
+    const CB_INT XLocR = NumRoc(DESCX[2],DESCX[4],MYROW,DESCX[6],NPROW);
+    const CB_INT XLocC = NumRoc(DESCX[3],DESCX[5],MYCOL,DESCX[7],NPCOL);
+    const CB_INT XLen  = LLDX * XLocC;
+
+    // K x K workspace
+    const CB_INT KB    = DESCX[5];
+    const CB_INT SLocR = NumRoc(K,KB,MYROW,0,NPROW);
+    const CB_INT SLocC = NumRoc(K,KB,MYCOL,0,NPCOL);
+    auto DescS = DescInit(K,K,KB,KB,0,0,ICTXT,SLocR);
+
+    std::vector<Field> S(SLocR * SLocC), C(SLocR * SLocC);
+    std::vector<Field> Y(XLen), T(XLen), R(XLen);
+    std::vector<RealField> RNorm(K);
+
+    const RealField ANorm = PLANGE('I',N,N,A,1,1,DESCA);
+
+
+    // X <- orth(X) through CholeskyQR2 (shifted CholeskyQR3 if the Gram 
+    // matrix is numerically indefinite)
+    auto orthonormalize = [&]() {
+
+      if( CholeskyQR2(N,K,X,1,1,DESCX,S.data(),1,1,&DescS[0]) and
+          ShiftedCholeskyQR3(N,K,X,1,1,DESCX,S.data(),1,1,&DescS[0]) ) {
+        std::runtime_error err("ChebFSI: Orthonormalization Failed");
+        throw err;
+      }
+
+    };
+
+
+    // Rayleigh-Ritz: X <- X * C, R <- A * X * C, where 
+    // (X**H * A * X) * C = C * W
+    auto rayleighRitz = [&]() {
+
+      PGEMM('N','N',N,K,N,Field(1.),A,1,1,DESCA,X,1,1,DESCX,Field(0.),
+        T.data(),1,1,DESCX);
+      PGEMM('C','N',K,K,N,Field(1.),X,1,1,DESCX,T.data(),1,1,DESCX,
+        Field(0.),S.data(),1,1,&DescS[0]);
+
+      CB_INT INFO = PHEEVD_2STAGE('V','L',K,S.data(),1,1,&DescS[0],W,
+        C.data(),1,1,&DescS[0]);
+
+      if( INFO ) {
+        std::runtime_error err("ChebFSI: Rayleigh-Ritz Eigensolve Failed");
+        throw err;
+      }
+
+      PGEMM('N','N',N,K,K,Field(1.),X,1,1,DESCX,C.data(),1,1,&DescS[0],
+        Field(0.),Y.data(),1,1,DESCX);
+      PGEMM('N','N',N,K,K,Field(1.),T.data(),1,1,DESCX,C.data(),1,1,
+        &DescS[0],Field(0.),R.data(),1,1,DESCX);
+
+      std::copy(Y.begin(),Y.end(),X);
+
+    };
+
+
+    // Number of unconverged (non-guard) Ritz pairs
+    auto nUnconverged = [&]() -> CB_INT {
+
+      std::fill(RNorm.begin(),RNorm.end(),RealField(0.));
+
+      for( CB_INT jLoc = 0; jLoc < XLocC; jLoc++ ) {
+
+        const CB_INT j = IndxL2G(jLoc,DESCX[5],MYCOL,DESCX[7],NPCOL);
+        if( j >= K ) continue;
+
+        for( CB_INT iLoc = 0; iLoc < XLocR; iLoc++ )
+          RNorm[j] += std::norm( R[iLoc + jLoc*LLDX] - 
+                                   W[j] * X[iLoc + jLoc*LLDX] );
+
+      }
+
+      GSUM2D(ICTXT,"All"," ",K,1,RNorm.data(),K,-1,-1);
+
+      CB_INT nUnconv = 0;
+      for( CB_INT j = 0; j < K - settings.nGuard; j++ )
+        if( std::sqrt(RNorm[j]) > settings.tol * ANorm ) nUnconv++;
+
+      return nUnconv;
+
+    };
+
+
+    // X <- p(A) * X, where p is the Chebyshev polynomial which dampens
+    // [cutoff, upper] and is scaled to be 1 at lower
+    auto filter = [&]( const RealField lower, const RealField cutoff, 
+      const RealField upper ) {
+
+      const RealField e = (upper - cutoff) / 2;
+      const RealField c = (upper + cutoff) / 2;
+      const RealField tau = 2 * (lower - c) / e;
+      RealField sigma = e / (lower - c);
+
+      // R <- X_{k-1}, Y <- X_k
+      std::copy(X,X + XLen,R.begin());
+      std::copy(X,X + XLen,Y.begin());
+
+      Field alpha = sigma / e;
+      PGEMM('N','N',N,K,N,alpha,A,1,1,DESCA,R.data(),1,1,DESCX,-alpha*c,
+        Y.data(),1,1,DESCX);
+
+      for( CB_INT deg = 1; deg < settings.degree; deg++ ) {
+
+        const RealField sigmaNew = 1 / (tau - sigma);
+        alpha = 2 * sigmaNew / e;
+
+        // T <- 2 * sigmaNew / e * (A - cI) * Y - sigma * sigmaNew * R
+        std::copy(Y.begin(),Y.end(),T.begin());
+        PGEMM('N','N',N,K,N,alpha,A,1,1,DESCA,Y.data(),1,1,DESCX,-alpha*c,
+          T.data(),1,1,DESCX);
+
+        const RealField beta = sigma * sigmaNew;
+        for( CB_INT k = 0; k < XLen; k++ ) T[k] -= beta * R[k];
+
+        std::swap(R,Y); std::swap(Y,T);
+        sigma = sigmaNew;
+
+      }
+
+      std::copy(Y.begin(),Y.end(),X);
+
+    };
+
+
+
+
+    if( not settings.warmStart ) orthonormalize();
+    rayleighRitz();
+
+    CB_INT nUnconv = nUnconverged();
+
+    for( CB_INT iter = 0; iter < settings.maxIter and nUnconv; iter++ ) {
+
+      const RealField cutoff = W[K-1];
+      const RealField upper  = 
+        settings.upperBound > cutoff ? settings.upperBound : ANorm;
+
+      if( upper <= cutoff ) break;
+
+      filter( W[0], cutoff, upper );
+      orthonormalize();
+      rayleighRitz();
+
+      nUnconv = nUnconverged();
+
+    }
+
+    return nUnconv;
+
+  }
+
+
+  // Conversion from ScaLAPACK_Desc_t -> CB_INT*
+
+  template <typename Field, typename RealField>
+  inline CB_INT ChebFSI(const CB_INT N, const CB_INT K, const Field *A,
+    const ScaLAPACK_Desc_t DESCA, RealField *W, Field *X, 
+    const ScaLAPACK_Desc_t DESCX, const ChebFSISettings<RealField> &settings 
+      = ChebFSISettings<RealField>()) {
+
+    return ChebFSI(N,K,A,&DESCA[0],W,X,&DESCX[0],settings);
+
+  }
+
+}; // namespace CXXBLACS
+
+#endif
@@ -0,0 +1,182 @@
+/*
+ *  A simple C++ Wrapper for BLACS along with minimal extra functionality to 
+ *  aid the the high-level development of distributed memory linear algebra.
+ *  Copyright (C) 2016-2018 David Williams-Young
+
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef __INCLUDED_CXXBLACS_ALGORITHMS_CHOLQR_HPP__
+#define __INCLUDED_CXXBLACS_ALGORITHMS_CHOLQR_HPP__
+
+#include <cxxblacs/config.hpp>
+#include <cxxblacs/blacs.hpp>
+#include <cxxblacs/misc.hpp>
+#include <cxxblacs/scalapack.hpp>
+#include <cxxblacs/algorithms/util.hpp>
+
+#include <vector>
+#include <limits>
+
+namespace CXXBLACS {
+
+  /**
+   * \brief A single (optionally shifted) CholeskyQR pass:
+   *   R**H * R = A**H * A + SHIFT * I,  A <- A * inv(R)
+   *
+   * Only the upper triangle of R(IR:IR+N-1,JR:JR+N-1) is referenced.
+   *
+   * \returns INFO from PPOTRF. A is left unchanged if INFO != 0.
+   */
+  template <typename Field, typename RealField>
+  inline CB_INT CholeskyQR(const CB_INT M, const CB_INT N, Field *A, 
+    const CB_INT IA, const CB_INT JA, const CB_INT *DESCA, Field *R,
+    const CB_INT IR, const CB_INT JR, const CB_INT *DESCR, 
+    const RealField SHIFT) {
+
+    PHERK('U','C',N,M,RealField(1.),A,IA,JA,DESCA,RealField(0.),R,IR,JR,
+      DESCR);
+
+    if( SHIFT != RealField(0.) ) AddDiagonal(N,Field(SHIFT),R,IR,JR,DESCR);
+
+    CB_INT INFO = PPOTRF('U',N,R,IR,JR,DESCR);
+    if( INFO ) return INFO;
+
+    PTRSM('R','U','N','N',M,N,Field(1.),R,IR,JR,DESCR,A,IA,JA,DESCA);
+
+    return 0;
+
+  }
+
+
+
+  /**
+   * \brief CholeskyQR2 orthonormalization of a distributed M x N (M >= N)
+   * block: A = Q * R.
+   *
+   * The Gram matrix is formed with PHERK and factored with PPOTRF, and the 
+   * factor is applied through PTRSM. The pass is repeated once to recover 
+   * orthogonality to working precision, which requires cond(A) to be well
+   * below 1/sqrt(eps). See ShiftedCholeskyQR3 for ill-conditioned blocks.
+   *
+   * On exit A(IA:IA+M-1,JA:JA+N-1) is overwritten by Q and the upper 
+   * triangle of R(IR:IR+N-1,JR:JR+N-1) by R (the strict lower triangle 
+   * is zeroed).
+   *
+   * \returns INFO from the first failing PPOTRF (0 on success)
+   */
+  template <typename Field>
+  inline CB_INT CholeskyQR2(const CB_INT M, const CB_INT N, Field *A, 
+    const CB_INT IA, const CB_INT JA, const CB_INT *DESCA, Field *R,
+    const CB_INT IR, const CB_INT JR, const CB_INT *DESCR) {
+
+    typedef typename CXXBLACS_REAL_TYPE<Field>::type RealField;
+
+    CB_INT NPROW, NPCOL, MYROW, MYCOL;
+    BlacsGridInfo(DESCR[1],NPROW,NPCOL,MYROW,MYCOL);
+
+    // Workspace for the second factor, distributed as R
+    std::vector<Field> R2( DESCR[8] * 
+      NumRoc(DESCR[3],DESCR[5],MYCOL,DESCR[7],NPCOL) );
+
+    CB_INT INFO = CholeskyQR(M,N,A,IA,JA,DESCA,R,IR,JR,DESCR,RealField(0.));
+    if( INFO ) return INFO;
+
+    INFO = CholeskyQR(M,N,A,IA,JA,DESCA,R2.data(),IR,JR,DESCR,
+      RealField(0.));
+    if( INFO ) return INFO;
+
+    // R <- R2 * R
+    if( N > 1 ) {
+      PLASET('L',N-1,N-1,Field(0.),Field(0.),R,IR+1,JR,DESCR);
+      PLASET('L',N-1,N-1,Field(0.),Field(0.),R2.data(),IR+1,JR,DESCR);
+    }
+
+    PTRMM('L','U','N','N',N,N,Field(1.),R2.data(),IR,JR,DESCR,R,IR,JR,DESCR);
+
+    return 0;
+
+  }
+
+
+
+  /**
+   * \brief Shifted CholeskyQR3 orthonormalization of a distributed M x N 
+   * (M >= N) block: A = Q * R.
+   *
+   * A CholeskyQR pass on the shifted Gram matrix 
+   *   A**H * A + 11 * (M*N + N*(N+1)) * eps * ||A||_F**2 * I
+   * is guaranteed to succeed for cond(A) up to O(1/eps), after which 
+   * CholeskyQR2 restores orthogonality.
+   *
+   * Arguments and outputs are the same as for CholeskyQR2.
+   */
+  template <typename Field>
+  inline CB_INT ShiftedCholeskyQR3(const CB_INT M, const CB_INT N, Field *A, 
+    const CB_INT IA, const CB_INT JA, const CB_INT *DESCA, Field *R,
+    const CB_INT IR, const CB_INT JR, const CB_INT *DESCR) {
+
+    typedef typename CXXBLACS_REAL_TYPE<Field>::type RealField;
+
+    CB_INT NPROW, NPCOL, MYROW, MYCOL;
+    BlacsGridInfo(DESCR[1],NPROW,NPCOL,MYROW,MYCOL);
+
+    std::vector<Field> R1( DESCR[8] * 
+      NumRoc(DESCR[3],DESCR[5],MYCOL,DESCR[7],NPCOL) );
+
+    const RealField ANorm = PLANGE('F',M,N,A,IA,JA,DESCA);
+    const RealField SHIFT = RealField(11 * (M*N + N*(N+1))) * 
+      std::numeric_limits<RealField>::epsilon() * ANorm * ANorm;
+
+    CB_INT INFO = CholeskyQR(M,N,A,IA,JA,DESCA,R1.data(),IR,JR,DESCR,SHIFT);
+    if( INFO ) return INFO;
+
+    INFO = CholeskyQR2(M,N,A,IA,JA,DESCA,R,IR,JR,DESCR);
+    if( INFO ) return INFO;
+
+    // R <- R * R1
+    if( N > 1 )
+      PLASET('L',N-1,N-1,Field(0.),Field(0.),R1.data(),IR+1,JR,DESCR);
+
+    PTRMM('R','U','N','N',N,N,Field(1.),R1.data(),IR,JR,DESCR,R,IR,JR,DESCR);
+
+    return 0;
+
+  }
+
+
+  // Conversion from ScaLAPACK_Desc_t -> CB_INT*
+
+  template <typename Field>
+  inline CB_INT CholeskyQR2(const CB_INT M, const CB_INT N, Field *A, 
+    const CB_INT IA, const CB_INT JA, const ScaLAPACK_Desc_t DESCA, 
+    Field *R, const CB_INT IR, const CB_INT JR, 
+    const ScaLAPACK_Desc_t DESCR) {
+
+    return CholeskyQR2(M,N,A,IA,JA,&DESCA[0],R,IR,JR,&DESCR[0]);
+
+  }
+
+  template <typename Field>
+  inline CB_INT ShiftedCholeskyQR3(const CB_INT M, const CB_INT N, Field *A, 
+    const CB_INT IA, const CB_INT JA, const ScaLAPACK_Desc_t DESCA, 
+    Field *R, const CB_INT IR, const CB_INT JR, 
+    const ScaLAPACK_Desc_t DESCR) {
+
+    return ShiftedCholeskyQR3(M,N,A,IA,JA,&DESCA[0],R,IR,JR,&DESCR[0]);
+
+  }
+
+}; // namespace CXXBLACS
+
+#endif
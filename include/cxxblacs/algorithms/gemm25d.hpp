@@ -0,0 +1,170 @@
+/*
+ *  A simple C++ Wrapper for BLACS along with minimal extra functionality to 
+ *  aid the the high-level development of distributed memory linear algebra.
+ *  Copyright (C) 2016-2018 David Williams-Young
+
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef __INCLUDED_CXXBLACS_ALGORITHMS_GEMM25D_HPP__
+#define __INCLUDED_CXXBLACS_ALGORITHMS_GEMM25D_HPP__
+
+#include <cxxblacs/config.hpp>
+#include <cxxblacs/mpi.hpp>
+#include <cxxblacs/misc.hpp>
+#include <cxxblacs/scalapack.hpp>
+#include <cxxblacs/blacsgrid.hpp>
+#include <cxxblacs/algorithms/summa.hpp>
+
+#include <vector>
+
+namespace CXXBLACS {
+
+  /**
+   * \brief 2.5D distributed GEMM: C = ALPHA * A * B + BETA * C
+   *
+   * A (M x K), B (K x N) and C (M x N) are distributed in the block-cyclic
+   * layout of GRID with local leading dimensions LDA, LDB and LDC.
+   *
+   * The P processes of GRID are split into REPLICATION (= c) layers of 
+   * P / c processes, each with its own BlacsGrid (same MB / NB). Layer l
+   * receives A(:,K_l) and B(K_l,:) for the l-th of c slices K_l of K
+   * (PGEMR2D) and forms its contribution with SUMMA on the layer grid. The
+   * c partial products are then summed with a single reduce-scatter over 
+   * the fibers connecting equivalent processes of each layer, leaving layer
+   * l with the l-th slice of columns of the result, which is redistributed
+   * back onto GRID. Larger c trades c times the memory per process for 
+   * less communication within each (smaller) layer.
+   *
+   * Requires P % REPLICATION == 0. Collective over GRID.
+   */
+  template <typename Field>
+  inline void GEMM25D(const BlacsGrid &GRID, const CB_INT REPLICATION,
+    const CB_INT M, const CB_INT N, const CB_INT K, const Field ALPHA, 
+    const Field *A, const CB_INT LDA, const Field *B, const CB_INT LDB, 
+    const Field BETA, Field *C, const CB_INT LDC) {
+
+    const CB_INT NPROC = GRID.nProc();
+    const CB_INT c     = REPLICATION;
+
+    if( c < 1 or NPROC % c != 0 ) {
+      std::runtime_error err("GEMM25D requires NPROC % REPLICATION == 0");
+      throw err;
+    }
+
+    if( c == 1 ) {
+      SUMMA(GRID,M,N,K,ALPHA,A,LDA,B,LDB,BETA,C,LDC);
+      return;
+    }
+
+    const CB_INT MB = GRID.MB(), NB = GRID.NB();
+    const CB_INT BaseCtxt = GRID.iContxt();
+
+    auto DescA = DescInit(M,K,MB,NB,GRID.iSrc(),GRID.jSrc(),BaseCtxt,LDA);
+    auto DescB = DescInit(K,N,MB,NB,GRID.iSrc(),GRID.jSrc(),BaseCtxt,LDB);
+    auto DescC = DescInit(M,N,MB,NB,GRID.iSrc(),GRID.jSrc(),BaseCtxt,LDC);
+
+
+    // Layers of consecutive ranks, fibers across layers
+    const CB_INT LAYERSIZE = NPROC / c;
+    const CB_INT MYLAYER   = GRID.iProc() / LAYERSIZE;
+
+    BlacsGrid layer = GRID.split(MYLAYER);
+
+    MPI_Comm fiberComm;
+    MPI_Comm_split(GRID.comm(),GRID.iProc() % LAYERSIZE,MYLAYER,&fiberComm);
+
+    // Slices of K (contraction) and N (result columns) per layer
+    auto slice = [&]( CB_INT L, CB_INT l ) { return (l * L) / c; };
+
+    const CB_INT K0 = slice(K,MYLAYER), KL = slice(K,MYLAYER+1) - K0;
+
+    CB_INT MLocA, NLocA, MLocB, NLocB, MLocC, NLocC;
+    std::tie(MLocA,NLocA) = layer.getLocalDims(M,KL);
+    std::tie(MLocB,NLocB) = layer.getLocalDims(KL,N);
+    std::tie(MLocC,NLocC) = layer.getLocalDims(M,N);
+
+    std::vector<Field> AL(MLocA * NLocA), BL(MLocB * NLocB), 
+      CL(MLocC * NLocC, Field(0.));
+
+    // Descriptor on the grid of layer l (CTXT = -1 if not a member)
+    auto layerDesc = [&]( CB_INT l, CB_INT MM, CB_INT NN, CB_INT LD ) {
+
+      if( l == MYLAYER ) 
+        return DescInit(MM,NN,MB,NB,0,0,layer.iContxt(),LD);
+
+      return DescNull(MM,NN,MB,NB);
+
+    };
+
+
+    // Replicate the K slices of A and B onto the layers
+    for( CB_INT l = 0; l < c; l++ ) {
+
+      const CB_INT k0 = slice(K,l), kl = slice(K,l+1) - k0;
+
+      PGEMR2D(M,kl,A,1,k0+1,DescA,AL.data(),1,1,layerDesc(l,M,kl,MLocA),
+        BaseCtxt);
+      PGEMR2D(kl,N,B,k0+1,1,DescB,BL.data(),1,1,layerDesc(l,kl,N,MLocB),
+        BaseCtxt);
+
+    }
+
+
+    // Partial product on each layer
+    SUMMA(layer,M,N,KL,ALPHA,AL.data(),MLocA,BL.data(),MLocB,Field(0.),
+      CL.data(),MLocC);
+
+
+    // Reduce-scatter over the fiber: layer l receives the sum of the local
+    // columns belonging to the l-th slice of N (contiguous in CL)
+    std::vector<int> counts(c);
+    for( CB_INT l = 0; l < c; l++ )
+      counts[l] = MLocC * (
+        NumRoc(slice(N,l+1),NB,layer.iProcCol(),0,layer.nProcCol()) - 
+        NumRoc(slice(N,l)  ,NB,layer.iProcCol(),0,layer.nProcCol()) );
+
+    const CB_INT JOFF = 
+      NumRoc(slice(N,MYLAYER),NB,layer.iProcCol(),0,layer.nProcCol());
+
+    std::vector<Field> CSlice(std::max(counts[MYLAYER],1));
+    MPI_Reduce_scatter(CL.data(),CSlice.data(),counts.data(),
+      MPIType<Field>(),MPI_SUM,fiberComm);
+    std::copy_n(CSlice.begin(),counts[MYLAYER],CL.begin() + JOFF*MLocC);
+
+
+    // Gather the column slices back onto GRID and accumulate into C
+    CB_INT MLocT, NLocT;
+    std::tie(MLocT,NLocT) = GRID.getLocalDims(M,N);
+    std::vector<Field> T(MLocT * NLocT);
+    auto DescT = DescInit(M,N,MB,NB,GRID.iSrc(),GRID.jSrc(),BaseCtxt,
+      MLocT);
+
+    for( CB_INT l = 0; l < c; l++ ) {
+
+      const CB_INT n0 = slice(N,l), nl = slice(N,l+1) - n0;
+
+      PGEMR2D(M,nl,CL.data(),1,n0+1,layerDesc(l,M,N,MLocC),T.data(),1,n0+1,
+        DescT,BaseCtxt);
+
+    }
+
+    PGEADD('N',M,N,Field(1.),T.data(),1,1,DescT,BETA,C,1,1,DescC);
+
+    MPI_Comm_free(&fiberComm);
+
+  }
+
+}; // namespace CXXBLACS
+
+#endif
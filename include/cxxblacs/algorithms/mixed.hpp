@@ -0,0 +1,469 @@
+/*
+ *  A simple C++ Wrapper for BLACS along with minimal extra functionality to 
+ *  aid the the high-level development of distributed memory linear algebra.
+ *  Copyright (C) 2016-2018 David Williams-Young
+
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef __INCLUDED_CXXBLACS_ALGORITHMS_MIXED_HPP__
+#define __INCLUDED_CXXBLACS_ALGORITHMS_MIXED_HPP__
+
+#include <cxxblacs/config.hpp>
+#include <cxxblacs/blacs.hpp>
+#include <cxxblacs/misc.hpp>
+#include <cxxblacs/scalapack.hpp>
+#include <cxxblacs/algorithms/util.hpp>
+
+#include <cmath>
+#include <vector>
+#include <limits>
+#include <functional>
+
+namespace CXXBLACS {
+
+  /**
+   * \brief Mixed precision linear solver: A * X = B
+   *
+   * Distributed analogue of LAPACK's ?SGESV / ?CGESV. A is converted 
+   * locally (ConvertLocal) to the lower precision field 
+   * (CXXBLACS_LOW_PRECISION_TYPE) and factored with PGETRF. The solution
+   * is then refined to working precision with residuals 
+   * R = B - A * X formed by PGEMM and corrections solved by PGETRS in the 
+   * lower precision. Column j of X is accepted once
+   *
+   *   max|R(:,j)| <= max|X(:,j)| * ||A||_inf * eps * sqrt(N).
+   *
+   * If the low precision factorization fails, A or B overflow in the lower
+   * precision, or the refinement does not converge within ITMAX 
+   * iterations, the system is solved with PGESV in working precision.
+   *
+   * A and B are unchanged on exit unless the fallback is taken, in which
+   * case A holds the working precision LU factors. IPIV holds the pivots
+   * of whichever factorization was used (LOCr(M_A) + MB_A entries).
+   *
+   * @param[out] ITER Number of refinement iterations on success, otherwise
+   *                  -2 (overflow), -3 (low precision PGETRF failed) or
+   *                  -(ITMAX+1) (no convergence)
+   *
+   * \returns INFO from the working precision PGESV if the fallback is taken,
+   *          0 otherwise
+   */
+  template <typename Field>
+  inline CB_INT PGESV_MIXED(const CB_INT N, const CB_INT NRHS, Field *A,
+    const CB_INT IA, const CB_INT JA, const CB_INT *DESCA, CB_INT *IPIV,
+    const Field *B, const CB_INT IB, const CB_INT JB, const CB_INT *DESCB,
+    Field *X, const CB_INT IX, const CB_INT JX, const CB_INT *DESCX,
+    CB_INT &ITER, const CB_INT ITMAX = 30) {
+
+    typedef typename CXXBLACS_LOW_PRECISION_TYPE<Field>::type LowField;
+    typedef typename CXXBLACS_REAL_TYPE<Field>::type          RealField;
+    typedef typename CXXBLACS_REAL_TYPE<LowField>::type       LowRealField;
+
+    ITER = 0;
+    if( N == 0 or NRHS == 0 ) return 0;
+
+    CB_INT NPROW, NPCOL, MYROW, MYCOL;
+    BlacsGridInfo(DESCA[1],NPROW,NPCOL,MYROW,MYCOL);
+
+    const CB_INT ALocC = NumRoc(DESCA[3],DESCA[5],MYCOL,DESCA[7],NPCOL);
+    const CB_INT BLocC = NumRoc(DESCB[3],DESCB[5],MYCOL,DESCB[7],NPCOL);
+
+    const RealField ANRM = PLANGE('I',N,N,A,IA,JA,DESCA);
+    const RealField EPS  = std::numeric_limits<RealField>::epsilon() / 2;
+    const RealField CTE  = ANRM * EPS * std::sqrt(RealField(N));
+    const RealField OVFL = std::numeric_limits<LowRealField>::max();
+
+    // Working precision residual and low precision copies
+    std::vector<Field>    R(DESCB[8] * BLocC);
+    std::vector<LowField> SA, SR(R.size());
+
+    auto fallback = [&]() {
+      PLACPY('A',N,NRHS,B,IB,JB,DESCB,X,IX,JX,DESCX);
+      return PGESV(N,NRHS,A,IA,JA,DESCA,IPIV,X,IX,JX,DESCX);
+    };
+
+    if( ANRM > OVFL or PLANGE('M',N,NRHS,B,IB,JB,DESCB) > OVFL ) {
+      ITER = -2;
+      return fallback();
+    }
+
+
+    // Low precision factorization
+    SA.resize(DESCA[8] * ALocC);
+    ConvertLocal(A,DESCA,SA.data());
+
+    if( PGETRF(N,N,SA.data(),IA,JA,DESCA,IPIV) ) {
+      ITER = -3;
+      return fallback();
+    }
+
+    // Initial solve: X = inv(SA) * B
+    ConvertLocal(B,DESCB,SR.data());
+    PGETRS('N',N,NRHS,SA.data(),IA,JA,DESCA,IPIV,SR.data(),IB,JB,DESCB);
+    ConvertLocal(SR.data(),DESCB,R.data());
+    PLACPY('A',N,NRHS,R.data(),IB,JB,DESCB,X,IX,JX,DESCX);
+
+
+    for( CB_INT it = 0; it <= ITMAX; it++ ) {
+
+      // R = B - A * X
+      PLACPY('A',N,NRHS,B,IB,JB,DESCB,R.data(),IB,JB,DESCB);
+      PGEMM('N','N',N,NRHS,N,Field(-1.),A,IA,JA,DESCA,X,IX,JX,DESCX,
+        Field(1.),R.data(),IB,JB,DESCB);
+
+      bool converged = true;
+      for( CB_INT j = 0; j < NRHS and converged; j++ ) 
+        converged = 
+          PLANGE('M',N,1,R.data(),IB,JB+j,DESCB) <= 
+          PLANGE('M',N,1,X,IX,JX+j,DESCX) * CTE;
+
+      if( converged ) {
+        ITER = it;
+        return 0;
+      }
+
+      if( it == ITMAX ) break;
+
+      // X = X + inv(SA) * R
+      ConvertLocal(R.data(),DESCB,SR.data());
+      PGETRS('N',N,NRHS,SA.data(),IA,JA,DESCA,IPIV,SR.data(),IB,JB,DESCB);
+      ConvertLocal(SR.data(),DESCB,R.data());
+      PGEADD('N',N,NRHS,Field(1.),R.data(),IB,JB,DESCB,Field(1.),X,IX,JX,
+        DESCX);
+
+    }
+
+
+    // Refinement failed to converge
+    ITER = -(ITMAX+1);
+    SA.clear(); SA.shrink_to_fit();
+
+    return fallback();
+
+  }
+
+  template <typename Field>
+  inline CB_INT PGESV_MIXED(const CB_INT N, const CB_INT NRHS, Field *A,
+    const CB_INT IA, const CB_INT JA, const ScaLAPACK_Desc_t DESCA, 
+    CB_INT *IPIV, const Field *B, const CB_INT IB, const CB_INT JB, 
+    const ScaLAPACK_Desc_t DESCB, Field *X, const CB_INT IX, 
+    const CB_INT JX, const ScaLAPACK_Desc_t DESCX, CB_INT &ITER, 
+    const CB_INT ITMAX = 30) {
+
+    return PGESV_MIXED(N,NRHS,A,IA,JA,&DESCA[0],IPIV,B,IB,JB,&DESCB[0],X,IX,
+      JX,&DESCX[0],ITER,ITMAX);
+
+  }
+
+
+
+  /**
+   * \brief Mixed precision Hermitian positive definite solver: A * X = B
+   *
+   * Distributed analogue of LAPACK's ?SPOSV / ?CPOSV. Identical to
+   * PGESV_MIXED with the LU factorization replaced by a low precision 
+   * Cholesky factorization (PPOTRF / PPOTRS) and residuals formed by 
+   * PHEMM, i.e. only the UPLO triangle of A is referenced.
+   *
+   * If the fallback is taken, A holds the working precision Cholesky 
+   * factor on exit.
+   *
+   * @param[out] ITER Number of refinement iterations on success, otherwise
+   *                  -2 (overflow), -3 (low precision PPOTRF failed) or
+   *                  -(ITMAX+1) (no convergence)
+   *
+   * \returns INFO from the working precision PPOTRF / PPOTRS if the 
+   *          fallback is taken, 0 otherwise
+   */
+  template <typename Field>
+  inline CB_INT PPOSV_MIXED(const char UPLO, const CB_INT N, 
+    const CB_INT NRHS, Field *A, const CB_INT IA, const CB_INT JA, 
+    const CB_INT *DESCA, const Field *B, const CB_INT IB, const CB_INT JB, 
+    const CB_INT *DESCB, Field *X, const CB_INT IX, const CB_INT JX, 
+    const CB_INT *DESCX, CB_INT &ITER, const CB_INT ITMAX = 30) {
+
+    typedef typename CXXBLACS_LOW_PRECISION_TYPE<Field>::type LowField;
+    typedef typename CXXBLACS_REAL_TYPE<Field>::type          RealField;
+    typedef typename CXXBLACS_REAL_TYPE<LowField>::type       LowRealField;
+
+    ITER = 0;
+    if( N == 0 or NRHS == 0 ) return 0;
+
+    CB_INT NPROW, NPCOL, MYROW, MYCOL;
+    BlacsGridInfo(DESCA[1],NPROW,NPCOL,MYROW,MYCOL);
+
+    const CB_INT ALocC = NumRoc(DESCA[3],DESCA[5],MYCOL,DESCA[7],NPCOL);
+    const CB_INT BLocC = NumRoc(DESCB[3],DESCB[5],MYCOL,DESCB[7],NPCOL);
+
+    const RealField ANRM = PLANHE('I',UPLO,N,A,IA,JA,DESCA);
+    const RealField EPS  = std::numeric_limits<RealField>::epsilon() / 2;
+    const RealField CTE  = ANRM * EPS * std::sqrt(RealField(N));
+    const RealField OVFL = std::numeric_limits<LowRealField>::max();
+
+    // Working precision residual and low precision copies
+    std::vector<Field>    R(DESCB[8] * BLocC);
+    std::vector<LowField> SA, SR(R.size());
+
+    auto fallback = [&]() {
+      PLACPY('A',N,NRHS,B,IB,JB,DESCB,X,IX,JX,DESCX);
+      auto INFO = PPOTRF(UPLO,N,A,IA,JA,DESCA);
+      if( INFO ) return INFO;
+      return PPOTRS(UPLO,N,NRHS,A,IA,JA,DESCA,X,IX,JX,DESCX);
+    };
+
+    if( ANRM > OVFL or PLANGE('M',N,NRHS,B,IB,JB,DESCB) > OVFL ) {
+      ITER = -2;
+      return fallback();
+    }
+
+
+    // Low precision factorization
+    SA.resize(DESCA[8] * ALocC);
+    ConvertLocal(A,DESCA,SA.data());
+
+    if( PPOTRF(UPLO,N,SA.data(),IA,JA,DESCA) ) {
+      ITER = -3;
+      return fallback();
+    }
+
+    // Initial solve: X = inv(SA) * B
+    ConvertLocal(B,DESCB,SR.data());
+    PPOTRS(UPLO,N,NRHS,SA.data(),IA,JA,DESCA,SR.data(),IB,JB,DESCB);
+    ConvertLocal(SR.data(),DESCB,R.data());
+    PLACPY('A',N,NRHS,R.data(),IB,JB,DESCB,X,IX,JX,DESCX);
+
+
+    for( CB_INT it = 0; it <= ITMAX; it++ ) {
+
+      // R = B - A * X
+      PLACPY('A',N,NRHS,B,IB,JB,DESCB,R.data(),IB,JB,DESCB);
+      PHEMM('L',UPLO,N,NRHS,Field(-1.),A,IA,JA,DESCA,X,IX,JX,DESCX,
+        Field(1.),R.data(),IB,JB,DESCB);
+
+      bool converged = true;
+      for( CB_INT j = 0; j < NRHS and converged; j++ ) 
+        converged = 
+          PLANGE('M',N,1,R.data(),IB,JB+j,DESCB) <= 
+          PLANGE('M',N,1,X,IX,JX+j,DESCX) * CTE;
+
+      if( converged ) {
+        ITER = it;
+        return 0;
+      }
+
+      if( it == ITMAX ) break;
+
+      // X = X + inv(SA) * R
+      ConvertLocal(R.data(),DESCB,SR.data());
+      PPOTRS(UPLO,N,NRHS,SA.data(),IA,JA,DESCA,SR.data(),IB,JB,DESCB);
+      ConvertLocal(SR.data(),DESCB,R.data());
+      PGEADD('N',N,NRHS,Field(1.),R.data(),IB,JB,DESCB,Field(1.),X,IX,JX,
+        DESCX);
+
+    }
+
+
+    // Refinement failed to converge
+    ITER = -(ITMAX+1);
+    SA.clear(); SA.shrink_to_fit();
+
+    return fallback();
+
+  }
+
+  template <typename Field>
+  inline CB_INT PPOSV_MIXED(const char UPLO, const CB_INT N, 
+    const CB_INT NRHS, Field *A, const CB_INT IA, const CB_INT JA, 
+    const ScaLAPACK_Desc_t DESCA, const Field *B, const CB_INT IB, 
+    const CB_INT JB, const ScaLAPACK_Desc_t DESCB, Field *X, 
+    const CB_INT IX, const CB_INT JX, const ScaLAPACK_Desc_t DESCX, 
+    CB_INT &ITER, const CB_INT ITMAX = 30) {
+
+    return PPOSV_MIXED(UPLO,N,NRHS,A,IA,JA,&DESCA[0],B,IB,JB,&DESCB[0],X,
+      IX,JX,&DESCX[0],ITER,ITMAX);
+
+  }
+
+
+
+
+  /**
+   * \brief Mixed precision Hermitian (symmetric) eigensolver
+   *
+   * The full eigensystem of A is obtained by PHEEVD in the lower precision
+   * field (CXXBLACS_LOW_PRECISION_TYPE), after which the eigenpairs are 
+   * refined in working precision by the iteration of Ogita and Aishima 
+   * (Japan J. Indust. Appl. Math. 35, 2018), which only requires PGEMM / 
+   * PHEMM:
+   *
+   *   R = I - Z**H * Z,  S = Z**H * A * Z,  W(i) = S(i,i) / (1 - R(i,i))
+   *
+   *   E(i,j) = (S(i,j) + W(j) R(i,j)) / (W(j) - W(i))  |W(j) - W(i)| > DELTA
+   *          = R(i,j) / 2                              otherwise
+   *
+   *   Z = Z + Z * E
+   *
+   * with DELTA = 2 (||S - diag(W)||_F + ||A||_F ||R||_F). Each step roughly
+   * squares the error of the low precision eigenpairs. The refinement stops 
+   * once max|E| <= sqrt(N) * eps or after ITMAX steps.
+   *
+   * Only the UPLO triangle of A is referenced and A is unchanged on exit.
+   *
+   * @param[out] ITER Number of refinement steps performed
+   *
+   * \returns INFO from the low precision PHEEVD
+   */
+  template <typename Field>
+  inline CB_INT PHEEVD_MIXED(const char UPLO, const CB_INT N, 
+    const Field *A, const CB_INT IA, const CB_INT JA, const CB_INT *DESCA, 
+    typename CXXBLACS_REAL_TYPE<Field>::type *W, Field *Z, const CB_INT IZ, 
+    const CB_INT JZ, const CB_INT *DESCZ, CB_INT &ITER, 
+    const CB_INT ITMAX = 3) {
+
+    typedef typename CXXBLACS_LOW_PRECISION_TYPE<Field>::type LowField;
+    typedef typename CXXBLACS_REAL_TYPE<Field>::type          RealField;
+    typedef typename CXXBLACS_REAL_TYPE<LowField>::type       LowRealField;
+
+    ITER = 0;
+    if( N == 0 ) return 0;
+
+    CB_INT NPROW, NPCOL, MYROW, MYCOL;
+    BlacsGridInfo(DESCZ[1],NPROW,NPCOL,MYROW,MYCOL);
+
+    const CB_INT ALocC = NumRoc(DESCA[3],DESCA[5],MYCOL,DESCA[7],NPCOL);
+    const CB_INT ZLocR = NumRoc(DESCZ[2],DESCZ[4],MYROW,DESCZ[6],NPROW);
+    const CB_INT ZLocC = NumRoc(DESCZ[3],DESCZ[5],MYCOL,DESCZ[7],NPCOL);
+    const CB_INT LDZ   = DESCZ[8];
+
+
+    // Low precision eigensystem
+    {
+      std::vector<LowField>     SA(DESCA[8] * ALocC), SZ(LDZ * ZLocC);
+      std::vector<LowRealField> SW(N);
+
+      ConvertLocal(A,DESCA,SA.data());
+
+      auto INFO = PHEEVD('V',UPLO,N,SA.data(),IA,JA,DESCA,SW.data(),
+        SZ.data(),IZ,JZ,DESCZ);
+      if( INFO ) return INFO;
+
+      ConvertLocal(SZ.data(),DESCZ,Z);
+      std::copy(SW.begin(),SW.end(),W);
+    }
+
+
+    const RealField ANRM = PLANHE('F',UPLO,N,A,IA,JA,DESCA);
+    const RealField TOL  = 
+      std::sqrt(RealField(N)) * std::numeric_limits<RealField>::epsilon();
+
+    std::vector<Field> AZ(LDZ * ZLocC), S(AZ.size()), R(AZ.size());
+    std::vector<Field> SD(N), RD(N);
+
+    // Apply OP(k,i,j) to the local elements of the N x N submatrix at 
+    // (IZ,JZ), k being the local index of the global element (i,j)
+    auto forLocal = [&](const std::function<void(CB_INT,CB_INT,CB_INT)> &OP){
+
+      for( CB_INT jLoc = 0; jLoc < ZLocC; jLoc++ ) {
+
+        const CB_INT j = IndxL2G(jLoc,DESCZ[5],MYCOL,DESCZ[7],NPCOL) - (JZ-1);
+        if( j < 0 or j >= N ) continue;
+
+        for( CB_INT iLoc = 0; iLoc < ZLocR; iLoc++ ) {
+          const CB_INT i = IndxL2G(iLoc,DESCZ[4],MYROW,DESCZ[6],NPROW) - (IZ-1);
+          if( i >= 0 and i < N ) OP(iLoc + jLoc*LDZ,i,j);
+        }
+
+      }
+
+    };
+
+
+    while( ITER < ITMAX ) {
+
+      // S = Z**H * A * Z
+      PHEMM('L',UPLO,N,N,Field(1.),A,IA,JA,DESCA,Z,IZ,JZ,DESCZ,Field(0.),
+        AZ.data(),IZ,JZ,DESCZ);
+      PGEMM('C','N',N,N,N,Field(1.),Z,IZ,JZ,DESCZ,AZ.data(),IZ,JZ,DESCZ,
+        Field(0.),S.data(),IZ,JZ,DESCZ);
+
+      // R = I - Z**H * Z
+      PLASET('A',N,N,Field(0.),Field(1.),R.data(),IZ,JZ,DESCZ);
+      PGEMM('C','N',N,N,N,Field(-1.),Z,IZ,JZ,DESCZ,Z,IZ,JZ,DESCZ,
+        Field(1.),R.data(),IZ,JZ,DESCZ);
+
+
+      // Rayleigh quotients from the (replicated) diagonals of S and R
+      std::fill(SD.begin(),SD.end(),Field(0.));
+      std::fill(RD.begin(),RD.end(),Field(0.));
+
+      forLocal([&](CB_INT k, CB_INT i, CB_INT j) {
+        if( i == j ) { SD[i] = S[k]; RD[i] = R[k]; }
+      });
+
+      GSUM2D(DESCZ[1],"All"," ",N,1,SD.data(),N,-1,-1);
+      GSUM2D(DESCZ[1],"All"," ",N,1,RD.data(),N,-1,-1);
+
+      for( CB_INT i = 0; i < N; i++ )
+        W[i] = std::real(SD[i]) / (RealField(1.) - std::real(RD[i]));
+
+
+      // DELTA = 2 * ( ||S - diag(W)||_F + ||A||_F * ||R||_F )
+      forLocal([&](CB_INT k, CB_INT i, CB_INT j) {
+        if( i == j ) S[k] -= W[i];
+      });
+
+      const RealField DELTA = 2. * ( 
+        PLANGE('F',N,N,S.data(),IZ,JZ,DESCZ) + 
+        ANRM * PLANGE('F',N,N,R.data(),IZ,JZ,DESCZ) );
+
+
+      // S <- E
+      forLocal([&](CB_INT k, CB_INT i, CB_INT j) {
+        const RealField GAP = W[j] - W[i];
+        if( std::abs(GAP) > DELTA ) S[k] = (S[k] + W[j] * R[k]) / GAP;
+        else                        S[k] = R[k] / RealField(2.);
+      });
+
+      const RealField ENRM = PLANGE('M',N,N,S.data(),IZ,JZ,DESCZ);
+
+
+      // Z = Z + Z * E
+      PLACPY('A',N,N,Z,IZ,JZ,DESCZ,AZ.data(),IZ,JZ,DESCZ);
+      PGEMM('N','N',N,N,N,Field(1.),AZ.data(),IZ,JZ,DESCZ,S.data(),IZ,JZ,
+        DESCZ,Field(1.),Z,IZ,JZ,DESCZ);
+
+      ITER++;
+      if( ENRM <= TOL ) break;
+
+    }
+
+    return 0;
+
+  }
+
+  template <typename Field>
+  inline CB_INT PHEEVD_MIXED(const char UPLO, const CB_INT N, 
+    const Field *A, const CB_INT IA, const CB_INT JA, 
+    const ScaLAPACK_Desc_t DESCA, typename CXXBLACS_REAL_TYPE<Field>::type *W,
+    Field *Z, const CB_INT IZ, const CB_INT JZ, const ScaLAPACK_Desc_t DESCZ,
+    CB_INT &ITER, const CB_INT ITMAX = 3) {
+
+    return PHEEVD_MIXED(UPLO,N,A,IA,JA,&DESCA[0],W,Z,IZ,JZ,&DESCZ[0],ITER,
+      ITMAX);
+
+  }
+
+}; // namespace CXXBLACS
+
+#endif
@@ -0,0 +1,373 @@
+/*
+ *  A simple C++ Wrapper for BLACS along with minimal extra functionality to 
+ *  aid the the high-level development of distributed memory linear algebra.
+ *  Copyright (C) 2016-2018 David Williams-Young
+
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef __INCLUDED_CXXBLACS_ALGORITHMS_NEWTONSCHULZ_HPP__
+#define __INCLUDED_CXXBLACS_ALGORITHMS_NEWTONSCHULZ_HPP__
+
+#include <cxxblacs/config.hpp>
+#include <cxxblacs/blacs.hpp>
+#include <cxxblacs/misc.hpp>
+#include <cxxblacs/scalapack.hpp>
+
+#include <cmath>
+#include <vector>
+#include <limits>
+#include <algorithm>
+#include <functional>
+
+namespace CXXBLACS {
+
+  /**
+   * \brief Function of a Hermitian matrix via its eigendecomposition:
+   * B = F(A) = Z * diag(F(W)) * Z**H
+   *
+   * The full (both triangles) A is unchanged on exit. B must have a 
+   * distribution conforming to that of A (see PHEEVD).
+   *
+   * @param[out] W Eigenvalues of A (ascending)
+   *
+   * \returns INFO from PHEEVD
+   */
+  template <typename Field>
+  inline CB_INT PHEFUNC(const CB_INT N, const Field *A, const CB_INT IA,
+    const CB_INT JA, const CB_INT *DESCA, 
+    const std::function< typename CXXBLACS_REAL_TYPE<Field>::type(
+      typename CXXBLACS_REAL_TYPE<Field>::type) > &F, 
+    Field *B, const CB_INT IB, const CB_INT JB, const CB_INT *DESCB,
+    typename CXXBLACS_REAL_TYPE<Field>::type *W) {
+
+    if( N == 0 ) return 0;
+
+    CB_INT NPROW, NPCOL, MYROW, MYCOL;
+    BlacsGridInfo(DESCA[1],NPROW,NPCOL,MYROW,MYCOL);
+
+    const CB_INT ALocC = NumRoc(DESCA[3],DESCA[5],MYCOL,DESCA[7],NPCOL);
+    const CB_INT BLocR = NumRoc(DESCB[2],DESCB[4],MYROW,DESCB[6],NPROW);
+    const CB_INT BLocC = NumRoc(DESCB[3],DESCB[5],MYCOL,DESCB[7],NPCOL);
+
+    // PHEEVD destroys A, work on a copy of the local block only
+    std::vector<Field> AW(DESCA[8] * ALocC);
+    PLACPY('A',N,N,A,IA,JA,DESCA,AW.data(),IA,JA,DESCA);
+    std::vector<Field> Z(DESCB[8] * BLocC), FZ(Z.size());
+
+    auto INFO = PHEEVD('V','L',N,AW.data(),IA,JA,DESCA,W,Z.data(),IB,JB,
+      DESCB);
+    if( INFO ) return INFO;
+
+    // FZ = Z * diag(F(W))
+    for( CB_INT jLoc = 0; jLoc < BLocC; jLoc++ ) {
+
+      const CB_INT j = IndxL2G(jLoc,DESCB[5],MYCOL,DESCB[7],NPCOL) - (JB-1);
+      if( j < 0 or j >= N ) continue;
+
+      const Field FW = F(W[j]);
+      for( CB_INT iLoc = 0; iLoc < BLocR; iLoc++ )
+        FZ[iLoc + jLoc*DESCB[8]] = Z[iLoc + jLoc*DESCB[8]] * FW;
+
+    }
+
+    PGEMM('N','C',N,N,N,Field(1.),FZ.data(),IB,JB,DESCB,Z.data(),IB,JB,
+      DESCB,Field(0.),B,IB,JB,DESCB);
+
+    return 0;
+
+  }
+
+  template <typename Field>
+  inline CB_INT PHEFUNC(const CB_INT N, const Field *A, const CB_INT IA,
+    const CB_INT JA, const ScaLAPACK_Desc_t DESCA, 
+    const std::function< typename CXXBLACS_REAL_TYPE<Field>::type(
+      typename CXXBLACS_REAL_TYPE<Field>::type) > &F, 
+    Field *B, const CB_INT IB, const CB_INT JB, const ScaLAPACK_Desc_t DESCB,
+    typename CXXBLACS_REAL_TYPE<Field>::type *W) {
+
+    return PHEFUNC(N,A,IA,JA,&DESCA[0],F,B,IB,JB,&DESCB[0],W);
+
+  }
+
+
+
+
+  /**
+   * \brief Square root and inverse square root of a Hermitian positive
+   * definite matrix by the coupled Newton-Schulz iteration
+   *
+   *   Y_0 = A / c,  Z_0 = I
+   *   T_k = (3I - Z_k * Y_k) / 2,  Y_k+1 = Y_k * T_k,  Z_k+1 = T_k * Z_k
+   *
+   * with c = min(||A||_1,||A||_F) >= ||A||_2, such that 
+   * Y_k -> (A/c)^(1/2) and Z_k -> (A/c)^(-1/2) (Higham, Functions of 
+   * Matrices, Ch. 6). Each step costs 3 PGEMMs.
+   *
+   * The residual RES_k = ||I - Z_k * Y_k||_F / sqrt(N) decreases 
+   * monotonically for a positive definite A. The iteration is accepted
+   * once RES_k <= TOL (N * eps if TOL <= 0), or once RES_k stagnates below
+   * sqrt(eps). The number of steps grows as log(cond(A)) so that an ill
+   * conditioned A, for which RES_k stagnates or ITMAX is exceeded, as well 
+   * as an indefinite A (RES_k >= 1) are handled by the eigendecomposition 
+   * (PHEFUNC).
+   *
+   * The full (both triangles) A is referenced and is unchanged on exit.
+   * Either Y or Z may be nullptr if only one of A^(1/2) and A^(-1/2) is
+   * required (e.g. Lowdin orthogonalization), which saves an 
+   * eigendecomposition if the fallback is taken.
+   *
+   * @param[out] Y    A^(1/2)
+   * @param[out] Z    A^(-1/2)
+   * @param[out] ITER Number of Newton-Schulz steps on success, otherwise
+   *                  -2 (divergence or stagnation) or -(ITMAX+1) 
+   *                  (no convergence)
+   *
+   * \returns INFO from PHEFUNC if the fallback is taken, N+1 if A is not
+   *          positive definite, 0 otherwise
+   */
+  template <typename Field>
+  inline CB_INT PHESQRT_NS(const CB_INT N, const Field *A, const CB_INT IA,
+    const CB_INT JA, const CB_INT *DESCA, Field *Y, const CB_INT IY, 
+    const CB_INT JY, const CB_INT *DESCY, Field *Z, const CB_INT IZ, 
+    const CB_INT JZ, const CB_INT *DESCZ, CB_INT &ITER, 
+    const CB_INT ITMAX = 50, 
+    typename CXXBLACS_REAL_TYPE<Field>::type TOL = 0.) {
+
+    typedef typename CXXBLACS_REAL_TYPE<Field>::type RealField;
+
+    ITER = 0;
+    if( N == 0 ) return 0;
+
+    CB_INT NPROW, NPCOL, MYROW, MYCOL;
+    BlacsGridInfo(DESCA[1],NPROW,NPCOL,MYROW,MYCOL);
+
+    const CB_INT ALocC = NumRoc(DESCA[3],DESCA[5],MYCOL,DESCA[7],NPCOL);
+
+    const RealField EPS = std::numeric_limits<RealField>::epsilon();
+    if( TOL <= 0. ) TOL = N * EPS;
+
+    const RealField C = std::min( PLANGE('1',N,N,A,IA,JA,DESCA),
+                                  PLANGE('F',N,N,A,IA,JA,DESCA) );
+
+    std::vector<Field> YK(DESCA[8] * ALocC), ZK(YK.size()), T(YK.size()),
+      SCR(YK.size());
+
+    // Y_0 = A / c, Z_0 = I
+    PGEADD('N',N,N,Field(1./C),A,IA,JA,DESCA,Field(0.),YK.data(),IA,JA,
+      DESCA);
+    PLASET('A',N,N,Field(0.),Field(1.),ZK.data(),IA,JA,DESCA);
+
+    RealField RES = std::numeric_limits<RealField>::max(), RESPrev = RES;
+    bool converged = false;
+
+    while( C > 0. ) {
+
+      // T = I - Z * Y
+      PLASET('A',N,N,Field(0.),Field(1.),T.data(),IA,JA,DESCA);
+      PGEMM('N','N',N,N,N,Field(-1.),ZK.data(),IA,JA,DESCA,YK.data(),IA,JA,
+        DESCA,Field(1.),T.data(),IA,JA,DESCA);
+
+      RESPrev = RES;
+      RES     = PLANGE('F',N,N,T.data(),IA,JA,DESCA) / std::sqrt(RealField(N));
+
+      if( RES <= TOL ) { converged = true; break; }
+
+      // Stagnation (at roundoff level) / divergence
+      if( not (RES < RESPrev) or not (RES < 1.) ) {
+        converged = RES < std::sqrt(EPS);
+        break;
+      }
+
+      if( ITER == ITMAX ) break;
+
+      // Y = Y * (I + T/2), Z = (I + T/2) * Z
+      PLACPY('A',N,N,YK.data(),IA,JA,DESCA,SCR.data(),IA,JA,DESCA);
+      PGEMM('N','N',N,N,N,Field(0.5),SCR.data(),IA,JA,DESCA,T.data(),IA,JA,
+        DESCA,Field(1.),YK.data(),IA,JA,DESCA);
+
+      PLACPY('A',N,N,ZK.data(),IA,JA,DESCA,SCR.data(),IA,JA,DESCA);
+      PGEMM('N','N',N,N,N,Field(0.5),T.data(),IA,JA,DESCA,SCR.data(),IA,JA,
+        DESCA,Field(1.),ZK.data(),IA,JA,DESCA);
+
+      ITER++;
+
+    }
+
+
+    if( converged ) {
+
+      const RealField SQC = std::sqrt(C);
+
+      if( Y ) PGEADD('N',N,N,Field(SQC),YK.data(),IA,JA,DESCA,Field(0.),
+                Y,IY,JY,DESCY);
+      if( Z ) PGEADD('N',N,N,Field(1./SQC),ZK.data(),IA,JA,DESCA,Field(0.),
+                Z,IZ,JZ,DESCZ);
+
+      return 0;
+
+    }
+
+
+    // Eigendecomposition fallback
+    ITER = (ITER == ITMAX) ? -(ITMAX+1) : -2;
+    YK.clear(); ZK.clear(); T.clear(); SCR.clear();
+
+    std::vector<RealField> W(N);
+    auto sqrtF    = [](RealField x) { return std::sqrt(x);      };
+    auto invSqrtF = [](RealField x) { return 1. / std::sqrt(x); };
+
+    CB_INT INFO = 0;
+    if( Y ) INFO = PHEFUNC(N,A,IA,JA,DESCA,sqrtF,Y,IY,JY,DESCY,W.data());
+    if( Z and not INFO ) 
+      INFO = PHEFUNC(N,A,IA,JA,DESCA,invSqrtF,Z,IZ,JZ,DESCZ,W.data());
+
+    if( not INFO and not (W[0] > 0.) ) INFO = N+1;
+
+    return INFO;
+
+  }
+
+  template <typename Field>
+  inline CB_INT PHESQRT_NS(const CB_INT N, const Field *A, const CB_INT IA,
+    const CB_INT JA, const ScaLAPACK_Desc_t DESCA, Field *Y, 
+    const CB_INT IY, const CB_INT JY, const ScaLAPACK_Desc_t DESCY, 
+    Field *Z, const CB_INT IZ, const CB_INT JZ, 
+    const ScaLAPACK_Desc_t DESCZ, CB_INT &ITER, const CB_INT ITMAX = 50,
+    typename CXXBLACS_REAL_TYPE<Field>::type TOL = 0.) {
+
+    return PHESQRT_NS(N,A,IA,JA,&DESCA[0],Y,IY,JY,&DESCY[0],Z,IZ,JZ,
+      &DESCZ[0],ITER,ITMAX,TOL);
+
+  }
+
+
+
+
+  /**
+   * \brief Sign function of a Hermitian matrix by the Newton-Schulz 
+   * iteration
+   *
+   *   X_0 = A / c,  X_k+1 = X_k * (3I - X_k * X_k) / 2
+   *
+   * with c = min(||A||_1,||A||_F) >= ||A||_2 (Higham, Functions of 
+   * Matrices, Ch. 5). Each step costs 2 PGEMMs. Convergence monitoring on
+   * RES_k = ||I - X_k * X_k||_F / sqrt(N) and the eigendecomposition 
+   * fallback (sign(0) = 0) are as in PHESQRT_NS.
+   *
+   * The full (both triangles) A is referenced and is unchanged on exit.
+   *
+   * @param[out] S    sign(A)
+   * @param[out] ITER Number of Newton-Schulz steps on success, otherwise
+   *                  -2 (divergence or stagnation) or -(ITMAX+1) 
+   *                  (no convergence)
+   *
+   * \returns INFO from PHEFUNC if the fallback is taken, 0 otherwise
+   */
+  template <typename Field>
+  inline CB_INT PHESIGN_NS(const CB_INT N, const Field *A, const CB_INT IA,
+    const CB_INT JA, const CB_INT *DESCA, Field *S, const CB_INT IS, 
+    const CB_INT JS, const CB_INT *DESCS, CB_INT &ITER, 
+    const CB_INT ITMAX = 100, 
+    typename CXXBLACS_REAL_TYPE<Field>::type TOL = 0.) {
+
+    typedef typename CXXBLACS_REAL_TYPE<Field>::type RealField;
+
+    ITER = 0;
+    if( N == 0 ) return 0;
+
+    CB_INT NPROW, NPCOL, MYROW, MYCOL;
+    BlacsGridInfo(DESCA[1],NPROW,NPCOL,MYROW,MYCOL);
+
+    const CB_INT ALocC = NumRoc(DESCA[3],DESCA[5],MYCOL,DESCA[7],NPCOL);
+
+    const RealField EPS = std::numeric_limits<RealField>::epsilon();
+    if( TOL <= 0. ) TOL = N * EPS;
+
+    const RealField C = std::min( PLANGE('1',N,N,A,IA,JA,DESCA),
+                                  PLANGE('F',N,N,A,IA,JA,DESCA) );
+
+    std::vector<Field> XK(DESCA[8] * ALocC), T(XK.size()), SCR(XK.size());
+
+    // X_0 = A / c
+    PGEADD('N',N,N,Field(1./C),A,IA,JA,DESCA,Field(0.),XK.data(),IA,JA,
+      DESCA);
+
+    RealField RES = std::numeric_limits<RealField>::max(), RESPrev = RES;
+    bool converged = false;
+
+    while( C > 0. ) {
+
+      // T = I - X * X
+      PLASET('A',N,N,Field(0.),Field(1.),T.data(),IA,JA,DESCA);
+      PGEMM('N','N',N,N,N,Field(-1.),XK.data(),IA,JA,DESCA,XK.data(),IA,JA,
+        DESCA,Field(1.),T.data(),IA,JA,DESCA);
+
+      RESPrev = RES;
+      RES     = PLANGE('F',N,N,T.data(),IA,JA,DESCA) / std::sqrt(RealField(N));
+
+      if( RES <= TOL ) { converged = true; break; }
+
+      // Stagnation (at roundoff level) / divergence
+      if( not (RES < RESPrev) or not (RES < 1.) ) {
+        converged = RES < std::sqrt(EPS);
+        break;
+      }
+
+      if( ITER == ITMAX ) break;
+
+      // X = X * (I + T/2)
+      PLACPY('A',N,N,XK.data(),IA,JA,DESCA,SCR.data(),IA,JA,DESCA);
+      PGEMM('N','N',N,N,N,Field(0.5),SCR.data(),IA,JA,DESCA,T.data(),IA,JA,
+        DESCA,Field(1.),XK.data(),IA,JA,DESCA);
+
+      ITER++;
+
+    }
+
+
+    if( converged ) {
+
+      PLACPY('A',N,N,XK.data(),IA,JA,DESCA,S,IS,JS,DESCS);
+      return 0;
+
+    }
+
+
+    // Eigendecomposition fallback
+    ITER = (ITER == ITMAX) ? -(ITMAX+1) : -2;
+    XK.clear(); T.clear(); SCR.clear();
+
+    std::vector<RealField> W(N);
+    auto signF = [](RealField x) { 
+      return RealField( (x > 0.) - (x < 0.) ); 
+    };
+
+    return PHEFUNC(N,A,IA,JA,DESCA,signF,S,IS,JS,DESCS,W.data());
+
+  }
+
+  template <typename Field>
+  inline CB_INT PHESIGN_NS(const CB_INT N, const Field *A, const CB_INT IA,
+    const CB_INT JA, const ScaLAPACK_Desc_t DESCA, Field *S, 
+    const CB_INT IS, const CB_INT JS, const ScaLAPACK_Desc_t DESCS, 
+    CB_INT &ITER, const CB_INT ITMAX = 100,
+    typename CXXBLACS_REAL_TYPE<Field>::type TOL = 0.) {
+
+    return PHESIGN_NS(N,A,IA,JA,&DESCA[0],S,IS,JS,&DESCS[0],ITER,ITMAX,TOL);
+
+  }
+
+}; // namespace CXXBLACS
+
+#endif
@@ -0,0 +1,536 @@
+/*
+ *  A simple C++ Wrapper for BLACS along with minimal extra functionality to 
+ *  aid the the high-level development of distributed memory linear algebra.
+ *  Copyright (C) 2016-2018 David Williams-Young
+
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef __INCLUDED_CXXBLACS_ALGORITHMS_PURIFICATION_HPP__
+#define __INCLUDED_CXXBLACS_ALGORITHMS_PURIFICATION_HPP__
+
+#include <cxxblacs/config.hpp>
+#include <cxxblacs/mpi.hpp>
+#include <cxxblacs/blacs.hpp>
+#include <cxxblacs/misc.hpp>
+#include <cxxblacs/scalapack.hpp>
+#include <cxxblacs/algorithms/util.hpp>
+
+#include <cmath>
+#include <vector>
+#include <limits>
+#include <algorithm>
+#include <stdexcept>
+
+namespace CXXBLACS {
+
+  /**
+   * \brief Convergence monitor / statistics of a purification step
+   */
+  struct PurificationStep {
+
+    double trace;       ///< Tr(X_k)
+    double idempotency; ///< ||X_k * X_k - X_k||_F
+    double flops;       ///< Floating point operations of the step
+    double time;        ///< Wall time of the step (s)
+
+  };
+
+
+  /**
+   * \brief Gershgorin bounds on the spectrum of the Hermitian matrix
+   * A(IA:IA+N-1,JA:JA+N-1) and its trace
+   *
+   * The full (both triangles) A is referenced. A single GSUM2D is performed
+   * over the context of A.
+   */
+  template <typename Field>
+  inline void GershgorinBounds(const CB_INT N, const Field *A, 
+    const CB_INT IA, const CB_INT JA, const CB_INT *DESCA,
+    typename CXXBLACS_REAL_TYPE<Field>::type &EMIN,
+    typename CXXBLACS_REAL_TYPE<Field>::type &EMAX,
+    typename CXXBLACS_REAL_TYPE<Field>::type &TRACE) {
+
+    typedef typename CXXBLACS_REAL_TYPE<Field>::type RealField;
+
+    CB_INT NPROW, NPCOL, MYROW, MYCOL;
+    BlacsGridInfo(DESCA[1],NPROW,NPCOL,MYROW,MYCOL);
+
+    const CB_INT ALocR = NumRoc(DESCA[2],DESCA[4],MYROW,DESCA[6],NPROW);
+    const CB_INT ALocC = NumRoc(DESCA[3],DESCA[5],MYCOL,DESCA[7],NPCOL);
+
+    // [ diag(A) | off-diagonal absolute row sums ]
+    std::vector<RealField> DR(2*N,0.);
+
+    for( CB_INT jLoc = 0; jLoc < ALocC; jLoc++ ) {
+
+      const CB_INT j = IndxL2G(jLoc,DESCA[5],MYCOL,DESCA[7],NPCOL) - (JA-1);
+      if( j < 0 or j >= N ) continue;
+
+      for( CB_INT iLoc = 0; iLoc < ALocR; iLoc++ ) {
+
+        const CB_INT i = IndxL2G(iLoc,DESCA[4],MYROW,DESCA[6],NPROW) - (IA-1);
+        if( i < 0 or i >= N ) continue;
+
+        if( i == j ) DR[i]     += std::real(A[iLoc + jLoc*DESCA[8]]);
+        else         DR[N + i] += std::abs (A[iLoc + jLoc*DESCA[8]]);
+
+      }
+
+    }
+
+    GSUM2D(DESCA[1],"All"," ",2*N,1,DR.data(),2*N,-1,-1);
+
+    EMIN  =  std::numeric_limits<RealField>::max();
+    EMAX  = -std::numeric_limits<RealField>::max();
+    TRACE = 0.;
+
+    for( CB_INT i = 0; i < N; i++ ) {
+      EMIN   = std::min(EMIN, DR[i] - DR[N+i]);
+      EMAX   = std::max(EMAX, DR[i] + DR[N+i]);
+      TRACE += DR[i];
+    }
+
+  }
+
+  template <typename Field>
+  inline void GershgorinBounds(const CB_INT N, const Field *A, 
+    const CB_INT IA, const CB_INT JA, const ScaLAPACK_Desc_t DESCA,
+    typename CXXBLACS_REAL_TYPE<Field>::type &EMIN,
+    typename CXXBLACS_REAL_TYPE<Field>::type &EMAX,
+    typename CXXBLACS_REAL_TYPE<Field>::type &TRACE) {
+
+    GershgorinBounds(N,A,IA,JA,&DESCA[0],EMIN,EMAX,TRACE);
+
+  }
+
+
+
+  /**
+   * \brief Fused trace / Frobenius reductions of a Hermitian X and 
+   * S = X * X (same distribution) in a single GSUM2D
+   *
+   *   TR[k] = Tr(X^(k+1)), k = 0,...,3,   TR[4] = ||S - X||_F^2
+   *
+   * using Tr(X^2) = ||X||_F^2, Tr(X^3) = Re sum S(i,j) conj(X(i,j)) and 
+   * Tr(X^4) = ||S||_F^2.
+   */
+  template <typename Field>
+  inline void PurificationTraces(const CB_INT N, const Field *X,
+    const Field *S, const CB_INT IX, const CB_INT JX, const CB_INT *DESCX,
+    typename CXXBLACS_REAL_TYPE<Field>::type *TR) {
+
+    CB_INT NPROW, NPCOL, MYROW, MYCOL;
+    BlacsGridInfo(DESCX[1],NPROW,NPCOL,MYROW,MYCOL);
+
+    const CB_INT XLocR = NumRoc(DESCX[2],DESCX[4],MYROW,DESCX[6],NPROW);
+    const CB_INT XLocC = NumRoc(DESCX[3],DESCX[5],MYCOL,DESCX[7],NPCOL);
+
+    std::fill(TR,TR+5,0.);
+
+    for( CB_INT jLoc = 0; jLoc < XLocC; jLoc++ ) {
+
+      const CB_INT j = IndxL2G(jLoc,DESCX[5],MYCOL,DESCX[7],NPCOL) - (JX-1);
+      if( j < 0 or j >= N ) continue;
+
+      for( CB_INT iLoc = 0; iLoc < XLocR; iLoc++ ) {
+
+        const CB_INT i = IndxL2G(iLoc,DESCX[4],MYROW,DESCX[6],NPROW) - (IX-1);
+        if( i < 0 or i >= N ) continue;
+
+        const Field x = X[iLoc + jLoc*DESCX[8]];
+        const Field s = S[iLoc + jLoc*DESCX[8]];
+
+        if( i == j ) TR[0] += std::real(x);
+        TR[1] += std::norm(x);
+        TR[2] += std::real(s * std::conj(x));
+        TR[3] += std::norm(s);
+        TR[4] += std::norm(s - x);
+
+      }
+
+    }
+
+    GSUM2D(DESCX[1],"All"," ",5,1,TR,5,-1,-1);
+
+  }
+
+
+
+  /**
+   * \brief Common driver of the purification schemes
+   *
+   * Each pass forms S = X * X (PGEMM) and the fused reductions of 
+   * PurificationTraces, and X is updated by STEP(S,TR), which returns the
+   * number of additional PGEMMs it performed. The iteration stops once 
+   * ||S - X||_F <= TOL, or the idempotency error stops decreasing below 
+   * sqrt(TOL) (roundoff).
+   *
+   * \returns 0 on convergence, 1 if ITMAX steps were exceeded
+   */
+  template <typename Field, typename Step>
+  inline CB_INT PurificationLoop(const CB_INT N, Field *X, const CB_INT IX,
+    const CB_INT JX, const CB_INT *DESCX, const Step &STEP, CB_INT &ITER,
+    std::vector<PurificationStep> *STATS, const CB_INT ITMAX, 
+    typename CXXBLACS_REAL_TYPE<Field>::type TOL) {
+
+    typedef typename CXXBLACS_REAL_TYPE<Field>::type RealField;
+
+    CB_INT NPROW, NPCOL, MYROW, MYCOL;
+    BlacsGridInfo(DESCX[1],NPROW,NPCOL,MYROW,MYCOL);
+
+    const CB_INT XLocC = NumRoc(DESCX[3],DESCX[5],MYCOL,DESCX[7],NPCOL);
+
+    if( TOL <= 0. ) TOL = N * std::numeric_limits<RealField>::epsilon();
+
+    // Flops of an N x N x N PGEMM
+    const double GEMMFlops = 
+      ( sizeof(Field) == sizeof(RealField) ? 2. : 8. ) * N * N * N;
+
+    std::vector<Field> S(DESCX[8] * XLocC);
+    RealField TR[5];
+    RealField IDEM = std::numeric_limits<RealField>::max(), IDEMPrev;
+
+    if( STATS ) STATS->clear();
+
+    for( ITER = 0; ; ITER++ ) {
+
+      double tStep = MPI_Wtime();
+
+      // S = X * X
+      PGEMM('N','N',N,N,N,Field(1.),X,IX,JX,DESCX,X,IX,JX,DESCX,Field(0.),
+        S.data(),IX,JX,DESCX);
+
+      PurificationTraces(N,X,S.data(),IX,JX,DESCX,TR);
+
+      IDEMPrev = IDEM;
+      IDEM     = std::sqrt(TR[4]);
+
+      const bool converged = IDEM <= TOL or 
+        ( not (IDEM < IDEMPrev) and IDEM <= std::sqrt(TOL) );
+      const bool done = converged or ITER == ITMAX;
+
+      CB_INT NGEMM = 1;
+      if( not done ) NGEMM += STEP(S.data(),TR);
+
+      if( STATS ) 
+        STATS->push_back({ double(TR[0]), double(IDEM), NGEMM * GEMMFlops,
+          MPI_Wtime() - tStep });
+
+      if( done ) return converged ? 0 : 1;
+
+    }
+
+  }
+
+
+
+
+  /**
+   * \brief Grand canonical (McWeeny) purification: density matrix P of 
+   * the Hermitian H at chemical potential MU
+   *
+   *   P_0 = (LAMBDA/2) (MU I - H) + I/2,   P_k+1 = 3 P_k^2 - 2 P_k^3
+   *
+   * with LAMBDA = min(1/(EMAX - MU),1/(MU - EMIN)) from the Gershgorin 
+   * bounds of H (Palser and Manolopoulos, PRB 58, 1998). Converges to the
+   * projector onto the eigenvectors of H with eigenvalues below MU. Each 
+   * step costs 2 PGEMMs.
+   *
+   * H (full, both triangles) is unchanged on exit. P must have the same
+   * distribution as H.
+   *
+   * @param[out] ITER  Number of purification steps
+   * @param[out] STATS Optional per step convergence / performance monitor
+   *
+   * \returns 0 on convergence, 1 if ITMAX steps were exceeded
+   */
+  template <typename Field>
+  inline CB_INT PHEPURIFY_MCWEENY(const CB_INT N, 
+    const typename CXXBLACS_REAL_TYPE<Field>::type MU, const Field *H,
+    const CB_INT IH, const CB_INT JH, const CB_INT *DESCH, Field *P,
+    const CB_INT IP, const CB_INT JP, const CB_INT *DESCP, CB_INT &ITER,
+    std::vector<PurificationStep> *STATS = nullptr, const CB_INT ITMAX = 100,
+    const typename CXXBLACS_REAL_TYPE<Field>::type TOL = 0.) {
+
+    typedef typename CXXBLACS_REAL_TYPE<Field>::type RealField;
+
+    ITER = 0;
+    if( N == 0 ) return 0;
+
+    RealField EMIN, EMAX, TRACE;
+    GershgorinBounds(N,H,IH,JH,DESCH,EMIN,EMAX,TRACE);
+
+    if( not (MU > EMIN and MU < EMAX) ) {
+      std::runtime_error err("PHEPURIFY_MCWEENY: MU OUTSIDE OF SPECTRAL BOUNDS");
+      throw err;
+    }
+
+    const RealField LAMBDA = std::min(1. / (EMAX - MU), 1. / (MU - EMIN));
+
+    // P_0 = (LAMBDA/2) (MU I - H) + I/2
+    PGEADD('N',N,N,Field(-LAMBDA/2.),H,IH,JH,DESCH,Field(0.),P,IP,JP,DESCP);
+    AddDiagonal(N,Field((LAMBDA*MU + 1.)/2.),P,IP,JP,DESCP);
+
+    CB_INT NPROW, NPCOL, MYROW, MYCOL;
+    BlacsGridInfo(DESCP[1],NPROW,NPCOL,MYROW,MYCOL);
+
+    std::vector<Field> T(
+      DESCP[8] * NumRoc(DESCP[3],DESCP[5],MYCOL,DESCP[7],NPCOL) );
+
+    auto step = [&](const Field *S, const RealField *) -> CB_INT {
+
+      // P = S * (3I - 2P)
+      PGEADD('N',N,N,Field(-2.),P,IP,JP,DESCP,Field(0.),T.data(),IP,JP,
+        DESCP);
+      AddDiagonal(N,Field(3.),T.data(),IP,JP,DESCP);
+
+      PGEMM('N','N',N,N,N,Field(1.),S,IP,JP,DESCP,T.data(),IP,JP,DESCP,
+        Field(0.),P,IP,JP,DESCP);
+
+      return 1;
+
+    };
+
+    return PurificationLoop(N,P,IP,JP,DESCP,step,ITER,STATS,ITMAX,TOL);
+
+  }
+
+
+
+
+  /**
+   * \brief Trace resetting fourth order (TRS4) purification: density 
+   * matrix P of the Hermitian H with NOCC occupied states
+   *
+   *   P_0 = (EMAX I - H) / (EMAX - EMIN)
+   *
+   *   F(P) = P^2 (4P - 3P^2),  G(P) = P^2 (I - P)^2,
+   *   GAMMA = (NOCC - Tr F(P)) / Tr G(P)
+   *
+   *   P_k+1 = 2P - P^2              GAMMA > 6.19
+   *         = P^2                   GAMMA < 0
+   *         = F(P) + GAMMA G(P)     otherwise
+   *
+   * (Niklasson, Tymczak and Challacombe, JCP 118, 2003). The third case 
+   * is P^2 ((4 - 2 GAMMA) P + (GAMMA - 3) P^2 + GAMMA I) such that each 
+   * step costs at most 2 PGEMMs, the traces being obtained from the fused
+   * reductions of P and P^2.
+   *
+   * H (full, both triangles) is unchanged on exit. P must have the same
+   * distribution as H.
+   *
+   * @param[out] ITER  Number of purification steps
+   * @param[out] STATS Optional per step convergence / performance monitor
+   *
+   * \returns 0 on convergence, 1 if ITMAX steps were exceeded
+   */
+  template <typename Field>
+  inline CB_INT PHEPURIFY_TRS4(const CB_INT N, const CB_INT NOCC, 
+    const Field *H, const CB_INT IH, const CB_INT JH, const CB_INT *DESCH, 
+    Field *P, const CB_INT IP, const CB_INT JP, const CB_INT *DESCP, 
+    CB_INT &ITER, std::vector<PurificationStep> *STATS = nullptr, 
+    const CB_INT ITMAX = 100,
+    const typename CXXBLACS_REAL_TYPE<Field>::type TOL = 0.) {
+
+    typedef typename CXXBLACS_REAL_TYPE<Field>::type RealField;
+
+    ITER = 0;
+    if( N == 0 ) return 0;
+
+    RealField EMIN, EMAX, TRACE;
+    GershgorinBounds(N,H,IH,JH,DESCH,EMIN,EMAX,TRACE);
+
+    // P_0 = (EMAX I - H) / (EMAX - EMIN)
+    PGEADD('N',N,N,Field(-1./(EMAX - EMIN)),H,IH,JH,DESCH,Field(0.),P,IP,JP,
+      DESCP);
+    AddDiagonal(N,Field(EMAX/(EMAX - EMIN)),P,IP,JP,DESCP);
+
+    CB_INT NPROW, NPCOL, MYROW, MYCOL;
+    BlacsGridInfo(DESCP[1],NPROW,NPCOL,MYROW,MYCOL);
+
+    std::vector<Field> T(
+      DESCP[8] * NumRoc(DESCP[3],DESCP[5],MYCOL,DESCP[7],NPCOL) );
+
+    const RealField GAMMA_MIN = 0.;
+    const RealField GAMMA_MAX = 6.19;
+
+    auto step = [&](const Field *S, const RealField *TR) -> CB_INT {
+
+      const RealField TRF = 4. * TR[2] - 3. * TR[3];
+      const RealField TRG = TR[1] - 2. * TR[2] + TR[3];
+
+      const RealField GAMMA = (NOCC - TRF) / TRG;
+
+      if( GAMMA > GAMMA_MAX ) {
+
+        // P = 2P - P^2
+        PGEADD('N',N,N,Field(-1.),S,IP,JP,DESCP,Field(2.),P,IP,JP,DESCP);
+        return 0;
+
+      } else if( GAMMA < GAMMA_MIN ) {
+
+        // P = P^2
+        PLACPY('A',N,N,S,IP,JP,DESCP,P,IP,JP,DESCP);
+        return 0;
+
+      }
+
+      // P = P^2 ((4 - 2 GAMMA) P + (GAMMA - 3) P^2 + GAMMA I)
+      PGEADD('N',N,N,Field(4. - 2.*GAMMA),P,IP,JP,DESCP,Field(0.),T.data(),
+        IP,JP,DESCP);
+      PGEADD('N',N,N,Field(GAMMA - 3.),S,IP,JP,DESCP,Field(1.),T.data(),
+        IP,JP,DESCP);
+      AddDiagonal(N,Field(GAMMA),T.data(),IP,JP,DESCP);
+
+      PGEMM('N','N',N,N,N,Field(1.),S,IP,JP,DESCP,T.data(),IP,JP,DESCP,
+        Field(0.),P,IP,JP,DESCP);
+
+      return 1;
+
+    };
+
+    return PurificationLoop(N,P,IP,JP,DESCP,step,ITER,STATS,ITMAX,TOL);
+
+  }
+
+
+
+
+  /**
+   * \brief Canonical purification: density matrix P of the Hermitian H 
+   * with NOCC occupied states
+   *
+   *   MU = Tr(H) / N,  
+   *   LAMBDA = min(NOCC / (EMAX - MU), (N - NOCC) / (MU - EMIN))
+   *
+   *   P_0 = (LAMBDA/N) (MU I - H) + (NOCC/N) I
+   *
+   *   C = Tr(P^2 - P^3) / Tr(P - P^2)
+   *
+   *   P_k+1 = ((1 - 2C) P + (1 + C) P^2 - P^3) / (1 - C)   C <= 1/2
+   *         = ((1 + C) P^2 - P^3) / C                      otherwise
+   *
+   * (Palser and Manolopoulos, PRB 58, 1998). Tr(P) = NOCC is preserved
+   * by every step, which costs 2 PGEMMs.
+   *
+   * H (full, both triangles) is unchanged on exit. P must have the same
+   * distribution as H.
+   *
+   * @param[out] ITER  Number of purification steps
+   * @param[out] STATS Optional per step convergence / performance monitor
+   *
+   * \returns 0 on convergence, 1 if ITMAX steps were exceeded
+   */
+  template <typename Field>
+  inline CB_INT PHEPURIFY_CANONICAL(const CB_INT N, const CB_INT NOCC, 
+    const Field *H, const CB_INT IH, const CB_INT JH, const CB_INT *DESCH, 
+    Field *P, const CB_INT IP, const CB_INT JP, const CB_INT *DESCP, 
+    CB_INT &ITER, std::vector<PurificationStep> *STATS = nullptr, 
+    const CB_INT ITMAX = 100,
+    const typename CXXBLACS_REAL_TYPE<Field>::type TOL = 0.) {
+
+    typedef typename CXXBLACS_REAL_TYPE<Field>::type RealField;
+
+    ITER = 0;
+    if( N == 0 ) return 0;
+
+    RealField EMIN, EMAX, TRACE;
+    GershgorinBounds(N,H,IH,JH,DESCH,EMIN,EMAX,TRACE);
+
+    const RealField MU     = TRACE / N;
+    const RealField LAMBDA = 
+      std::min(NOCC / (EMAX - MU), (N - NOCC) / (MU - EMIN));
+
+    // P_0 = (LAMBDA/N) (MU I - H) + (NOCC/N) I
+    PGEADD('N',N,N,Field(-LAMBDA/N),H,IH,JH,DESCH,Field(0.),P,IP,JP,DESCP);
+    AddDiagonal(N,Field((LAMBDA*MU + NOCC)/N),P,IP,JP,DESCP);
+
+    CB_INT NPROW, NPCOL, MYROW, MYCOL;
+    BlacsGridInfo(DESCP[1],NPROW,NPCOL,MYROW,MYCOL);
+
+    std::vector<Field> T(
+      DESCP[8] * NumRoc(DESCP[3],DESCP[5],MYCOL,DESCP[7],NPCOL) );
+
+    auto step = [&](const Field *S, const RealField *TR) -> CB_INT {
+
+      const RealField C = (TR[1] - TR[2]) / (TR[0] - TR[1]);
+
+      // T = (1 + C) I - P
+      PGEADD('N',N,N,Field(-1.),P,IP,JP,DESCP,Field(0.),T.data(),IP,JP,
+        DESCP);
+      AddDiagonal(N,Field(1. + C),T.data(),IP,JP,DESCP);
+
+      // P = (P^2 T + (1 - 2C) P) / (1 - C)  or  P = P^2 T / C
+      if( C <= 0.5 )
+        PGEMM('N','N',N,N,N,Field(1./(1. - C)),S,IP,JP,DESCP,T.data(),IP,JP,
+          DESCP,Field((1. - 2.*C)/(1. - C)),P,IP,JP,DESCP);
+      else
+        PGEMM('N','N',N,N,N,Field(1./C),S,IP,JP,DESCP,T.data(),IP,JP,
+          DESCP,Field(0.),P,IP,JP,DESCP);
+
+      return 1;
+
+    };
+
+    return PurificationLoop(N,P,IP,JP,DESCP,step,ITER,STATS,ITMAX,TOL);
+
+  }
+
+
+
+  // ScaLAPACK_Desc_t variants
+
+  template <typename Field>
+  inline CB_INT PHEPURIFY_MCWEENY(const CB_INT N, 
+    const typename CXXBLACS_REAL_TYPE<Field>::type MU, const Field *H,
+    const CB_INT IH, const CB_INT JH, const ScaLAPACK_Desc_t DESCH, 
+    Field *P, const CB_INT IP, const CB_INT JP, const ScaLAPACK_Desc_t DESCP,
+    CB_INT &ITER, std::vector<PurificationStep> *STATS = nullptr, 
+    const CB_INT ITMAX = 100,
+    const typename CXXBLACS_REAL_TYPE<Field>::type TOL = 0.) {
+
+    return PHEPURIFY_MCWEENY(N,MU,H,IH,JH,&DESCH[0],P,IP,JP,&DESCP[0],ITER,
+      STATS,ITMAX,TOL);
+
+  }
+
+  template <typename Field>
+  inline CB_INT PHEPURIFY_TRS4(const CB_INT N, const CB_INT NOCC, 
+    const Field *H, const CB_INT IH, const CB_INT JH, 
+    const ScaLAPACK_Desc_t DESCH, Field *P, const CB_INT IP, 
+    const CB_INT JP, const ScaLAPACK_Desc_t DESCP, CB_INT &ITER, 
+    std::vector<PurificationStep> *STATS = nullptr, const CB_INT ITMAX = 100,
+    const typename CXXBLACS_REAL_TYPE<Field>::type TOL = 0.) {
+
+    return PHEPURIFY_TRS4(N,NOCC,H,IH,JH,&DESCH[0],P,IP,JP,&DESCP[0],ITER,
+      STATS,ITMAX,TOL);
+
+  }
+
+  template <typename Field>
+  inline CB_INT PHEPURIFY_CANONICAL(const CB_INT N, const CB_INT NOCC, 
+    const Field *H, const CB_INT IH, const CB_INT JH, 
+    const ScaLAPACK_Desc_t DESCH, Field *P, const CB_INT IP, 
+    const CB_INT JP, const ScaLAPACK_Desc_t DESCP, CB_INT &ITER, 
+    std::vector<PurificationStep> *STATS = nullptr, const CB_INT ITMAX = 100,
+    const typename CXXBLACS_REAL_TYPE<Field>::type TOL = 0.) {
+
+    return PHEPURIFY_CANONICAL(N,NOCC,H,IH,JH,&DESCH[0],P,IP,JP,&DESCP[0],
+      ITER,STATS,ITMAX,TOL);
+
+  }
+
+}; // namespace CXXBLACS
+
+#endif
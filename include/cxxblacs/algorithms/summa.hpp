@@ -0,0 +1,156 @@
+/*
+ *  A simple C++ Wrapper for BLACS along with minimal extra functionality to 
+ *  aid the the high-level development of distributed memory linear algebra.
+ *  Copyright (C) 2016-2018 David Williams-Young
+
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef __INCLUDED_CXXBLACS_ALGORITHMS_SUMMA_HPP__
+#define __INCLUDED_CXXBLACS_ALGORITHMS_SUMMA_HPP__
+
+#include <cxxblacs/config.hpp>
+#include <cxxblacs/mpi.hpp>
+#include <cxxblacs/misc.hpp>
+#include <cxxblacs/lapack.hpp>
+#include <cxxblacs/blacsgrid.hpp>
+
+#include <vector>
+#include <algorithm>
+
+namespace CXXBLACS {
+
+  /**
+   * \brief SUMMA distributed GEMM: C = ALPHA * A * B + BETA * C
+   *
+   * A (M x K), B (K x N) and C (M x N) are distributed in the block-cyclic
+   * layout of GRID (MB x NB blocks from process (iSrc,jSrc)) with local 
+   * leading dimensions LDA, LDB and LDC.
+   *
+   * For each panel of K, the owning process column broadcasts its columns
+   * of A along the row communicator and the owning process row broadcasts
+   * its rows of B along the column communicator. Broadcasts are 
+   * nonblocking and double buffered: the panel k + 1 broadcasts are posted
+   * before the local GEMM on panel k, so that communication overlaps 
+   * computation. Panels span whole blocks of A's columns and B's rows, so
+   * MB != NB is admissible.
+   *
+   * Collective over GRID.
+   */
+  template <typename Field>
+  inline void SUMMA(const BlacsGrid &GRID, const CB_INT M, const CB_INT N,
+    const CB_INT K, const Field ALPHA, const Field *A, const CB_INT LDA,
+    const Field *B, const CB_INT LDB, const Field BETA, Field *C, 
+    const CB_INT LDC) {
+
+    const CB_INT MB = GRID.MB(), NB = GRID.NB();
+    const CB_INT NPROW = GRID.nProcRow(), NPCOL = GRID.nProcCol();
+    const CB_INT MYROW = GRID.iProcRow(), MYCOL = GRID.iProcCol();
+    const CB_INT ISRC  = GRID.iSrc(),     JSRC  = GRID.jSrc();
+
+    const CB_INT MLoc = NumRoc(M,MB,MYROW,ISRC,NPROW);
+    const CB_INT NLoc = NumRoc(N,NB,MYCOL,JSRC,NPCOL);
+
+    // C = BETA * C, panels then accumulate with unit BETA
+    if( BETA != Field(1.) )
+      for( CB_INT j = 0; j < NLoc; j++ )
+      for( CB_INT i = 0; i < MLoc; i++ )
+        C[i + j*LDC] = (BETA == Field(0.)) ? Field(0.) : BETA * C[i + j*LDC];
+
+    if( K == 0 or ALPHA == Field(0.) ) return;
+
+
+    // Panel boundaries: [K0[p], K0[p+1]) lies within a single column block
+    // of A and a single row block of B
+    std::vector<CB_INT> K0(1,0);
+    while( K0.back() < K ) {
+      const CB_INT k = K0.back();
+      K0.emplace_back( std::min({ K, (k / NB + 1) * NB, (k / MB + 1) * MB }) );
+    }
+    const CB_INT NPANEL = K0.size() - 1;
+    const CB_INT KBMax  = std::min(MB,NB);
+
+
+    // Double buffered panels
+    std::vector<Field> APanel[2], BPanel[2];
+    for( auto i = 0; i < 2; i++ ) {
+      APanel[i].resize(MLoc * KBMax);
+      BPanel[i].resize(KBMax * NLoc);
+    }
+
+    // Location of the panel data for this process: either the owning 
+    // process' local A / B, or the receive buffer
+    struct panel_t {
+      const Field *A; CB_INT LDA;
+      const Field *B; CB_INT LDB;
+      CB_INT KB;
+      MPIRequest reqA, reqB;
+    };
+
+    auto post = [&]( CB_INT p ) {
+
+      const CB_INT k  = K0[p];
+      const CB_INT KB = K0[p+1] - k;
+      Field *ABuf = APanel[p % 2].data();
+      Field *BBuf = BPanel[p % 2].data();
+
+      panel_t panel;
+      panel.KB = KB;
+
+      // Process column owning A(:,k), and local column index therein
+      const CB_INT PC = ((k / NB) + JSRC) % NPCOL;
+      const CB_INT JA = (k / (NB * NPCOL)) * NB + k % NB;
+
+      // Process row owning B(k,:), and local row index therein
+      const CB_INT PR = ((k / MB) + ISRC) % NPROW;
+      const CB_INT IB = (k / (MB * NPROW)) * MB + k % MB;
+
+      if( MYCOL == PC ) { panel.A = A + JA*LDA; panel.LDA = LDA; }
+      else              { panel.A = ABuf;       panel.LDA = MLoc; }
+
+      if( MYROW == PR ) { panel.B = B + IB;     panel.LDB = LDB;  }
+      else              { panel.B = BBuf;       panel.LDB = KB;   }
+
+      panel.reqA = GRID.IBroadcast("Row",MLoc,KB,const_cast<Field*>(panel.A),
+        panel.LDA,MYROW,PC);
+      panel.reqB = GRID.IBroadcast("Column",KB,NLoc,
+        const_cast<Field*>(panel.B),panel.LDB,PR,MYCOL);
+
+      return panel;
+
+    };
+
+    panel_t cur = post(0);
+
+    for( CB_INT p = 0; p < NPANEL; p++ ) {
+
+      // Post the next panel before computing on the current one
+      panel_t next;
+      if( p + 1 < NPANEL ) next = post(p+1);
+
+      cur.reqA.wait();
+      cur.reqB.wait();
+
+      if( MLoc > 0 and NLoc > 0 )
+        GEMM('N','N',MLoc,NLoc,cur.KB,ALPHA,cur.A,cur.LDA,cur.B,cur.LDB,
+          Field(1.),C,LDC);
+
+      cur = std::move(next);
+
+    }
+
+  }
+
+}; // namespace CXXBLACS
+
+#endif
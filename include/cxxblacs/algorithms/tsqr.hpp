@@ -0,0 +1,162 @@
+/*
+ *  A simple C++ Wrapper for BLACS along with minimal extra functionality to 
+ *  aid the the high-level development of distributed memory linear algebra.
+ *  Copyright (C) 2016-2018 David Williams-Young
+
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef __INCLUDED_CXXBLACS_ALGORITHMS_TSQR_HPP__
+#define __INCLUDED_CXXBLACS_ALGORITHMS_TSQR_HPP__
+
+#include <cxxblacs/config.hpp>
+#include <cxxblacs/blacs.hpp>
+#include <cxxblacs/misc.hpp>
+#include <cxxblacs/lapack.hpp>
+
+#include <vector>
+#include <algorithm>
+
+namespace CXXBLACS {
+
+  /**
+   * \brief Communication-avoiding tall-skinny QR (TSQR) of a distributed
+   * M x N (M >= N) matrix on a P x 1 process grid (see ORDER = "linear-col"
+   * in BlacsGrid).
+   *
+   * Each process factors its local rows with GEQRF, and the resulting N x N
+   * R factors are combined up a binary reduction tree (log2(P) messages on
+   * the critical path, as opposed to O(N) reductions for P?GEQRF). The 
+   * explicit Q is then formed by propagating the tree's Q factors back 
+   * down. Since the factorization is invariant to the ordering of the 
+   * rows, any row block size is admissible.
+   *
+   * On exit, A(1:M,1:N) is overwritten by the orthonormal Q and the upper 
+   * triangular R is replicated on all processes.
+   */
+  template <typename Field>
+  inline void TSQR(const CB_INT M, const CB_INT N, Field *A, 
+    const CB_INT *DESCA, Field *R, const CB_INT LDR) {
+
+    const CB_INT ICTXT = DESCA[1];
+
+    CB_INT NPROW, NPCOL, MYROW, MYCOL;
+    BlacsGridInfo(ICTXT,NPROW,NPCOL,MYROW,MYCOL);
+
+    if( NPCOL != 1 ) {
+      std::runtime_error err("TSQR requires a P x 1 process grid");
+      throw err;
+    }
+
+    if( M < N ) {
+      std::runtime_error err("TSQR requires M >= N");
+      throw err;
+    }
+
+    const CB_INT LDA  = DESCA[8];
+    const CB_INT MLoc = NumRoc(M,DESCA[4],MYROW,DESCA[6],NPROW);
+
+    // Leaf factorization (zero padded if MLoc < N)
+    const CB_INT LDQ = std::max(MLoc,N);
+    std::vector<Field> QLeaf(LDQ * N, Field(0.)), TauLeaf(N);
+
+    LACOPY('A',MLoc,N,A,LDA,QLeaf.data(),LDQ);
+    GEQRF(LDQ,N,QLeaf.data(),LDQ,TauLeaf.data());
+
+    std::vector<Field> RCur(N*N, Field(0.));
+    LACOPY('U',N,N,QLeaf.data(),LDQ,RCur.data(),N);
+
+
+    // Up-sweep: at each level the process 2*stride*k receives the R factor
+    // of 2*stride*k + stride and refactors [R_self; R_partner]
+    std::vector< std::vector<Field> > V, TAU;
+    std::vector< CB_INT > partner;
+    CB_INT parent = -1;
+
+    for( CB_INT stride = 1; stride < NPROW; stride *= 2 ) {
+
+      if( MYROW % (2*stride) == stride ) {
+
+        parent = MYROW - stride;
+        GESD2D(ICTXT,N,N,RCur.data(),N,parent,0);
+        break;
+
+      }
+
+      if( MYROW + stride >= NPROW ) continue;
+
+      std::vector<Field> S(2*N*N, Field(0.)), tau(N);
+
+      LACOPY('U',N,N,RCur.data(),N,S.data(),2*N);
+      GERV2D(ICTXT,N,N,S.data() + N,2*N,MYROW + stride,0);
+
+      GEQRF(2*N,N,S.data(),2*N,tau.data());
+
+      std::fill(RCur.begin(),RCur.end(),Field(0.));
+      LACOPY('U',N,N,S.data(),2*N,RCur.data(),N);
+
+      V.emplace_back(std::move(S));
+      TAU.emplace_back(std::move(tau));
+      partner.emplace_back(MYROW + stride);
+
+    }
+
+
+    // Replicate R
+    if( MYROW == 0 ) GEBS2D(ICTXT,"All"," ",N,N,RCur.data(),N);
+    else             GEBR2D(ICTXT,"All"," ",N,N,RCur.data(),N,0,0);
+
+    LACOPY('A',N,N,RCur.data(),N,R,LDR);
+
+
+    // Down-sweep: C holds the N x N block of the tree's Q owned by this 
+    // process, starting from the identity at the root
+    std::vector<Field> C(N*N, Field(0.)), QC(2*N*N);
+
+    if( parent < 0 ) for( CB_INT i = 0; i < N; i++ ) C[i*(N+1)] = Field(1.);
+    else GERV2D(ICTXT,N,N,C.data(),N,parent,0);
+
+    for( CB_INT l = V.size() - 1; l >= 0; l-- ) {
+
+      UNGQR(2*N,N,N,V[l].data(),2*N,TAU[l].data());
+      GEMM('N','N',2*N,N,N,Field(1.),V[l].data(),2*N,C.data(),N,Field(0.),
+        QC.data(),2*N);
+
+      GESD2D(ICTXT,N,N,QC.data() + N,2*N,partner[l],0);
+      LACOPY('A',N,N,QC.data(),2*N,C.data(),N);
+
+    }
+
+
+    // Leaf Q
+    UNGQR(LDQ,N,N,QLeaf.data(),LDQ,TauLeaf.data());
+    if( MLoc > 0 )
+      GEMM('N','N',MLoc,N,N,Field(1.),QLeaf.data(),LDQ,C.data(),N,
+        Field(0.),A,LDA);
+
+  }
+
+
+  // Conversion from ScaLAPACK_Desc_t -> CB_INT*
+
+  template <typename Field>
+  inline void TSQR(const CB_INT M, const CB_INT N, Field *A, 
+    const ScaLAPACK_Desc_t DESCA, Field *R, const CB_INT LDR) {
+
+    TSQR(M,N,A,&DESCA[0],R,LDR);
+
+  }
+
+}; // namespace CXXBLACS
+
+#endif
@@ -0,0 +1,421 @@
+/*
+ *  A simple C++ Wrapper for BLACS along with minimal extra functionality to 
+ *  aid the the high-level development of distributed memory linear algebra.
+ *  Copyright (C) 2016-2018 David Williams-Young
+
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef __INCLUDED_CXXBLACS_ALGORITHMS_TWOSTAGE_HPP__
+#define __INCLUDED_CXXBLACS_ALGORITHMS_TWOSTAGE_HPP__
+
+#include <cxxblacs/config.hpp>
+#include <cxxblacs/blacs.hpp>
+#include <cxxblacs/misc.hpp>
+#include <cxxblacs/lapack.hpp>
+#include <cxxblacs/scalapack.hpp>
+#include <cxxblacs/algorithms/util.hpp>
+
+#include <vector>
+#include <cmath>
+#include <algorithm>
+
+namespace CXXBLACS {
+
+  /**
+   * \brief Reduce a Hermitian band matrix to real symmetric tridiagonal form
+   *
+   * Householder bulge chasing which eliminates one column per sweep and
+   * chases the resulting bulge off the end of the band. The N x N matrix 
+   * B with KD subdiagonals is held in lower band storage in AB 
+   * (LDAB = 2*KD+1). Rows KD+1:2*KD hold the fill created while chasing 
+   * and must be zero on entry; AB is destroyed.
+   *
+   * On exit D / E hold the diagonal / subdiagonal of T = Q**H * B * Q, 
+   *
+   *   Q = H(1) * H(2) * ... * H(K) * diag(PHASE).
+   *
+   * Each reflector H = I - TAU * v * v**H acting on rows / columns 
+   * [R, R+LEN) is passed to APPLYQ(R,LEN,v,TAU) in the order generated, 
+   * such that Q may be accumulated in any distribution by the caller.
+   *
+   * \returns PHASE (length N)
+   */
+  template <typename Field, typename RealField, typename ApplyQ>
+  inline std::vector<Field> BandToTridiagonal(const CB_INT N, 
+    const CB_INT KD, Field *AB, RealField *D, RealField *E, 
+    const ApplyQ &APPLYQ) {
+
+    const CB_INT W    = 2 * KD;
+    const CB_INT LDAB = W + 1;
+
+    // B(I,J) for I >= J, I - J <= W
+    auto band = [&]( const CB_INT I, const CB_INT J ) -> Field& {
+      return AB[ (I-J) + J*LDAB ];
+    };
+
+    std::vector<Field> V(KD), WIN( (KD + 2*W) * (KD + 2*W) ), 
+      Y(KD + 2*W);
+
+    for( CB_INT j = 0; j < N - 2; j++ )
+    for( CB_INT COL = j, R = j+1; R < N; COL = R, R += KD ) {
+
+      const CB_INT LEN = std::min( KD, N - R );
+      if( LEN < 2 ) break;
+
+      // Reflector annihilating B(R+1:R+LEN-1,COL)
+      const Field ALPHA = band(R,COL);
+      RealField XNRM2 = 0.;
+      for( CB_INT k = 1; k < LEN; k++ ) XNRM2 += std::norm( band(R+k,COL) );
+
+      if( XNRM2 == RealField(0.) ) continue;
+
+      const RealField BETA = ( std::real(ALPHA) >= RealField(0.) ? -1 : 1 ) *
+        std::sqrt( std::norm(ALPHA) + XNRM2 );
+      const Field TAU  = ( Field(BETA) - ALPHA ) / BETA;
+      const Field SCAL = Field(1.) / ( ALPHA - BETA );
+
+      V[0] = Field(1.);
+      for( CB_INT k = 1; k < LEN; k++ ) V[k] = band(R+k,COL) * SCAL;
+
+
+      // B <- H**H * B * H on the window [LO,HI) of rows / columns which 
+      // couple to [R,R+LEN)
+      const CB_INT LO = std::max( CB_INT(0), R - W );
+      const CB_INT HI = std::min( N, R + LEN + W );
+      const CB_INT NW = HI - LO;
+
+      for( CB_INT jw = LO; jw < HI; jw++ )
+      for( CB_INT iw = LO; iw < HI; iw++ ) {
+
+        Field &x = WIN[ (iw-LO) + (jw-LO)*NW ];
+        if     ( iw >= jw and iw - jw <= W ) x = band(iw,jw);
+        else if( jw >  iw and jw - iw <= W ) x = FieldConj( band(jw,iw) );
+        else                                 x = Field(0.);
+
+      }
+
+      Field *WS = WIN.data() + (R-LO);
+      GEMM('C','N',1,NW,LEN,Field(1.),V.data(),LEN,WS,NW,Field(0.),
+        Y.data(),1);
+      GEMM('N','N',LEN,NW,1,-FieldConj(TAU),V.data(),LEN,Y.data(),1,
+        Field(1.),WS,NW);
+
+      WS = WIN.data() + (R-LO)*NW;
+      GEMM('N','N',NW,1,LEN,Field(1.),WS,NW,V.data(),LEN,Field(0.),
+        Y.data(),NW);
+      GEMM('N','C',NW,LEN,1,-TAU,Y.data(),NW,V.data(),LEN,Field(1.),
+        WS,NW);
+
+      for( CB_INT jw = LO; jw < HI; jw++ )
+      for( CB_INT iw = jw; iw < std::min( HI, jw + W + 1 ); iw++ )
+        band(iw,jw) = WIN[ (iw-LO) + (jw-LO)*NW ];
+
+      band(R,COL) = BETA;
+      for( CB_INT k = 1; k < LEN; k++ ) band(R+k,COL) = Field(0.);
+
+      APPLYQ( R, LEN, static_cast<const Field*>(V.data()), TAU );
+
+    }
+
+
+    // B = P * T * P**H with T real, P = diag(PHASE)
+    std::vector<Field> PHASE( N, Field(1.) );
+
+    for( CB_INT k = 0; k < N; k++ ) D[k] = std::real( band(k,k) );
+    for( CB_INT k = 0; k < N - 1; k++ ) {
+
+      const Field e = band(k+1,k);
+      E[k] = std::abs(e);
+      PHASE[k+1] = E[k] == RealField(0.) ? PHASE[k] : PHASE[k] * e / E[k];
+
+    }
+
+    return PHASE;
+
+  }
+
+
+
+  /**
+   * \brief Two-stage Hermitian eigensolver
+   *
+   * Drop-in replacement for P?HEEVD / P?SYEVD which replaces the BLAS-2 
+   * bound one-stage tridiagonalization with
+   *
+   *   1. A full-to-band reduction on the BLACS grid. Each panel of width NB
+   *      is factored with P?GEQRF and the trailing matrix is updated
+   *      two-sidedly with P?UNMQR (BLAS-3, PGEMM-rich).
+   *   2. A band-to-tridiagonal reduction (BandToTridiagonal) of the 
+   *      (KD+1) x N band, replicated on every process, followed by a 
+   *      distributed tridiagonal eigensolve (P?STEDC).
+   *   3. Back-transformation of the eigenvectors through both stages.
+   *
+   * The band width is taken to be the distribution block size (MB = NB is
+   * required). The reflectors of stage 2 are accumulated into its 
+   * eigenvectors distributed by rows over a NPROC x 1 grid, such that each
+   * process holds O(N^2 / NPROC) of them and performs O(N^3 / NPROC) of 
+   * the accumulation. The bulge chasing itself (O(N^2 KD) flops, O(N KD) 
+   * memory) is not distributed.
+   *
+   * The stage 1 reflectors are applied to Z in place, such that Z must 
+   * share the row distribution of A: DESCZ must have the same MB and RSRC
+   * as DESCA, and IZ must be aligned with IA (mod MB).
+   *
+   * Only the UPLO triangle of A is referenced on entry, A is destroyed on 
+   * exit. For real fields this is equivalent to PSYEVD_2STAGE.
+   *
+   * \returns INFO as returned by the failing ScaLAPACK / LAPACK call, 0 on
+   *          success. If the row distribution of Z does not match that of
+   *          A, -(1200 + 5) (MB), -(1200 + 7) (RSRC) or -10 (IZ), following
+   *          the ScaLAPACK convention.
+   */
+  template <typename Field, typename RealField>
+  inline CB_INT PHEEVD_2STAGE(const char JOBZ, const char UPLO, 
+    const CB_INT N, Field *A, const CB_INT IA, const CB_INT JA, 
+    const CB_INT *DESCA, RealField *W, Field *Z, const CB_INT IZ, 
+    const CB_INT JZ, const CB_INT *DESCZ) {
+
+    if( DESCA[4] != DESCA[5] ) {
+      std::runtime_error err("MB must be the same as NB in P?HEEVD_2STAGE");
+      throw err;
+    }
+
+    const bool wantZ = JOBZ == 'V' or JOBZ == 'v';
+    const bool lower = UPLO == 'L' or UPLO == 'l';
+
+    // Z must share the row distribution of A (see above)
+    if( wantZ ) {
+      if( DESCZ[4] != DESCA[4] ) return -(1200 + 5);
+      if( DESCZ[6] != DESCA[6] ) return -(1200 + 7);
+      if( (IZ-1) % DESCA[4] != (IA-1) % DESCA[4] ) return -10;
+    }
+
+    if( N == 0 ) return 0;
+
+    const CB_INT ICTXT = DESCA[1];
+    const CB_INT NB    = DESCA[5];
+
+    CB_INT NPROW, NPCOL, MYROW, MYCOL;
+    BlacsGridInfo(ICTXT,NPROW,NPCOL,MYROW,MYCOL);
+
+    const CB_INT LLDA  = DESCA[8];
+    const CB_INT ALocR = NumRoc(DESCA[2],DESCA[4],MYROW,DESCA[6],NPROW);
+    const CB_INT ALocC = NumRoc(DESCA[3],DESCA[5],MYCOL,DESCA[7],NPCOL);
+
+    CB_INT INFO = 0;
+
+
+
+    // Populate the unreferenced triangle of A
+    {
+      std::vector<Field> ACpy( LLDA * ALocC );
+      PLACPY( 'A', N, N, A, IA, JA, DESCA, ACpy.data(), IA, JA, DESCA );
+      PTRADD( lower ? 'U' : 'L', 'C', N, N, Field(1.), ACpy.data(), IA, JA,
+        DESCA, Field(0.), A, IA, JA, DESCA );
+    }
+
+
+    // Stage 1: Full -> Band (bandwidth KD)
+    const CB_INT KD = std::min( NB, N - 1 );
+    std::vector<Field> TAU( ALocC + NB );
+
+    CB_INT NPanel = 0;
+    for( CB_INT J = 0; J + NB < N; J += NB, NPanel++ ) {
+
+      const CB_INT MP = N - J - NB;
+      const CB_INT KP = std::min( MP, NB );
+
+      INFO = PGEQRF( MP, NB, A, IA+J+NB, JA+J, DESCA, TAU.data() );
+      if( INFO ) return INFO;
+
+      // A22 <- Q**H * A22 * Q
+      INFO = PUNMQR( 'L', 'C', MP, MP, KP, A, IA+J+NB, JA+J, DESCA, 
+               TAU.data(), A, IA+J+NB, JA+J+NB, DESCA );
+      if( INFO ) return INFO;
+
+      INFO = PUNMQR( 'R', 'N', MP, MP, KP, A, IA+J+NB, JA+J, DESCA, 
+               TAU.data(), A, IA+J+NB, JA+J+NB, DESCA );
+      if( INFO ) return INFO;
+
+    }
+
+
+    // Replicate the lower band on all processes (band storage, with room 
+    // for the fill created in stage 2)
+    const CB_INT LDAB = 2*KD + 1;
+    std::vector<Field> AB( LDAB * N, Field(0.) );
+
+    for( CB_INT jLoc = 0; jLoc < ALocC; jLoc++ ) {
+
+      const CB_INT j = IndxL2G(jLoc,DESCA[5],MYCOL,DESCA[7],NPCOL) - (JA-1);
+      if( j < 0 or j >= N ) continue;
+
+      for( CB_INT iLoc = 0; iLoc < ALocR; iLoc++ ) {
+
+        const CB_INT i = IndxL2G(iLoc,DESCA[4],MYROW,DESCA[6],NPROW) - (IA-1);
+        if( i < j or i > j + KD or i >= N ) continue;
+
+        AB[ (i-j) + j*LDAB ] = A[ iLoc + jLoc*LLDA ];
+
+      }
+
+    }
+
+    GSUM2D(ICTXT,"All"," ",KD+1,N,AB.data(),LDAB,-1,-1);
+
+
+
+    // Stage 2: Band -> Tridiagonal
+    std::vector<RealField> D(N), E(N);
+
+    if( not wantZ ) {
+
+      BandToTridiagonal( N, KD, AB.data(), D.data(), E.data(),
+        []( CB_INT, CB_INT, const Field*, Field ){ } );
+
+      INFO = STERF( N, D.data(), E.data() );
+      if( INFO ) return INFO;
+
+      std::copy( D.begin(), D.end(), W );
+      return 0;
+
+    }
+
+
+    // Q2 is accumulated distributed by rows over a NPROC x 1 grid on the
+    // processes of ICTXT, on which the reflectors of stage 2 are local
+    const CB_INT NPROC = NPROW * NPCOL;
+    std::vector<CB_INT> UMAP( NPROC );
+    for( CB_INT p = 0; p < NPROC; p++ ) 
+      UMAP[p] = Cblacs_pnum( ICTXT, p / NPCOL, p % NPCOL );
+
+    CB_INT ICTXT1D = BlacsGet( ICTXT, 10 );
+    BlacsGridMap( ICTXT1D, UMAP.data(), NPROC, NPROC, 1 );
+
+    CB_INT NPROW1D, NPCOL1D, MYROW1D, MYCOL1D;
+    BlacsGridInfo(ICTXT1D,NPROW1D,NPCOL1D,MYROW1D,MYCOL1D);
+
+    const CB_INT QLocR = NumRoc(N,NB,MYROW1D,0,NPROW1D);
+    const CB_INT LDQ   = std::max( QLocR, CB_INT(1) );
+    auto DESCQ2 = DescInit(N,N,NB,NB,0,0,ICTXT1D,LDQ);
+
+    std::vector<Field> Q2( LDQ * N, Field(0.) ), QV( LDQ );
+    for( CB_INT iLoc = 0; iLoc < QLocR; iLoc++ )
+      Q2[ iLoc + IndxL2G(iLoc,NB,MYROW1D,0,NPROW1D) * LDQ ] = Field(1.);
+
+    // Q2(:,R:R+LEN-1) <- Q2(:,R:R+LEN-1) * (I - TAU * v * v**H)
+    auto PHASE = BandToTridiagonal( N, KD, AB.data(), D.data(), E.data(),
+      [&]( CB_INT R, CB_INT LEN, const Field *V, Field TAU ) {
+
+        if( QLocR == 0 ) return;
+
+        GEMM( 'N', 'N', QLocR, 1, LEN, Field(1.), Q2.data() + R*LDQ, LDQ,
+          V, LEN, Field(0.), QV.data(), LDQ );
+        GEMM( 'N', 'C', QLocR, LEN, 1, -TAU, QV.data(), LDQ, V, LEN, 
+          Field(1.), Q2.data() + R*LDQ, LDQ );
+
+      } );
+
+    AB.clear(); AB.shrink_to_fit();
+
+    for( CB_INT j = 0; j < N; j++ )
+    for( CB_INT iLoc = 0; iLoc < QLocR; iLoc++ )
+      Q2[ iLoc + j*LDQ ] *= PHASE[j];
+
+
+    // Redistribute Q2 onto the 2-D grid
+    const CB_INT TLocR = NumRoc(N,NB,MYROW,0,NPROW);
+    const CB_INT TLocC = NumRoc(N,NB,MYCOL,0,NPCOL);
+    auto DESCT = DescInit(N,N,NB,NB,0,0,ICTXT,TLocR);
+
+    std::vector<Field> Q2Loc( TLocR * TLocC );
+
+    PGEMR2D( N, N, Q2.data(), 1, 1, DESCQ2, Q2Loc.data(), 1, 1, DESCT, 
+             ICTXT );
+    Q2.clear(); Q2.shrink_to_fit();
+    BlacsGridExit( ICTXT1D );
+
+
+    // Distributed tridiagonal eigensolve
+    std::vector<RealField> ZT( TLocR * TLocC );
+    INFO = PSTEDC( 'I', N, D.data(), E.data(), ZT.data(), 1, 1, DESCT );
+    if( INFO ) return INFO;
+
+    std::copy( D.begin(), D.end(), W );
+
+
+
+    // Back-transformation: Z = Q1 * Q2 * ZT
+    std::vector<Field> ZTF( ZT.begin(), ZT.end() );
+    ZT.clear(); ZT.shrink_to_fit();
+
+    PGEMM( 'N', 'N', N, N, N, Field(1.), Q2Loc.data(), 1, 1, &DESCT[0],
+      ZTF.data(), 1, 1, &DESCT[0], Field(0.), Z, IZ, JZ, DESCZ );
+
+    for( CB_INT p = NPanel - 1; p >= 0; p-- ) {
+
+      const CB_INT J  = p * NB;
+      const CB_INT MP = N - J - NB;
+      const CB_INT KP = std::min( MP, NB );
+
+      INFO = PUNMQR( 'L', 'N', MP, N, KP, A, IA+J+NB, JA+J, DESCA, 
+               TAU.data(), Z, IZ+J+NB, JZ, DESCZ );
+      if( INFO ) return INFO;
+
+    }
+
+    return 0;
+
+  }
+
+  /**
+   * \brief Two-stage symmetric eigensolver (see PHEEVD_2STAGE)
+   */
+  template <typename Field>
+  inline CB_INT PSYEVD_2STAGE(const char JOBZ, const char UPLO, 
+    const CB_INT N, Field *A, const CB_INT IA, const CB_INT JA, 
+    const CB_INT *DESCA, Field *W, Field *Z, const CB_INT IZ, 
+    const CB_INT JZ, const CB_INT *DESCZ) {
+
+    return PHEEVD_2STAGE<Field,Field>(JOBZ,UPLO,N,A,IA,JA,DESCA,W,Z,IZ,JZ,
+      DESCZ);
+
+  }
+
+
+  // Conversion from ScaLAPACK_Desc_t -> CB_INT*
+
+  template <typename Field, typename RealField>
+  inline CB_INT PHEEVD_2STAGE(const char JOBZ, const char UPLO, 
+    const CB_INT N, Field *A, const CB_INT IA, const CB_INT JA, 
+    const ScaLAPACK_Desc_t DESCA, RealField *W, Field *Z, const CB_INT IZ, 
+    const CB_INT JZ, const ScaLAPACK_Desc_t DESCZ) {
+
+    return PHEEVD_2STAGE(JOBZ,UPLO,N,A,IA,JA,&DESCA[0],W,Z,IZ,JZ,&DESCZ[0]);
+
+  }
+
+  template <typename Field>
+  inline CB_INT PSYEVD_2STAGE(const char JOBZ, const char UPLO, 
+    const CB_INT N, Field *A, const CB_INT IA, const CB_INT JA, 
+    const ScaLAPACK_Desc_t DESCA, Field *W, Field *Z, const CB_INT IZ, 
+    const CB_INT JZ, const ScaLAPACK_Desc_t DESCZ) {
+
+    return PSYEVD_2STAGE(JOBZ,UPLO,N,A,IA,JA,&DESCA[0],W,Z,IZ,JZ,&DESCZ[0]);
+
+  }
+
+}; // namespace CXXBLACS
+
+#endif
@@ -0,0 +1,117 @@
+/*
+ *  A simple C++ Wrapper for BLACS along with minimal extra functionality to 
+ *  aid the the high-level development of distributed memory linear algebra.
+ *  Copyright (C) 2016-2018 David Williams-Young
+
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef __INCLUDED_CXXBLACS_ALGORITHMS_UTIL_HPP__
+#define __INCLUDED_CXXBLACS_ALGORITHMS_UTIL_HPP__
+
+#include <cxxblacs/config.hpp>
+#include <cxxblacs/blacs.hpp>
+#include <cxxblacs/misc.hpp>
+
+#include <algorithm>
+#include <complex>
+
+namespace CXXBLACS {
+
+  /**
+   * \brief Complex conjugate which preserves the field (std::conj promotes
+   * real arguments to std::complex)
+   */
+  template <typename T>
+  inline T FieldConj(const T x) { return x; }
+
+  template <typename T>
+  inline std::complex<T> FieldConj(const std::complex<T> x) { 
+    return std::conj(x); 
+  }
+
+  /**
+   * \brief Add ALPHA to the diagonal of the distributed submatrix 
+   * A(IA:IA+N-1,JA:JA+N-1). 
+   *
+   * Purely local operation, no communication is performed.
+   */
+  template <typename Field>
+  inline void AddDiagonal(const CB_INT N, const Field ALPHA, Field *A,
+    const CB_INT IA, const CB_INT JA, const CB_INT *DESCA) {
+
+    CB_INT NPROW, NPCOL, MYROW, MYCOL;
+    BlacsGridInfo(DESCA[1],NPROW,NPCOL,MYROW,MYCOL);
+
+    const CB_INT ALocR = NumRoc(DESCA[2],DESCA[4],MYROW,DESCA[6],NPROW);
+    const CB_INT ALocC = NumRoc(DESCA[3],DESCA[5],MYCOL,DESCA[7],NPCOL);
+    if( ALocR == 0 ) return;
+
+    for( CB_INT jLoc = 0; jLoc < ALocC; jLoc++ ) {
+
+      const CB_INT j = IndxL2G(jLoc,DESCA[5],MYCOL,DESCA[7],NPCOL) - (JA-1);
+      if( j < 0 or j >= N ) continue;
+
+      for( CB_INT iLoc = 0; iLoc < ALocR; iLoc++ ) 
+      if( IndxL2G(iLoc,DESCA[4],MYROW,DESCA[6],NPROW) - (IA-1) == j ) 
+        A[ iLoc + jLoc*DESCA[8] ] += ALPHA;
+
+    }
+
+  }
+
+  template <typename Field>
+  inline void AddDiagonal(const CB_INT N, const Field ALPHA, Field *A,
+    const CB_INT IA, const CB_INT JA, const ScaLAPACK_Desc_t DESCA) {
+
+    AddDiagonal(N,ALPHA,A,IA,JA,&DESCA[0]);
+
+  }
+
+
+
+  /**
+   * \brief Element-wise conversion of the local buffer of a distributed 
+   * matrix to another field (e.g. precision): B = A
+   *
+   * B must have the same distribution (and local leading dimension) as A.
+   * Only the LOCr(M_A) x LOCc(N_A) local block is referenced, LLD padding 
+   * is skipped. Purely local operation, no communication is performed.
+   */
+  template <typename FieldA, typename FieldB>
+  inline void ConvertLocal(const FieldA *A, const CB_INT *DESCA, FieldB *B) {
+
+    CB_INT NPROW, NPCOL, MYROW, MYCOL;
+    BlacsGridInfo(DESCA[1],NPROW,NPCOL,MYROW,MYCOL);
+
+    const CB_INT ALocR = NumRoc(DESCA[2],DESCA[4],MYROW,DESCA[6],NPROW);
+    const CB_INT ALocC = NumRoc(DESCA[3],DESCA[5],MYCOL,DESCA[7],NPCOL);
+    if( ALocR == 0 ) return;
+
+    for( CB_INT jLoc = 0; jLoc < ALocC; jLoc++ )
+      std::transform(A + jLoc*DESCA[8], A + jLoc*DESCA[8] + ALocR, 
+        B + jLoc*DESCA[8], []( const FieldA x ){ return FieldB(x); });
+
+  }
+
+  template <typename FieldA, typename FieldB>
+  inline void ConvertLocal(const FieldA *A, const ScaLAPACK_Desc_t DESCA,
+    FieldB *B) {
+
+    ConvertLocal(A,&DESCA[0],B);
+
+  }
+
+}; // namespace CXXBLACS
+
+#endif
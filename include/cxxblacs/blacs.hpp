@@ -22,5 +22,7 @@
 #include <cxxblacs/blacs/gridmanip.hpp>
 #include <cxxblacs/blacs/collective.hpp>
 #include <cxxblacs/blacs/pointtopoint.hpp>
+#include <cxxblacs/blacs/topology.hpp>
+#include <cxxblacs/blacs/batch.hpp>
 
 #endif
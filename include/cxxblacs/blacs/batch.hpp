@@ -0,0 +1,175 @@
+/*
+ *  A simple C++ Wrapper for BLACS along with minimal extra functionality to 
+ *  aid the the high-level development of distributed memory linear algebra.
+ *  Copyright (C) 2016-2018 David Williams-Young
+
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef __INCLUDED_CXXBLACS_BLACS_BATCH_HPP__
+#define __INCLUDED_CXXBLACS_BLACS_BATCH_HPP__
+
+#include <cxxblacs/blacs/pointtopoint.hpp>
+#include <cxxblacs/blacs/gridmanip.hpp>
+#include <cxxblacs/lapack.hpp>
+
+#include <map>
+#include <vector>
+
+namespace CXXBLACS {
+
+
+  /**
+   * \brief Aggregation of many small point-to-point transfers
+   *
+   * Send / Recv queue (M,N,A,LDA,process) transfers without communicating.
+   * Flush then packs all blocks queued for a given process into a single
+   * contiguous buffer, exchanges one GESD2D / GERV2D message per process
+   * pair, and unpacks the received buffers into the queued destinations.
+   *
+   * As with GESD2D / GERV2D, blocks between a given pair of processes are
+   * matched in the order they were queued, and the shapes of matching 
+   * Send / Recv must agree. Transfers to the calling process itself are 
+   * copied locally. Send buffers must remain valid (and unmodified) until 
+   * Flush.
+   */
+  template <typename Field>
+  class MessageBatch {
+
+    struct Block {
+      CB_INT M, N, LDA;
+      Field  *A;
+    };
+
+    typedef std::pair<CB_INT,CB_INT> coord_type; ///< (process row, col)
+
+    CB_INT ICONTXT_;
+    CB_INT MYROW_, MYCOL_;
+
+    std::map<coord_type,std::vector<Block>> sends_;
+    std::map<coord_type,std::vector<Block>> recvs_;
+
+    size_t nMessages_ = 0; ///< Messages sent by Flush so far
+    size_t nBlocks_   = 0; ///< Blocks sent by Flush so far
+
+    static inline size_t packedSize(const std::vector<Block> &blocks) {
+
+      size_t sz = 0;
+      for( auto &b : blocks ) sz += b.M * b.N;
+      return sz;
+
+    }
+
+    static inline void pack(const std::vector<Block> &blocks, Field *buf) {
+
+      for( auto &b : blocks ) {
+        LACOPY('A',b.M,b.N,b.A,b.LDA,buf,b.M);
+        buf += b.M * b.N;
+      }
+
+    }
+
+    static inline void unpack(const std::vector<Block> &blocks, Field *buf) {
+
+      for( auto &b : blocks ) {
+        LACOPY('A',b.M,b.N,buf,b.M,b.A,b.LDA);
+        buf += b.M * b.N;
+      }
+
+    }
+
+  public:
+
+    MessageBatch(const CB_INT ICONTXT) : ICONTXT_(ICONTXT) {
+
+      CB_INT NPROW, NPCOL;
+      BlacsGridInfo(ICONTXT_,NPROW,NPCOL,MYROW_,MYCOL_);
+
+    }
+
+    // Queue a send of the M x N matrix A to process (RDEST,CDEST)
+    inline void Send(const CB_INT M, const CB_INT N, const Field *A, 
+      const CB_INT LDA, const CB_INT RDEST, const CB_INT CDEST) {
+
+      if( M == 0 or N == 0 ) return;
+      sends_[coord_type(RDEST,CDEST)].push_back(
+        { M, N, LDA, const_cast<Field*>(A) } );
+
+    }
+
+    // Queue a receive of the M x N matrix A from process (RSRC,CSRC)
+    inline void Recv(const CB_INT M, const CB_INT N, Field *A, 
+      const CB_INT LDA, const CB_INT RSRC, const CB_INT CSRC) {
+
+      if( M == 0 or N == 0 ) return;
+      recvs_[coord_type(RSRC,CSRC)].push_back( { M, N, LDA, A } );
+
+    }
+
+    /**
+     * \brief Perform all queued transfers and clear the queues.
+     *
+     * Every process which queued a Send to / Recv from this process must 
+     * also call Flush.
+     */
+    inline void Flush() {
+
+      const coord_type me(MYROW_,MYCOL_);
+
+      // Sends are locally blocking in BLACS, so all sends may be posted 
+      // before any receive
+      std::vector<Field> buf;
+      for( auto &s : sends_ ) {
+
+        buf.resize( packedSize(s.second) );
+        pack(s.second,buf.data());
+
+        if( s.first == me ) {
+
+          unpack(recvs_[me],buf.data());
+          recvs_.erase(me);
+
+        } else {
+
+          const CB_INT LEN = buf.size();
+          GESD2D(ICONTXT_,LEN,1,buf.data(),LEN,s.first.first,s.first.second);
+          nMessages_++;
+
+        }
+
+        nBlocks_ += s.second.size();
+
+      }
+
+      for( auto &r : recvs_ ) {
+
+        const CB_INT LEN = packedSize(r.second);
+        buf.resize( LEN );
+        GERV2D(ICONTXT_,LEN,1,buf.data(),LEN,r.first.first,r.first.second);
+        unpack(r.second,buf.data());
+
+      }
+
+      sends_.clear();
+      recvs_.clear();
+
+    }
+
+    inline size_t nMessages() const noexcept { return nMessages_; }
+    inline size_t nBlocks()   const noexcept { return nBlocks_;   }
+
+  };
+
+};
+
+#endif
@@ -67,13 +67,14 @@ namespace CXXBLACS {
         FUNC(&ICONTXT,SCOPE,TOP,&M,&N,ToBlacsType(A),&LDA);\
     }
 
+  GEBS2D_IMPL(CB_INT              ,igebs2d_);
   GEBS2D_IMPL(float               ,sgebs2d_);
   GEBS2D_IMPL(double              ,dgebs2d_);
   GEBS2D_IMPL(std::complex<float> ,cgebs2d_);
   GEBS2D_IMPL(std::complex<double>,zgebs2d_);
 
 
-  // Broadcast Send
+  // Broadcast Recv
   template<typename Field>
   inline void GEBR2D(const CB_INT ICONTXT, const char SCOPE[], 
     const char TOP[], const CB_INT M, const CB_INT N, Field *A, 
@@ -87,11 +88,127 @@ namespace CXXBLACS {
         FUNC(&ICONTXT,SCOPE,TOP,&M,&N,ToBlacsType(A),&LDA,&RSrc,&CSrc);\
     }
 
+  GEBR2D_IMPL(CB_INT              ,igebr2d_);
   GEBR2D_IMPL(float               ,sgebr2d_);
   GEBR2D_IMPL(double              ,dgebr2d_);
   GEBR2D_IMPL(std::complex<float> ,cgebr2d_);
   GEBR2D_IMPL(std::complex<double>,zgebr2d_);
 
+
+
+
+  /**
+   * \brief C++ Wrapper for ?GAMX2D / ?GAMN2D
+   *
+   * Templated functions that encompass the functionaliy of all of the BLACS
+   * collective element-wise absolute max / min routines: 
+   * [I/S/D/C/Z]GAM[X/N]2D. If RCFLAG != -1, the process coordinates of the
+   * selected entries are returned in RA / CA (leading dimension RCFLAG).
+   *
+   * See BLACS Documentaion for specifics.
+   */
+  template<typename Field>
+  inline void GAMX2D(const CB_INT ICONTXT, const char SCOPE[], 
+    const char TOP[], const CB_INT M, const CB_INT N, Field *A, 
+    const CB_INT LDA, CB_INT *RA, CB_INT *CA, const CB_INT RCFLAG, 
+    const CB_INT RDest, const CB_INT CDest);
+
+  template<typename Field>
+  inline void GAMN2D(const CB_INT ICONTXT, const char SCOPE[], 
+    const char TOP[], const CB_INT M, const CB_INT N, Field *A, 
+    const CB_INT LDA, CB_INT *RA, CB_INT *CA, const CB_INT RCFLAG, 
+    const CB_INT RDest, const CB_INT CDest);
+
+  #define GAMXN2D_IMPL(NAME,FIELD,FUNC)\
+    template<>\
+    inline void NAME(const CB_INT ICONTXT, const char SCOPE[], \
+      const char TOP[], const CB_INT M, const CB_INT N, FIELD *A,\
+      const CB_INT LDA, CB_INT *RA, CB_INT *CA, const CB_INT RCFLAG,\
+      const CB_INT RDest, const CB_INT CDest) {\
+        FUNC(&ICONTXT,SCOPE,TOP,&M,&N,ToBlacsType(A),&LDA,RA,CA,&RCFLAG,\
+          &RDest,&CDest);\
+    }
+
+  GAMXN2D_IMPL(GAMX2D,CB_INT              ,igamx2d_);
+  GAMXN2D_IMPL(GAMX2D,float               ,sgamx2d_);
+  GAMXN2D_IMPL(GAMX2D,double              ,dgamx2d_);
+  GAMXN2D_IMPL(GAMX2D,std::complex<float> ,cgamx2d_);
+  GAMXN2D_IMPL(GAMX2D,std::complex<double>,zgamx2d_);
+
+  GAMXN2D_IMPL(GAMN2D,CB_INT              ,igamn2d_);
+  GAMXN2D_IMPL(GAMN2D,float               ,sgamn2d_);
+  GAMXN2D_IMPL(GAMN2D,double              ,dgamn2d_);
+  GAMXN2D_IMPL(GAMN2D,std::complex<float> ,cgamn2d_);
+  GAMXN2D_IMPL(GAMN2D,std::complex<double>,zgamn2d_);
+
+  // Variants without location output
+  template<typename Field>
+  inline void GAMX2D(const CB_INT ICONTXT, const char SCOPE[], 
+    const char TOP[], const CB_INT M, const CB_INT N, Field *A, 
+    const CB_INT LDA, const CB_INT RDest, const CB_INT CDest) {
+
+    CB_INT IDUM;
+    GAMX2D(ICONTXT,SCOPE,TOP,M,N,A,LDA,&IDUM,&IDUM,-1,RDest,CDest);
+
+  }
+
+  template<typename Field>
+  inline void GAMN2D(const CB_INT ICONTXT, const char SCOPE[], 
+    const char TOP[], const CB_INT M, const CB_INT N, Field *A, 
+    const CB_INT LDA, const CB_INT RDest, const CB_INT CDest) {
+
+    CB_INT IDUM;
+    GAMN2D(ICONTXT,SCOPE,TOP,M,N,A,LDA,&IDUM,&IDUM,-1,RDest,CDest);
+
+  }
+
+
+
+
+  // Trapezoidal Broadcast Send
+  template<typename Field>
+  inline void TRBS2D(const CB_INT ICONTXT, const char SCOPE[], 
+    const char TOP[], const char UPLO[], const char DIAG[], const CB_INT M,
+    const CB_INT N, Field *A, const CB_INT LDA);
+
+  #define TRBS2D_IMPL(FIELD,FUNC)\
+    template<>\
+    inline void TRBS2D(const CB_INT ICONTXT, const char SCOPE[], \
+      const char TOP[], const char UPLO[], const char DIAG[], const CB_INT M,\
+      const CB_INT N, FIELD *A, const CB_INT LDA) {\
+        FUNC(&ICONTXT,SCOPE,TOP,UPLO,DIAG,&M,&N,ToBlacsType(A),&LDA);\
+    }
+
+  TRBS2D_IMPL(CB_INT              ,itrbs2d_);
+  TRBS2D_IMPL(float               ,strbs2d_);
+  TRBS2D_IMPL(double              ,dtrbs2d_);
+  TRBS2D_IMPL(std::complex<float> ,ctrbs2d_);
+  TRBS2D_IMPL(std::complex<double>,ztrbs2d_);
+
+
+  // Trapezoidal Broadcast Recv
+  template<typename Field>
+  inline void TRBR2D(const CB_INT ICONTXT, const char SCOPE[], 
+    const char TOP[], const char UPLO[], const char DIAG[], const CB_INT M,
+    const CB_INT N, Field *A, const CB_INT LDA, const CB_INT RSrc, 
+    const CB_INT CSrc);
+
+  #define TRBR2D_IMPL(FIELD,FUNC)\
+    template<>\
+    inline void TRBR2D(const CB_INT ICONTXT, const char SCOPE[], \
+      const char TOP[], const char UPLO[], const char DIAG[], const CB_INT M,\
+      const CB_INT N, FIELD *A, const CB_INT LDA, const CB_INT RSrc,\
+      const CB_INT CSrc) {\
+        FUNC(&ICONTXT,SCOPE,TOP,UPLO,DIAG,&M,&N,ToBlacsType(A),&LDA,&RSrc,\
+          &CSrc);\
+    }
+
+  TRBR2D_IMPL(CB_INT              ,itrbr2d_);
+  TRBR2D_IMPL(float               ,strbr2d_);
+  TRBR2D_IMPL(double              ,dtrbr2d_);
+  TRBR2D_IMPL(std::complex<float> ,ctrbr2d_);
+  TRBR2D_IMPL(std::complex<double>,ztrbr2d_);
+
 };
 
 #endif
@@ -61,14 +61,27 @@ namespace CXXBLACS {
 
 
   
+  /**
+   * \brief C++ Wrapper for BLACS_GRIDMAP
+   *
+   * See BLACS Documentation.
+   */
+  inline void BlacsGridMap(CB_INT &ICONTXT, CB_INT *USERMAP, 
+    const CB_INT LDUMAP, const CB_INT NPROW, const CB_INT NPCOL){
+    Cblacs_gridmap(&ICONTXT,USERMAP,LDUMAP,NPROW,NPCOL);
+  }
+
+
+
+  
   /**
    * \brief C++ Wrapper for BLACS_GRIDINFO
    *
    * See BLACS Documentation.
    */
   
-  inline void BlacsGridInfo(const CB_INT ICONTXT, CB_INT NPROW, 
-    CB_INT NPCOL, CB_INT &MYROW, CB_INT &MYCOL) {
+  inline void BlacsGridInfo(const CB_INT ICONTXT, CB_INT &NPROW, 
+    CB_INT &NPCOL, CB_INT &MYROW, CB_INT &MYCOL) {
     Cblacs_gridinfo(ICONTXT,&NPROW,&NPCOL,&MYROW,&MYCOL);
   }
 
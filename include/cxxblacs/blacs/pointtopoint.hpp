@@ -89,6 +89,68 @@ namespace CXXBLACS {
   GERV2D_IMPL(double              ,dgerv2d_);
   GERV2D_IMPL(std::complex<float> ,cgerv2d_);
   GERV2D_IMPL(std::complex<double>,zgerv2d_);
+
+
+
+
+  /**
+   * \brief C++ Wrapper for ?TRSD2D
+   *
+   * A templated function that encompasses the functionaliy of all of the BLACS
+   * point-to-point trapezoidal send routines: [I/S/D/C/Z]TRSD2D. Template 
+   * deduction is based on inut parameters
+   *
+   * See BLACS Documentaion for specifics.
+   */
+  template<typename Field>
+  inline void TRSD2D(const CB_INT ICONTXT, const char UPLO[], 
+    const char DIAG[], const CB_INT M, const CB_INT N, Field *A, 
+    const CB_INT LDA, const CB_INT RDest, const CB_INT CDest);
+
+  #define TRSD2D_IMPL(FIELD,FUNC)\
+  template<>\
+  inline void TRSD2D(const CB_INT ICONTXT, const char UPLO[],\
+    const char DIAG[], const CB_INT M, const CB_INT N, FIELD *A,\
+    const CB_INT LDA, const CB_INT RDest, const CB_INT CDest){\
+      FUNC(&ICONTXT,UPLO,DIAG,&M,&N,ToBlacsType(A),&LDA,&RDest,&CDest);\
+  }
+
+  TRSD2D_IMPL(CB_INT              ,itrsd2d_);
+  TRSD2D_IMPL(float               ,strsd2d_);
+  TRSD2D_IMPL(double              ,dtrsd2d_);
+  TRSD2D_IMPL(std::complex<float> ,ctrsd2d_);
+  TRSD2D_IMPL(std::complex<double>,ztrsd2d_);
+
+
+
+
+  /**
+   * \brief C++ Wrapper for ?TRRV2D
+   *
+   * A templated function that encompasses the functionaliy of all of the BLACS
+   * point-to-point trapezoidal recieve routines: [I/S/D/C/Z]TRRV2D. Template 
+   * deduction is based on inut parameters
+   *
+   * See BLACS Documentaion for specifics.
+   */
+  template<typename Field>
+  inline void TRRV2D(const CB_INT ICONTXT, const char UPLO[], 
+    const char DIAG[], const CB_INT M, const CB_INT N, Field *A, 
+    const CB_INT LDA, const CB_INT RSrc, const CB_INT CSrc);
+
+  #define TRRV2D_IMPL(FIELD,FUNC)\
+  template<>\
+  inline void TRRV2D(const CB_INT ICONTXT, const char UPLO[],\
+    const char DIAG[], const CB_INT M, const CB_INT N, FIELD *A,\
+    const CB_INT LDA, const CB_INT RSrc, const CB_INT CSrc){\
+      FUNC(&ICONTXT,UPLO,DIAG,&M,&N,ToBlacsType(A),&LDA,&RSrc,&CSrc);\
+  }
+
+  TRRV2D_IMPL(CB_INT              ,itrrv2d_);
+  TRRV2D_IMPL(float               ,strrv2d_);
+  TRRV2D_IMPL(double              ,dtrrv2d_);
+  TRRV2D_IMPL(std::complex<float> ,ctrrv2d_);
+  TRRV2D_IMPL(std::complex<double>,ztrrv2d_);
   
   
 
@@ -0,0 +1,309 @@
+/*
+ *  A simple C++ Wrapper for BLACS along with minimal extra functionality to 
+ *  aid the the high-level development of distributed memory linear algebra.
+ *  Copyright (C) 2016-2018 David Williams-Young
+
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef __INCLUDED_CXXBLACS_BLACS_TOPOLOGY_HPP__
+#define __INCLUDED_CXXBLACS_BLACS_TOPOLOGY_HPP__
+
+#include <cxxblacs/blacs/collective.hpp>
+
+#include <map>
+#include <vector>
+#include <string>
+#include <fstream>
+#include <iterator>
+#include <cstdlib>
+
+namespace CXXBLACS {
+
+
+  /**
+   * \brief Broadcast topology (TOP) selection for GEBS2D / GEBR2D
+   *
+   * Maintains a table which maps (scope, scope extent, message size) onto
+   * the fastest BLACS broadcast topology. The table is populated either by
+   * a microbenchmark over the candidate topologies (calibrate) or from a
+   * per-machine cache file (load). Without an entry, the BLACS default 
+   * (" ") is selected.
+   *
+   * Message sizes are bucketed by ceil(log2(bytes)), and lookups resolve to
+   * the largest calibrated bucket not exceeding the request.
+   */
+  class BroadcastTopology {
+
+    typedef std::tuple<char,CB_INT,CB_INT> key_type; ///< (scope,extent,bucket)
+
+    std::map<key_type,char> table_;
+
+    static inline char scopeKey(const char SCOPE[]) {
+
+      if( SCOPE[0] == 'R' or SCOPE[0] == 'r' ) return 'R';
+      if( SCOPE[0] == 'C' or SCOPE[0] == 'c' ) return 'C';
+      return 'A';
+
+    }
+
+    static inline CB_INT bucket(const size_t bytes) {
+
+      CB_INT b = 0;
+      while( (size_t(1) << b) < bytes ) b++;
+      return b;
+
+    }
+
+  public:
+
+    /**
+     * \brief Candidate topologies: default, increasing ring, split ring, 
+     * multi-ring, hypercube and 2-/4-way trees.
+     */
+    static inline const std::vector<char>& candidates() {
+
+      static const std::vector<char> tops = 
+        { ' ', 'I', 'S', 'M', 'H', '2', '4' };
+      return tops;
+
+    }
+
+    inline bool empty() const noexcept { return table_.empty(); }
+
+    /**
+     * \brief Whether any message size has been calibrated for SCOPE 
+     * spanning EXTENT processes
+     */
+    inline bool covers(const char SCOPE[], const CB_INT EXTENT) const {
+
+      auto it = table_.lower_bound( key_type(scopeKey(SCOPE),EXTENT,0) );
+      return it != table_.end() and 
+        std::get<0>(it->first) == scopeKey(SCOPE) and 
+        std::get<1>(it->first) == EXTENT;
+
+    }
+
+    inline void set(const char SCOPE[], const CB_INT EXTENT, 
+      const size_t BYTES, const char TOP) {
+
+      table_[ key_type(scopeKey(SCOPE),EXTENT,bucket(BYTES)) ] = TOP;
+
+    }
+
+    /**
+     * \brief Select the topology for a broadcast of BYTES bytes over 
+     * SCOPE, which spans EXTENT processes.
+     *
+     * Depends only on the arguments and the table, so all processes of
+     * the scope select the same topology if the table is replicated.
+     */
+    inline char select(const char SCOPE[], const CB_INT EXTENT, 
+      const size_t BYTES) const {
+
+      const char   S = scopeKey(SCOPE);
+      const CB_INT B = bucket(BYTES);
+
+      auto it = table_.upper_bound( key_type(S,EXTENT,B) );
+      if( it != table_.begin() ) {
+
+        // Largest bucket <= B for the same scope / extent
+        --it;
+        if( std::get<0>(it->first) == S and std::get<1>(it->first) == EXTENT )
+          return it->second;
+
+      }
+
+      // Requests below the smallest calibrated bucket
+      it = table_.lower_bound( key_type(S,EXTENT,0) );
+      if( it != table_.end() and std::get<0>(it->first) == S and 
+          std::get<1>(it->first) == EXTENT ) return it->second;
+
+      return ' ';
+
+    }
+
+
+
+    /**
+     * \brief Time GEBS2D / GEBR2D for each candidate topology and record
+     * the fastest per (scope, extent, message size).
+     *
+     * Collective over all processes of the BLACS context ICONTXT, of which
+     * COMM is the underlying communicator. Message sizes range from 
+     * 2^3 to 2^MAXLOG2 bytes in steps of 4x, each timed over NREP 
+     * broadcasts. Timings are reduced (max) over COMM, so every process 
+     * records identical entries.
+     */
+    inline void calibrate(const MPI_Comm COMM, const CB_INT ICONTXT,
+      const CB_INT MAXLOG2 = 22, const CB_INT NREP = 5) {
+
+      CB_INT NPROW, NPCOL, MYROW, MYCOL;
+      Cblacs_gridinfo(ICONTXT,&NPROW,&NPCOL,&MYROW,&MYCOL);
+
+      const std::vector<std::string> scopes = { "Row", "Column", "All" };
+      const std::vector<CB_INT> extents = { NPCOL, NPROW, NPROW * NPCOL };
+
+      std::vector<double> buffer( (size_t(1) << MAXLOG2) / sizeof(double) );
+
+      for( auto iS = 0; iS < 3; iS++ ) {
+
+        const char  *SCOPE = scopes[iS].c_str();
+        const CB_INT EXT   = extents[iS];
+        if( EXT == 1 ) continue;
+
+        // Source of the broadcast in the scope of this process
+        const CB_INT RSRC = (iS == 0) ? MYROW : 0;
+        const CB_INT CSRC = (iS == 1) ? MYCOL : 0;
+        const bool   iAmSrc = MYROW == RSRC and MYCOL == CSRC;
+
+      for( CB_INT B = 3; B <= MAXLOG2; B += 2 ) {
+
+        const CB_INT N = (CB_INT(1) << B) / sizeof(double);
+
+        double tBest = 0.;
+        char   topBest = ' ';
+
+        for( auto top : candidates() ) {
+
+          const char TOP[2] = { top, '\0' };
+
+          MPI_Barrier(COMM);
+          double t = MPI_Wtime();
+
+          for( CB_INT rep = 0; rep < NREP; rep++ )
+            if( iAmSrc ) GEBS2D(ICONTXT,SCOPE,TOP,N,1,buffer.data(),N);
+            else GEBR2D(ICONTXT,SCOPE,TOP,N,1,buffer.data(),N,RSRC,CSRC);
+
+          t = MPI_Wtime() - t;
+          MPI_Allreduce(MPI_IN_PLACE,&t,1,MPI_DOUBLE,MPI_MAX,COMM);
+
+          if( top == candidates().front() or t < tBest ) {
+            tBest   = t;
+            topBest = top;
+          }
+
+        }
+
+        table_[ key_type(scopeKey(SCOPE),EXT,B) ] = topBest;
+
+      }
+      }
+
+    }
+
+
+
+    // Serialization
+
+    // One "SCOPE EXTENT BUCKET TOP" entry per line, '_' denoting " "
+
+    inline void save(std::ostream &out) const {
+
+      for( auto &entry : table_ )
+        out << std::get<0>(entry.first) << " " << std::get<1>(entry.first) 
+            << " " << std::get<2>(entry.first) << " " 
+            << (entry.second == ' ' ? '_' : entry.second) << "\n";
+
+    }
+
+    inline void load(std::istream &in) {
+
+      char   S, TOP;
+      CB_INT EXT, B;
+      while( in >> S >> EXT >> B >> TOP )
+        table_[ key_type(S,EXT,B) ] = (TOP == '_') ? ' ' : TOP;
+
+    }
+
+    /**
+     * \brief Default per-machine cache file: $CXXBLACS_TOPOLOGY_CACHE if
+     * set, otherwise $HOME/.cxxblacs_topology.<processor name>
+     */
+    static inline std::string defaultCacheFile() {
+
+      const char *env = std::getenv("CXXBLACS_TOPOLOGY_CACHE");
+      if( env ) return std::string(env);
+
+      char name[MPI_MAX_PROCESSOR_NAME]; int len;
+      MPI_Get_processor_name(name,&len);
+
+      const char *home = std::getenv("HOME");
+      return std::string(home ? home : ".") + "/.cxxblacs_topology." + 
+        std::string(name,len);
+
+    }
+
+    /**
+     * \brief Load the table from FILE on the root of COMM and replicate it
+     * to all processes. Returns false if the file could not be read.
+     *
+     * Collective over COMM.
+     */
+    inline bool loadFile(const std::string &FILE, const MPI_Comm COMM) {
+
+      int iProc; MPI_Comm_rank(COMM,&iProc);
+
+      std::string contents;
+      int len = -1;
+      if( iProc == 0 ) {
+        std::ifstream in(FILE);
+        if( in.good() ) {
+          contents.assign( std::istreambuf_iterator<char>(in), 
+                           std::istreambuf_iterator<char>() );
+          len = contents.size();
+        }
+      }
+
+      MPI_Bcast(&len,1,MPI_INT,0,COMM);
+      if( len < 0 ) return false;
+
+      contents.resize(len);
+      MPI_Bcast(&contents[0],len,MPI_CHAR,0,COMM);
+
+      std::istringstream ss(contents);
+      load(ss);
+
+      return true;
+
+    }
+
+    /**
+     * \brief Write the table to FILE from the root of COMM
+     */
+    inline void saveFile(const std::string &FILE, const MPI_Comm COMM) const {
+
+      int iProc; MPI_Comm_rank(COMM,&iProc);
+      if( iProc != 0 ) return;
+
+      std::ofstream out(FILE);
+      if( out.good() ) save(out);
+
+    }
+
+  };
+
+
+  /**
+   * \brief Process-wide topology table used by BlacsGrid::Broadcast
+   */
+  inline BroadcastTopology& DefaultBroadcastTopology() {
+
+    static BroadcastTopology top;
+    return top;
+
+  }
+
+};
+
+#endif
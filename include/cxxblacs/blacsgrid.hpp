@@ -81,6 +81,12 @@ namespace CXXBLACS {
     CB_INT iSrc_;         ///< Source Row
     CB_INT jSrc_;         ///< Source Col
 
+    // Per-scope MPI communicators (ranked by the orthogonal grid coordinate)
+    MPI_Comm rowComm_ = MPI_COMM_NULL; ///< Processes in my grid row
+    MPI_Comm colComm_ = MPI_COMM_NULL; ///< Processes in my grid column
+
+    bool ownComm_ = false; ///< comm_ was created by (and freed with) the grid
+
   public:
 
 
@@ -95,7 +101,9 @@ namespace CXXBLACS {
      *   @param[in] c      MPI Communicator
      *   @param[in] MB     Block size for row distribution
      *   @param[in] NB     Block size for column distribution
-     *   @param[in] ORDER  Process Grid ordering (row / column major)
+     *   @param[in] ORDER  Process Grid ordering (row / column major). 
+     *                     "linear" yields a 1 x P grid, "linear-col" a 
+     *                     P x 1 grid
      *
      */
     BlacsGrid(MPI_Comm c, CB_INT mb, CB_INT nb,
@@ -112,7 +120,16 @@ namespace CXXBLACS {
         throw err;
       }
 
-      if( comm_ == MPI_COMM_NULL ) return;
+      // Processes outside of the grid (e.g. excluded by split / subgrid)
+      if( comm_ == MPI_COMM_NULL ) {
+
+        iProc_    = -1; nProc_    = 0;
+        IContxt_  = -1;
+        iProcRow_ = -1; iProcCol_ = -1;
+        nProcRow_ =  0; nProcCol_ =  0;
+        return;
+
+      }
 
       // Get the MPI info and system context
       int IPROC, NPROC; // for 64-bit ints
@@ -140,6 +157,12 @@ namespace CXXBLACS {
         nProcCol_ = nProc_;
         ORDER = "row-major";
 
+      } else if( not ORDER.compare("linear-col") ) {
+
+        nProcRow_ = nProc_;
+        nProcCol_ = 1;
+        ORDER = "row-major";
+
       } else {
 
         nProcRow_ = int(std::sqrt(nProc_));
@@ -160,12 +183,104 @@ namespace CXXBLACS {
       // Get grid information
       BlacsGridInfo(IContxt_,nProcRow_,nProcCol_,iProcRow_,iProcCol_);
 
+      // Split per-scope communicators. This is done eagerly as it is 
+      // collective over comm_, whereas scoped operations are not.
+      MPI_Comm_split(comm_,iProcRow_,iProcCol_,&rowComm_);
+      MPI_Comm_split(comm_,iProcCol_,iProcRow_,&colComm_);
+
     };
 
 
     ~BlacsGrid() {  
+      if( comm_ == MPI_COMM_NULL ) return;
+      if( rowComm_ != MPI_COMM_NULL ) MPI_Comm_free(&rowComm_);
+      if( colComm_ != MPI_COMM_NULL ) MPI_Comm_free(&colComm_);
       BlacsGridExit(IContxt_); 
       Cfree_blacs_system_handle( bHandle_ ); 
+      if( ownComm_ ) MPI_Comm_free(&comm_);
+    }
+
+
+    // A BlacsGrid owns its BLACS context, it may be moved but not copied
+    BlacsGrid( const BlacsGrid & )            = delete;
+    BlacsGrid& operator=( const BlacsGrid & ) = delete;
+
+    BlacsGrid( BlacsGrid &&other ) noexcept :
+      comm_(other.comm_), iProc_(other.iProc_), nProc_(other.nProc_),
+      IContxt_(other.IContxt_), bHandle_(other.bHandle_),
+      nProcRow_(other.nProcRow_), nProcCol_(other.nProcCol_),
+      iProcRow_(other.iProcRow_), iProcCol_(other.iProcCol_),
+      mb_(other.mb_), nb_(other.nb_), iSrc_(other.iSrc_), 
+      jSrc_(other.jSrc_), rowComm_(other.rowComm_), 
+      colComm_(other.colComm_), ownComm_(other.ownComm_) {
+
+      other.comm_    = MPI_COMM_NULL;
+      other.rowComm_ = MPI_COMM_NULL;
+      other.colComm_ = MPI_COMM_NULL;
+      other.ownComm_ = false;
+
+    }
+
+
+
+
+    /**
+     * \brief Split the grid into independent grids
+     *
+     * Processes which pass the same COLOR form a new (as close to square
+     * as possible) grid with the same block sizes, ranked by KEY (default:
+     * rank in this grid). Processes passing a negative COLOR receive a 
+     * grid in which they do not participate (see i_participate()).
+     *
+     * The new grids are independent of this one, which remains valid and
+     * may be used as the union context to redistribute between them.
+     * Collective over the grid.
+     */
+    inline BlacsGrid split(const CB_INT COLOR, const CB_INT KEY = -1) const {
+
+      MPI_Comm c;
+      MPI_Comm_split(comm_, COLOR < 0 ? MPI_UNDEFINED : COLOR, 
+        KEY < 0 ? iProc_ : KEY, &c);
+
+      BlacsGrid grid(c,mb_,nb_);
+      grid.ownComm_ = c != MPI_COMM_NULL;
+      return grid;
+
+    }
+
+    /**
+     * \brief Extract a rectangle of the process grid
+     *
+     * Yields the grid spanned by process rows [ROWS.first, ROWS.second) and
+     * process columns [COLS.first, COLS.second) of this grid, preserving 
+     * the relative position of each process. Processes outside of the 
+     * rectangle receive a grid in which they do not participate.
+     *
+     * Collective over the grid.
+     */
+    inline BlacsGrid subgrid(const INDX ROWS, const INDX COLS) const {
+
+      const CB_INT NR = ROWS.second - ROWS.first;
+      const CB_INT NC = COLS.second - COLS.first;
+
+      if( ROWS.first < 0 or ROWS.second > nProcRow_ or NR <= 0 or
+          COLS.first < 0 or COLS.second > nProcCol_ or NC <= 0 ) {
+        std::runtime_error err("Invalid subgrid range");
+        throw err;
+      }
+
+      const bool inside = 
+        iProcRow_ >= ROWS.first and iProcRow_ < ROWS.second and
+        iProcCol_ >= COLS.first and iProcCol_ < COLS.second;
+
+      MPI_Comm c;
+      MPI_Comm_split(comm_, inside ? 0 : MPI_UNDEFINED, 
+        (iProcRow_ - ROWS.first) * NC + (iProcCol_ - COLS.first), &c);
+
+      BlacsGrid grid(c,mb_,nb_,NR,NC,"row-major");
+      grid.ownComm_ = c != MPI_COMM_NULL;
+      return grid;
+
     }
 
 
@@ -181,6 +296,39 @@ namespace CXXBLACS {
     inline CB_INT iContxt()  const noexcept { return IContxt_;  }; ///< #IContxt_
     inline CB_INT NB()       const noexcept { return nb_;       }; ///< #nb_
     inline CB_INT MB()       const noexcept { return mb_;       }; ///< #mb_
+    inline CB_INT iSrc()     const noexcept { return iSrc_;     }; ///< #iSrc_
+    inline CB_INT jSrc()     const noexcept { return jSrc_;     }; ///< #jSrc_
+
+    inline MPI_Comm comm()    const noexcept { return comm_;    }; ///< #comm_
+    inline MPI_Comm rowComm() const noexcept { return rowComm_; }; ///< #rowComm_
+    inline MPI_Comm colComm() const noexcept { return colComm_; }; ///< #colComm_
+
+    /**
+     * \brief MPI communicator spanning a BLACS scope
+     *
+     * "Row" (resp. "Column") yields the processes in the current grid row
+     * (resp. column), ranked by grid column (resp. row) coordinate. 
+     * Otherwise ("All") yields the grid communicator.
+     */
+    inline MPI_Comm scopeComm(const char SCOPE[]) const noexcept {
+
+      if( SCOPE[0] == 'R' or SCOPE[0] == 'r' ) return rowComm_;
+      if( SCOPE[0] == 'C' or SCOPE[0] == 'c' ) return colComm_;
+      return comm_;
+
+    }
+
+    /**
+     * \brief Rank of grid process (IROW,ICOL) within scopeComm(SCOPE)
+     */
+    inline int scopeRank(const char SCOPE[], const CB_INT IROW, 
+      const CB_INT ICOL) const {
+
+      if( SCOPE[0] == 'R' or SCOPE[0] == 'r' ) return ICOL;
+      if( SCOPE[0] == 'C' or SCOPE[0] == 'c' ) return IROW;
+      return Cblacs_pnum(IContxt_,IROW,ICOL);
+
+    }
 
     inline bool i_participate() const noexcept { return comm_ != MPI_COMM_NULL; };
 
@@ -242,6 +390,8 @@ namespace CXXBLACS {
       
     inline INDX getLocalDims(const CB_INT M, const CB_INT N) const {
 
+      if( not i_participate() ) return { 0, 0 };
+
       return GetLocalDims(M,N,mb_,nb_,iProcRow_,iProcCol_,iSrc_,jSrc_,
           nProcRow_,nProcCol_);
              
@@ -293,6 +443,14 @@ namespace CXXBLACS {
 
     }
 
+    // Aggregated Send / Recv on this grid (see MessageBatch)
+    template <typename Field>
+    inline MessageBatch<Field> messageBatch() const {
+
+      return MessageBatch<Field>(IContxt_);
+
+    }
+
 
     // Broadcast
     template <typename Field>
@@ -308,6 +466,155 @@ namespace CXXBLACS {
     };
 
 
+    // Broadcast with TOP chosen by DefaultBroadcastTopology()
+    template <typename Field>
+    inline void Broadcast(const char SCOPE[], const CB_INT M, const CB_INT N,
+      Field *A, const CB_INT LDA, const CB_INT ISRC, const CB_INT JSRC) {
+
+      const char TOP[2] = { broadcastTopology(SCOPE,M*N*sizeof(Field)), '\0' };
+      Broadcast(SCOPE,TOP,M,N,A,LDA,ISRC,JSRC);
+
+    };
+
+    /**
+     * \brief Broadcast topology selected for a message of BYTES bytes over
+     * SCOPE of this grid
+     */
+    inline char broadcastTopology(const char SCOPE[], 
+      const size_t BYTES) const {
+
+      const CB_INT EXTENT = 
+        (SCOPE[0] == 'R' or SCOPE[0] == 'r') ? nProcCol_ :
+        (SCOPE[0] == 'C' or SCOPE[0] == 'c') ? nProcRow_ :
+        nProcRow_ * nProcCol_;
+
+      return DefaultBroadcastTopology().select(SCOPE,EXTENT,BYTES);
+
+    }
+
+    /**
+     * \brief Populate DefaultBroadcastTopology() for the extents of this 
+     * grid.
+     *
+     * Reads the per-machine cache (BroadcastTopology::defaultCacheFile) 
+     * if USE_CACHE. Scopes it does not cover are calibrated on this grid
+     * and the cache is rewritten. Collective over the grid.
+     */
+    inline void tuneBroadcast(const bool USE_CACHE = true, 
+      const CB_INT MAXLOG2 = 22) {
+
+      auto &topology  = DefaultBroadcastTopology();
+      const auto file = BroadcastTopology::defaultCacheFile();
+
+      if( USE_CACHE ) topology.loadFile(file,comm_);
+
+      const bool covered = 
+        (nProcCol_ == 1 or topology.covers("Row",nProcCol_)) and
+        (nProcRow_ == 1 or topology.covers("Column",nProcRow_)) and
+        (nProc_    == 1 or topology.covers("All",nProcRow_ * nProcCol_));
+
+      if( covered ) return;
+
+      topology.calibrate(comm_,IContxt_,MAXLOG2);
+      topology.saveFile(file,comm_);
+
+    }
+
+
+
+    // Nonblocking MPI communication
+    //
+    // Grid coordinates are mapped onto ranks of the scope communicators
+    // (scopeRank), strided submatrices are described by MPI derived 
+    // datatypes (MPISubmatrixType) rather than packed, and the returned 
+    // MPIRequest must be completed before the buffer is accessed.
+
+    /**
+     * \brief Nonblocking in-place reduction of a contiguous buffer over the
+     * processes of SCOPE ("Row", "Column" or "All").
+     *
+     * All processes within SCOPE must call.
+     */
+    template <typename Field>
+    inline MPIRequest IAllReduce(const char SCOPE[], const CB_INT COUNT,
+      Field *A, MPI_Op OP = MPI_SUM) const {
+
+      MPI_Request req;
+      MPI_Iallreduce(MPI_IN_PLACE,A,COUNT,MPIType<Field>(),OP,
+        scopeComm(SCOPE),&req);
+      return MPIRequest(req);
+
+    }
+
+    /**
+     * \brief Nonblocking broadcast of the M x N matrix A from grid process
+     * (RSRC,CSRC) over the processes of SCOPE ("Row", "Column" or "All").
+     *
+     * All processes within SCOPE must call.
+     */
+    template <typename Field>
+    inline MPIRequest IBroadcast(const char SCOPE[], const CB_INT M, 
+      const CB_INT N, Field *A, const CB_INT LDA, const CB_INT RSRC, 
+      const CB_INT CSRC) const {
+
+      int COUNT;
+      MPI_Datatype type = MPISubmatrixType<Field>(M,N,LDA,COUNT);
+
+      MPI_Request req;
+      MPI_Ibcast(A,COUNT,type,scopeRank(SCOPE,RSRC,CSRC),scopeComm(SCOPE),
+        &req);
+
+      if( type != MPIType<Field>() ) MPI_Type_free(&type);
+      return MPIRequest(req);
+
+    }
+
+    // Nonblocking broadcast of a contiguous buffer
+    template <typename Field>
+    inline MPIRequest IBroadcast(const char SCOPE[], const CB_INT COUNT,
+      Field *A, const CB_INT RSRC, const CB_INT CSRC) const {
+
+      return IBroadcast(SCOPE,COUNT,1,A,COUNT,RSRC,CSRC);
+
+    }
+
+    // Nonblocking send of the M x N matrix A to grid process (RDEST,CDEST)
+    template <typename Field>
+    inline MPIRequest Isend(const CB_INT M, const CB_INT N, const Field *A,
+      const CB_INT LDA, const CB_INT RDEST, const CB_INT CDEST,
+      const int TAG = CXXBLACS_MPI_DEFAULT_TAG) const {
+
+      int COUNT;
+      MPI_Datatype type = MPISubmatrixType<Field>(M,N,LDA,COUNT);
+
+      MPI_Request req;
+      MPI_Isend(const_cast<Field*>(A),COUNT,type,
+        Cblacs_pnum(IContxt_,RDEST,CDEST),TAG,comm_,&req);
+
+      if( type != MPIType<Field>() ) MPI_Type_free(&type);
+      return MPIRequest(req);
+
+    }
+
+    // Nonblocking recv of the M x N matrix A from grid process (RSRC,CSRC)
+    template <typename Field>
+    inline MPIRequest Irecv(const CB_INT M, const CB_INT N, Field *A,
+      const CB_INT LDA, const CB_INT RSRC, const CB_INT CSRC,
+      const int TAG = CXXBLACS_MPI_DEFAULT_TAG) const {
+
+      int COUNT;
+      MPI_Datatype type = MPISubmatrixType<Field>(M,N,LDA,COUNT);
+
+      MPI_Request req;
+      MPI_Irecv(A,COUNT,type,Cblacs_pnum(IContxt_,RSRC,CSRC),TAG,comm_,
+        &req);
+
+      if( type != MPIType<Field>() ) MPI_Type_free(&type);
+      return MPIRequest(req);
+
+    }
+
+
     // Scatter / Gather
 
     template <typename Field>
@@ -385,16 +692,254 @@ namespace CXXBLACS {
 
 
 
+    // Permutations
+
+    /**
+     * \brief Reorder the columns of an M x N matrix distributed on the 
+     * grid such that the new column k is the original column PERM[k].
+     *
+     * @param[in] PERM 0-based global permutation of the columns
+     */
+    template <typename Field>
+    inline void PermuteColumns(const CB_INT M, const CB_INT N, Field *ALoc,
+      const CB_INT LDLOCA, const CB_INT *PERM) {
+
+      std::vector<CB_INT> PIV(N);
+      PermutationToPivots(N,PERM,PIV.data());
+
+      CB_INT NLocR, NLocC;
+      std::tie(NLocR,NLocC) = getLocalDims(M,N);
+
+      // Local view of the pivots, replicated across process rows
+      std::vector<CB_INT> IPIV(NLocC + nb_);
+      for( CB_INT j = 0; j < NLocC; j++ )
+        IPIV[j] = PIV[IndxL2G(j,nb_,iProcCol_,jSrc_,nProcCol_)];
+
+      auto DescA = descInit(M,N,iSrc_,jSrc_,LDLOCA);
+      PLAPIV('F','C',M,N,ALoc,1,1,DescA,IPIV.data());
+
+    }
+
+    /**
+     * \brief Reorder the rows of an M x N matrix distributed on the 
+     * grid such that the new row k is the original row PERM[k].
+     *
+     * @param[in] PERM 0-based global permutation of the rows
+     */
+    template <typename Field>
+    inline void PermuteRows(const CB_INT M, const CB_INT N, Field *ALoc,
+      const CB_INT LDLOCA, const CB_INT *PERM) {
+
+      std::vector<CB_INT> PIV(M);
+      PermutationToPivots(M,PERM,PIV.data());
+
+      CB_INT NLocR, NLocC;
+      std::tie(NLocR,NLocC) = getLocalDims(M,N);
+
+      // Local view of the pivots, replicated across process columns
+      std::vector<CB_INT> IPIV(NLocR + mb_);
+      for( CB_INT i = 0; i < NLocR; i++ )
+        IPIV[i] = PIV[IndxL2G(i,mb_,iProcRow_,iSrc_,nProcRow_)];
+
+      auto DescA = descInit(M,N,iSrc_,jSrc_,LDLOCA);
+      PLAPIV('F','R',M,N,ALoc,1,1,DescA,IPIV.data());
+
+    }
+
+
+    // Distributed reductions over local buffers
+
+    /**
+     * \brief || A - B ||_F for M x N matrices distributed on the grid.
+     *
+     * Performs a single MPI_Allreduce over the grid communicator.
+     */
+    template <typename Field, 
+      typename RealField = typename CXXBLACS_REAL_TYPE<Field>::type>
+    inline RealField DiffNormF(const CB_INT M, const CB_INT N, 
+      const Field *ALoc, const CB_INT LDLOCA, const Field *BLoc, 
+      const CB_INT LDLOCB) const {
+
+      CB_INT NLocR, NLocC;
+      std::tie(NLocR,NLocC) = getLocalDims(M,N);
+
+      RealField nrm2 = 0.;
+      for( CB_INT j = 0; j < NLocC; j++ )
+      for( CB_INT i = 0; i < NLocR; i++ )
+        nrm2 += std::norm(ALoc[i + j*LDLOCA] - BLoc[i + j*LDLOCB]);
+
+      MPI_Allreduce(MPI_IN_PLACE,&nrm2,1,MPIType<RealField>(),MPI_SUM,
+        comm_);
+
+      return std::sqrt(nrm2);
+
+    }
+
+    /**
+     * \brief max_ij | A(i,j) - B(i,j) | for M x N matrices distributed on 
+     * the grid.
+     *
+     * Performs a single MPI_Allreduce over the grid communicator.
+     */
+    template <typename Field, 
+      typename RealField = typename CXXBLACS_REAL_TYPE<Field>::type>
+    inline RealField DiffMaxAbs(const CB_INT M, const CB_INT N, 
+      const Field *ALoc, const CB_INT LDLOCA, const Field *BLoc, 
+      const CB_INT LDLOCB) const {
+
+      CB_INT NLocR, NLocC;
+      std::tie(NLocR,NLocC) = getLocalDims(M,N);
+
+      RealField mx = 0.;
+      for( CB_INT j = 0; j < NLocC; j++ )
+      for( CB_INT i = 0; i < NLocR; i++ )
+        mx = std::max(mx,RealField(std::abs(ALoc[i + j*LDLOCA] - 
+          BLoc[i + j*LDLOCB])));
+
+      MPI_Allreduce(MPI_IN_PLACE,&mx,1,MPIType<RealField>(),MPI_MAX,comm_);
+
+      return mx;
+
+    }
+
+    /**
+     * \brief Tr[A] for an N x N matrix distributed on the grid.
+     *
+     * Performs a single MPI_Allreduce over the grid communicator.
+     */
+    template <typename Field>
+    inline Field Trace(const CB_INT N, const Field *ALoc, 
+      const CB_INT LDLOCA) const {
+
+      CB_INT NLocR, NLocC;
+      std::tie(NLocR,NLocC) = getLocalDims(N,N);
+
+      Field tr = 0.;
+      for( CB_INT j = 0; j < NLocC; j++ ) {
+
+        const CB_INT J = IndxL2G(j,nb_,iProcCol_,jSrc_,nProcCol_);
+
+        // Process row which owns global row J
+        if( ((J / mb_) + iSrc_) % nProcRow_ != iProcRow_ ) continue;
+
+        const CB_INT i = (J / (mb_ * nProcRow_)) * mb_ + J % mb_;
+        tr += ALoc[i + j*LDLOCA];
+
+      }
+
+      MPI_Allreduce(MPI_IN_PLACE,&tr,1,MPIType<Field>(),MPI_SUM,comm_);
+
+      return tr;
+
+    }
+
+
+    // Symmetrization
+
+    /**
+     * \brief A <- (A + A**T) / 2 for an N x N matrix distributed on the
+     * grid (in place).
+     *
+     * On a square process grid with MB == NB, the transpose of the local
+     * block owned by process (p,q) is exactly the local block owned by 
+     * (q,p), so only a single pairwise exchange between transposed grid
+     * positions is performed. Otherwise, falls back to PTRAN.
+     */
+    template <typename Field>
+    inline void Symmetrize(const CB_INT N, Field *ALoc, 
+      const CB_INT LDLOCA) {
+
+      symmetrize_(false,N,ALoc,LDLOCA);
+
+    }
+
+    /**
+     * \brief A <- (A + A**H) / 2 for an N x N matrix distributed on the 
+     * grid (in place). See Symmetrize.
+     */
+    template <typename Field>
+    inline void Hermitize(const CB_INT N, Field *ALoc, 
+      const CB_INT LDLOCA) {
+
+      symmetrize_(true,N,ALoc,LDLOCA);
+
+    }
+
+
+
+
 
     // ScaLAPACK Helper functions
       
     inline ScaLAPACK_Desc_t descInit(const CB_INT M, const CB_INT N,
       const CB_INT ISRC, const CB_INT JSRC, const CB_INT LDD) {
 
+      // Processes outside of the grid take part in redistributions 
+      // through the union context with a null descriptor
+      if( not i_participate() ) return DescNull(M,N,mb_,nb_);
+
       return DescInit(M,N,mb_,nb_,ISRC,JSRC,IContxt_,LDD);
 
     };
 
+
+  private:
+
+    template <typename T> 
+    static inline T conj_(const T x) { return x; }
+
+    template <typename T> 
+    static inline std::complex<T> conj_(const std::complex<T> x) { 
+      return std::conj(x); 
+    }
+
+    template <typename Field>
+    inline void symmetrize_(const bool HERM, const CB_INT N, Field *ALoc,
+      const CB_INT LDLOCA) {
+
+      CB_INT NLocR, NLocC;
+      std::tie(NLocR,NLocC) = getLocalDims(N,N);
+
+      if( nProcRow_ != nProcCol_ or mb_ != nb_ or iSrc_ != jSrc_ ) {
+
+        std::vector<Field> ACpy(ALoc, ALoc + LDLOCA * NLocC);
+        auto DescA = descInit(N,N,iSrc_,jSrc_,LDLOCA);
+
+        if( HERM ) 
+          PTRANC(N,N,Field(0.5),ACpy.data(),1,1,DescA,Field(0.5),ALoc,1,1,
+            DescA);
+        else
+          PTRAN(N,N,Field(0.5),ACpy.data(),1,1,DescA,Field(0.5),ALoc,1,1,
+            DescA);
+
+        return;
+
+      }
+
+      if( NLocR == 0 or NLocC == 0 ) return;
+
+      // Local block of the transposed grid position (NLocC x NLocR)
+      std::vector<Field> T(NLocC * NLocR);
+
+      if( iProcRow_ == iProcCol_ )
+        LACOPY('A',NLocR,NLocC,ALoc,LDLOCA,T.data(),NLocC);
+      else {
+
+        GESD2D(IContxt_,NLocR,NLocC,ALoc,LDLOCA,iProcCol_,iProcRow_);
+        GERV2D(IContxt_,NLocC,NLocR,T.data(),NLocC,iProcCol_,iProcRow_);
+
+      }
+
+      for( CB_INT j = 0; j < NLocC; j++ )
+      for( CB_INT i = 0; i < NLocR; i++ ) {
+
+        const Field AT = HERM ? conj_(T[j + i*NLocC]) : T[j + i*NLocC];
+        ALoc[i + j*LDLOCA] = Field(0.5) * (ALoc[i + j*LDLOCA] + AT);
+
+      }
+
+    }
+
   };
 
 
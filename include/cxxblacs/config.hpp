@@ -102,6 +102,30 @@ namespace CXXBLACS {
   typedef std::array<CB_INT,DESCINIT_LEN_MAX> ScaLAPACK_Desc_t;
 
 
+  // Real type associated with a field
+
+  template <typename T>
+  struct CXXBLACS_REAL_TYPE { typedef T type; };
+
+  template <typename T>
+  struct CXXBLACS_REAL_TYPE<std::complex<T>> { typedef T type; };
+
+  // Field of the reduced precision (e.g. factorization) in mixed precision
+  // algorithms
+
+  template <typename T>
+  struct CXXBLACS_LOW_PRECISION_TYPE { typedef T type; };
+
+  template <>
+  struct CXXBLACS_LOW_PRECISION_TYPE<double> { typedef float type; };
+
+  template <>
+  struct CXXBLACS_LOW_PRECISION_TYPE<std::complex<double>> { 
+    typedef std::complex<float> type; 
+  };
+
+
+
   // Type conversions for BLACS
 
   template <typename T>
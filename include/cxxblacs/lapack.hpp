@@ -21,6 +21,8 @@
 
 #include <cxxblacs/config.hpp>
 #include <cxxblacs/proto.hpp>
+#include <vector>
+#include <algorithm>
 
 namespace CXXBLACS {
 
@@ -100,6 +102,432 @@ namespace CXXBLACS {
   TRMM_IMPL(std::complex<float> ,ctrmm_);
   TRMM_IMPL(std::complex<double>,ztrmm_);
 
+
+
+
+  template <typename Field>
+  inline void TRSM(const char SIDE, const char UPLO, const char TRANSA, 
+    const char DIAG, const CB_INT M, const CB_INT N, const Field ALPHA,
+    const Field *A, const CB_INT LDA, Field *B, const CB_INT LDB);
+
+
+  #define TRSM_IMPL(F,FUNC)\
+  template <>\
+  inline void TRSM(const char SIDE, const char UPLO, const char TRANSA, \
+    const char DIAG, const CB_INT M, const CB_INT N, const F ALPHA,\
+    const F *A, const CB_INT LDA, F *B, const CB_INT LDB){\
+    FUNC(&SIDE,&UPLO,&TRANSA,&DIAG,&M,&N,ToBlasType(cc(&ALPHA)),\
+      ToBlasType(cc(A)),&LDA,ToBlasType(B),&LDB);\
+  }
+
+  TRSM_IMPL(float                  ,strsm_);
+  TRSM_IMPL(double                 ,dtrsm_);
+  TRSM_IMPL(std::complex<float> ,ctrsm_);
+  TRSM_IMPL(std::complex<double>,ztrsm_);
+
+
+
+
+
+  template <typename Field>
+  inline CB_INT STERF(const CB_INT N, Field *D, Field *E);
+
+  #define STERF_IMPL(F,FUNC)\
+  template <>\
+  inline CB_INT STERF(const CB_INT N, F *D, F *E) {\
+    \
+    CB_INT INFO;\
+    FUNC(&N,D,E,&INFO);\
+    return INFO;\
+    \
+  }
+
+  STERF_IMPL(float ,ssterf_);
+  STERF_IMPL(double,dsterf_);
+
+
+
+
+  template <typename Field>
+  inline CB_INT GEQRF(const CB_INT M, const CB_INT N, Field *A, 
+    const CB_INT LDA, Field *TAU, Field *WORK, const CB_INT LWORK);
+
+  #define GEQRF_IMPL(F,FUNC)\
+  template <>\
+  inline CB_INT GEQRF(const CB_INT M, const CB_INT N, F *A,\
+    const CB_INT LDA, F *TAU, F *WORK, const CB_INT LWORK) {\
+    \
+    CB_INT INFO;\
+    FUNC(&M,&N,ToLapackType(A),&LDA,ToLapackType(TAU),ToLapackType(WORK),\
+      &LWORK,&INFO);\
+    return INFO;\
+    \
+  }
+
+  GEQRF_IMPL(float               ,sgeqrf_);
+  GEQRF_IMPL(double              ,dgeqrf_);
+  GEQRF_IMPL(std::complex<float> ,cgeqrf_);
+  GEQRF_IMPL(std::complex<double>,zgeqrf_);
+
+
+  /**
+   *  \brief Form the explicit Q from a ?GEQRF factorization.
+   *
+   *  Wraps ?UNGQR for complex fields. For real fields ?UNGQR reduces to
+   *  ?ORGQR.
+   */
+  template <typename Field>
+  inline CB_INT UNGQR(const CB_INT M, const CB_INT N, const CB_INT K,
+    Field *A, const CB_INT LDA, const Field *TAU, Field *WORK, 
+    const CB_INT LWORK);
+
+  #define UNGQR_IMPL(F,FUNC)\
+  template <>\
+  inline CB_INT UNGQR(const CB_INT M, const CB_INT N, const CB_INT K,\
+    F *A, const CB_INT LDA, const F *TAU, F *WORK, const CB_INT LWORK) {\
+    \
+    CB_INT INFO;\
+    FUNC(&M,&N,&K,ToLapackType(A),&LDA,ToLapackType(cc(TAU)),\
+      ToLapackType(WORK),&LWORK,&INFO);\
+    return INFO;\
+    \
+  }
+
+  UNGQR_IMPL(float               ,sorgqr_);
+  UNGQR_IMPL(double              ,dorgqr_);
+  UNGQR_IMPL(std::complex<float> ,cungqr_);
+  UNGQR_IMPL(std::complex<double>,zungqr_);
+
+
+
+  /**
+   *  \brief Hermitian eigensolver (divide and conquer)
+   *
+   *  Wraps ?HEEVD for complex fields. For real fields ?HEEVD reduces to
+   *  ?SYEVD (RWORK is not referenced, a workspace query yields 
+   *  RWORK[0] = 1).
+   */
+  template <typename Field, typename RealField>
+  inline CB_INT HEEVD(const char JOBZ, const char UPLO, const CB_INT N,
+    Field *A, const CB_INT LDA, RealField *W, Field *WORK, 
+    const CB_INT LWORK, RealField *RWORK, const CB_INT LRWORK, 
+    CB_INT *IWORK, const CB_INT LIWORK);
+
+  #define HEEVD_IMPL(F,RF,FUNC)\
+  template <>\
+  inline CB_INT HEEVD(const char JOBZ, const char UPLO, const CB_INT N,\
+    F *A, const CB_INT LDA, RF *W, F *WORK, const CB_INT LWORK, RF *RWORK,\
+    const CB_INT LRWORK, CB_INT *IWORK, const CB_INT LIWORK) {\
+    \
+    CB_INT INFO;\
+    FUNC(&JOBZ,&UPLO,&N,ToLapackType(A),&LDA,W,ToLapackType(WORK),&LWORK,\
+      RWORK,&LRWORK,IWORK,&LIWORK,&INFO);\
+    return INFO;\
+    \
+  }
+
+  #define HEEVD_REAL_IMPL(F,FUNC)\
+  template <>\
+  inline CB_INT HEEVD(const char JOBZ, const char UPLO, const CB_INT N,\
+    F *A, const CB_INT LDA, F *W, F *WORK, const CB_INT LWORK, F *RWORK,\
+    const CB_INT LRWORK, CB_INT *IWORK, const CB_INT LIWORK) {\
+    \
+    CB_INT INFO;\
+    FUNC(&JOBZ,&UPLO,&N,A,&LDA,W,WORK,&LWORK,IWORK,&LIWORK,&INFO);\
+    if( LRWORK == -1 ) RWORK[0] = F(1.);\
+    return INFO;\
+    \
+  }
+
+  HEEVD_REAL_IMPL(float ,ssyevd_);
+  HEEVD_REAL_IMPL(double,dsyevd_);
+  HEEVD_IMPL(std::complex<float> ,float ,cheevd_);
+  HEEVD_IMPL(std::complex<double>,double,zheevd_);
+
+
+
+  /**
+   *  \brief Hermitian eigensolver (QR iteration)
+   *
+   *  Wraps ?HEEV for complex fields (RWORK of length max(1,3N-2)). For 
+   *  real fields ?HEEV reduces to ?SYEV (RWORK is not referenced).
+   */
+  template <typename Field, typename RealField>
+  inline CB_INT HEEV(const char JOBZ, const char UPLO, const CB_INT N,
+    Field *A, const CB_INT LDA, RealField *W, Field *WORK, 
+    const CB_INT LWORK, RealField *RWORK);
+
+  #define HEEV_IMPL(F,RF,FUNC)\
+  template <>\
+  inline CB_INT HEEV(const char JOBZ, const char UPLO, const CB_INT N,\
+    F *A, const CB_INT LDA, RF *W, F *WORK, const CB_INT LWORK, RF *RWORK) {\
+    \
+    CB_INT INFO;\
+    FUNC(&JOBZ,&UPLO,&N,ToLapackType(A),&LDA,W,ToLapackType(WORK),&LWORK,\
+      RWORK,&INFO);\
+    return INFO;\
+    \
+  }
+
+  #define HEEV_REAL_IMPL(F,FUNC)\
+  template <>\
+  inline CB_INT HEEV(const char JOBZ, const char UPLO, const CB_INT N,\
+    F *A, const CB_INT LDA, F *W, F *WORK, const CB_INT LWORK, F * /* RWORK */) {\
+    \
+    CB_INT INFO;\
+    FUNC(&JOBZ,&UPLO,&N,A,&LDA,W,WORK,&LWORK,&INFO);\
+    return INFO;\
+    \
+  }
+
+  HEEV_REAL_IMPL(float ,ssyev_);
+  HEEV_REAL_IMPL(double,dsyev_);
+  HEEV_IMPL(std::complex<float> ,float ,cheev_);
+  HEEV_IMPL(std::complex<double>,double,zheev_);
+
+
+
+
+  template <typename Field>
+  inline CB_INT GESV(const CB_INT N, const CB_INT NRHS, Field *A,
+    const CB_INT LDA, CB_INT *IPIV, Field *B, const CB_INT LDB);
+
+  #define GESV_IMPL(F,FUNC)\
+  template <>\
+  inline CB_INT GESV(const CB_INT N, const CB_INT NRHS, F *A,\
+    const CB_INT LDA, CB_INT *IPIV, F *B, const CB_INT LDB) {\
+    \
+    CB_INT INFO;\
+    FUNC(&N,&NRHS,ToLapackType(A),&LDA,IPIV,ToLapackType(B),&LDB,&INFO);\
+    return INFO;\
+    \
+  }
+
+  GESV_IMPL(float               ,sgesv_);
+  GESV_IMPL(double              ,dgesv_);
+  GESV_IMPL(std::complex<float> ,cgesv_);
+  GESV_IMPL(std::complex<double>,zgesv_);
+
+
+
+
+  template <typename Field>
+  inline CB_INT GETRF(const CB_INT M, const CB_INT N, Field *A,
+    const CB_INT LDA, CB_INT *IPIV);
+
+  #define GETRF_IMPL(F,FUNC)\
+  template <>\
+  inline CB_INT GETRF(const CB_INT M, const CB_INT N, F *A,\
+    const CB_INT LDA, CB_INT *IPIV) {\
+    \
+    CB_INT INFO;\
+    FUNC(&M,&N,ToLapackType(A),&LDA,IPIV,&INFO);\
+    return INFO;\
+    \
+  }
+
+  GETRF_IMPL(float               ,sgetrf_);
+  GETRF_IMPL(double              ,dgetrf_);
+  GETRF_IMPL(std::complex<float> ,cgetrf_);
+  GETRF_IMPL(std::complex<double>,zgetrf_);
+
+
+
+
+  template <typename Field>
+  inline CB_INT GETRS(const char TRANS, const CB_INT N, const CB_INT NRHS,
+    const Field *A, const CB_INT LDA, const CB_INT *IPIV, Field *B, 
+    const CB_INT LDB);
+
+  #define GETRS_IMPL(F,FUNC)\
+  template <>\
+  inline CB_INT GETRS(const char TRANS, const CB_INT N, const CB_INT NRHS,\
+    const F *A, const CB_INT LDA, const CB_INT *IPIV, F *B,\
+    const CB_INT LDB) {\
+    \
+    CB_INT INFO;\
+    FUNC(&TRANS,&N,&NRHS,ToLapackType(cc(A)),&LDA,IPIV,ToLapackType(B),\
+      &LDB,&INFO);\
+    return INFO;\
+    \
+  }
+
+  GETRS_IMPL(float               ,sgetrs_);
+  GETRS_IMPL(double              ,dgetrs_);
+  GETRS_IMPL(std::complex<float> ,cgetrs_);
+  GETRS_IMPL(std::complex<double>,zgetrs_);
+
+
+
+
+  template <typename Field>
+  inline CB_INT POTRF(const char UPLO, const CB_INT N, Field *A,
+    const CB_INT LDA);
+
+  #define POTRF_IMPL(F,FUNC)\
+  template <>\
+  inline CB_INT POTRF(const char UPLO, const CB_INT N, F *A,\
+    const CB_INT LDA) {\
+    \
+    CB_INT INFO;\
+    FUNC(&UPLO,&N,ToLapackType(A),&LDA,&INFO);\
+    return INFO;\
+    \
+  }
+
+  POTRF_IMPL(float               ,spotrf_);
+  POTRF_IMPL(double              ,dpotrf_);
+  POTRF_IMPL(std::complex<float> ,cpotrf_);
+  POTRF_IMPL(std::complex<double>,zpotrf_);
+
+
+
+
+  template <typename Field>
+  inline CB_INT POTRS(const char UPLO, const CB_INT N, const CB_INT NRHS,
+    const Field *A, const CB_INT LDA, Field *B, const CB_INT LDB);
+
+  #define POTRS_IMPL(F,FUNC)\
+  template <>\
+  inline CB_INT POTRS(const char UPLO, const CB_INT N, const CB_INT NRHS,\
+    const F *A, const CB_INT LDA, F *B, const CB_INT LDB) {\
+    \
+    CB_INT INFO;\
+    FUNC(&UPLO,&N,&NRHS,ToLapackType(cc(A)),&LDA,ToLapackType(B),&LDB,\
+      &INFO);\
+    return INFO;\
+    \
+  }
+
+  POTRS_IMPL(float               ,spotrs_);
+  POTRS_IMPL(double              ,dpotrs_);
+  POTRS_IMPL(std::complex<float> ,cpotrs_);
+  POTRS_IMPL(std::complex<double>,zpotrs_);
+
+  // LWORK obtaining variants
+
+  template <typename Field>
+  inline CB_INT GEQRF(const CB_INT M, const CB_INT N, Field *A, 
+    const CB_INT LDA, Field *TAU) {
+
+    CB_INT LWORK = -1;
+    std::vector< Field > WORK(5);
+
+    auto INFO = GEQRF( M, N, A, LDA, TAU, WORK.data(), LWORK );
+
+    if( INFO == 0 ) {
+
+      LWORK = CB_INT( std::real(WORK[0]) );
+      WORK.resize(LWORK);
+      INFO = GEQRF( M, N, A, LDA, TAU, WORK.data(), LWORK );
+
+    }
+
+    return INFO;
+
+  }
+
+  template <typename Field>
+  inline CB_INT UNGQR(const CB_INT M, const CB_INT N, const CB_INT K,
+    Field *A, const CB_INT LDA, const Field *TAU) {
+
+    CB_INT LWORK = -1;
+    std::vector< Field > WORK(5);
+
+    auto INFO = UNGQR( M, N, K, A, LDA, TAU, WORK.data(), LWORK );
+
+    if( INFO == 0 ) {
+
+      LWORK = CB_INT( std::real(WORK[0]) );
+      WORK.resize(LWORK);
+      INFO = UNGQR( M, N, K, A, LDA, TAU, WORK.data(), LWORK );
+
+    }
+
+    return INFO;
+
+  }
+
+  template <typename Field, typename RealField>
+  inline CB_INT HEEVD(const char JOBZ, const char UPLO, const CB_INT N,
+    Field *A, const CB_INT LDA, RealField *W) {
+
+    CB_INT LWORK  = -1;
+    CB_INT LRWORK = -1;
+    CB_INT LIWORK = -1;
+    std::vector< Field >     WORK(5);
+    std::vector< RealField > RWORK(5);
+    std::vector< CB_INT >    IWORK(5);
+
+    auto INFO = HEEVD( JOBZ, UPLO, N, A, LDA, W, WORK.data(), LWORK,
+                  RWORK.data(), LRWORK, IWORK.data(), LIWORK );
+
+    if( INFO == 0 ) {
+
+      LWORK  = CB_INT( std::real(WORK[0]) );
+      LRWORK = CB_INT( RWORK[0] );
+      LIWORK = IWORK[0];
+      WORK.resize(LWORK);
+      RWORK.resize(LRWORK);
+      IWORK.resize(LIWORK);
+
+      INFO = HEEVD( JOBZ, UPLO, N, A, LDA, W, WORK.data(), LWORK,
+               RWORK.data(), LRWORK, IWORK.data(), LIWORK );
+
+    }
+
+    return INFO;
+
+  }
+
+  template <typename Field, typename RealField>
+  inline CB_INT HEEV(const char JOBZ, const char UPLO, const CB_INT N,
+    Field *A, const CB_INT LDA, RealField *W) {
+
+    CB_INT LWORK = -1;
+    std::vector< Field >     WORK(5);
+    std::vector< RealField > RWORK( std::max(CB_INT(1), 3*N-2) );
+
+    auto INFO = HEEV( JOBZ, UPLO, N, A, LDA, W, WORK.data(), LWORK,
+                  RWORK.data() );
+
+    if( INFO == 0 ) {
+
+      LWORK = CB_INT( std::real(WORK[0]) );
+      WORK.resize(LWORK);
+      INFO = HEEV( JOBZ, UPLO, N, A, LDA, W, WORK.data(), LWORK,
+               RWORK.data() );
+
+    }
+
+    return INFO;
+
+  }
+
+  // ?SYEV / ?SYEVD naming for real fields
+
+  template <typename Field>
+  inline CB_INT SYEV(const char JOBZ, const char UPLO, const CB_INT N,
+    Field *A, const CB_INT LDA, Field *W) {
+
+    return HEEV<Field,Field>(JOBZ,UPLO,N,A,LDA,W);
+
+  }
+
+
+  template <typename Field>
+  inline CB_INT SYEVD(const char JOBZ, const char UPLO, const CB_INT N,
+    Field *A, const CB_INT LDA, Field *W) {
+
+    return HEEVD<Field,Field>(JOBZ,UPLO,N,A,LDA,W);
+
+  }
+
+  // ?ORGQR naming for real fields
+
+  template <typename... Args>
+  inline CB_INT ORGQR(Args... args) { return UNGQR(args...); }
+
 };
 
 #endif
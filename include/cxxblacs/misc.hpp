@@ -20,6 +20,8 @@
 #define __INCLUDED_CXXBLACS_MISC_HPP__
 
 #include <cxxblacs/config.hpp>
+#include <vector>
+#include <algorithm>
 
 namespace CXXBLACS {
 
@@ -48,6 +50,52 @@ namespace CXXBLACS {
   };
 
 
+  /**
+   * \brief Implementation of ScaLAPACK's INDXL2G (0-based)
+   *
+   * Maps a local row / column index on process IPROC to its global
+   * counterpart for a block-cyclic distribution.
+   */
+  inline CB_INT IndxL2G(const CB_INT INDXLOC, const CB_INT NB,
+    const CB_INT IPROC, const CB_INT ISRCPROC, const CB_INT NPROCS) {
+
+    return NPROCS * NB * (INDXLOC / NB) + INDXLOC % NB +
+      ((NPROCS + IPROC - ISRCPROC) % NPROCS) * NB;
+
+  };
+
+
+  /**
+   * \brief Convert a permutation into a sequence of interchanges
+   *
+   * On exit, applying the interchanges k <-> IPIV[k]-1 for k = 0,...,N-1
+   * (in order) to the rows / columns of a matrix places original 
+   * row / column PERM[k] at position k.
+   *
+   * @param[in]  N    Length of the permutation
+   * @param[in]  PERM 0-based permutation of {0,...,N-1}
+   * @param[out] IPIV 1-based pivot indices (LAPACK convention)
+   */
+  inline void PermutationToPivots(const CB_INT N, const CB_INT *PERM,
+    CB_INT *IPIV) {
+
+    std::vector<CB_INT> at(N), where(N);
+    for( CB_INT k = 0; k < N; k++ ) { at[k] = k; where[k] = k; }
+
+    for( CB_INT k = 0; k < N; k++ ) {
+
+      const CB_INT p = where[PERM[k]];
+      IPIV[k] = p + 1;
+
+      std::swap(at[k],at[p]);
+      where[at[k]] = k;
+      where[at[p]] = p;
+
+    }
+
+  }
+
+
   inline INDX GetLocalDims(const CB_INT M, const CB_INT N, const CB_INT MB,
     const CB_INT NB,   const CB_INT iProc, const CB_INT jProc,
     const CB_INT iSrc, const CB_INT jSrc,  const CB_INT nProcRow, 
@@ -149,6 +197,23 @@ namespace CXXBLACS {
 
 
 
+  /**
+   * \brief Descriptor for a process outside of the target context
+   *
+   * Redistribution routines (PxGEMR2D, PxTRMR2D) are called by every process
+   * of the union context, where processes that do not belong to the grid
+   * of a matrix must pass a descriptor with CTXT = -1.
+   */
+  inline ScaLAPACK_Desc_t DescNull(const CB_INT M, const CB_INT N,
+    const CB_INT MB, const CB_INT NB) {
+
+    ScaLAPACK_Desc_t desc = {{ 1, -1, M, N, MB, NB, 0, 0, 1 }};
+    return desc;
+
+  };
+
+
+
 }; // namespace CXXBLACS
 
 #endif
@@ -20,6 +20,7 @@
 #define __INCLUDED_CXXBLACS_MPI_HPP__
 
 #include <cxxblacs/config.hpp>
+#include <vector>
 
 #define CXXBLACS_MPI_ROOT 0
 #define CXXBLACS_MPI_DEFAULT_TAG 0
@@ -27,6 +28,109 @@
 
 namespace CXXBLACS {
 
+  /**
+   * \brief MPI_Datatype corresponding to a C++ type
+   */
+  template <typename T>
+  inline MPI_Datatype MPIType();
+
+  template<> inline MPI_Datatype MPIType<int32_t>(){ return MPI_INT32_T; }
+  template<> inline MPI_Datatype MPIType<int64_t>(){ return MPI_INT64_T; }
+  template<> inline MPI_Datatype MPIType<float>()  { return MPI_FLOAT;   }
+  template<> inline MPI_Datatype MPIType<double>() { return MPI_DOUBLE;  }
+  template<> inline MPI_Datatype MPIType<std::complex<float>>() { 
+    return MPI_C_FLOAT_COMPLEX;  
+  }
+  template<> inline MPI_Datatype MPIType<std::complex<double>>(){ 
+    return MPI_C_DOUBLE_COMPLEX; 
+  }
+
+
+  /**
+   * \brief Waitable handle for a nonblocking MPI operation
+   *
+   * Move-only. An outstanding operation is completed on destruction, so 
+   * buffers are never released while still in flight.
+   */
+  class MPIRequest {
+
+    MPI_Request req_ = MPI_REQUEST_NULL;
+
+  public:
+
+    MPIRequest() = default;
+    explicit MPIRequest(MPI_Request req) : req_(req) { }
+
+    MPIRequest(const MPIRequest&)            = delete;
+    MPIRequest& operator=(const MPIRequest&) = delete;
+
+    MPIRequest(MPIRequest &&other) noexcept : req_(other.req_) {
+      other.req_ = MPI_REQUEST_NULL;
+    }
+
+    MPIRequest& operator=(MPIRequest &&other) noexcept {
+      if( this != &other ) {
+        wait();
+        req_ = other.req_;
+        other.req_ = MPI_REQUEST_NULL;
+      }
+      return *this;
+    }
+
+    ~MPIRequest() { wait(); }
+
+    // Block until the operation has completed
+    inline void wait() {
+      if( req_ != MPI_REQUEST_NULL ) MPI_Wait(&req_,MPI_STATUS_IGNORE);
+    }
+
+    // Whether the operation has completed (progresses MPI)
+    inline bool test() {
+      int flag = 1;
+      if( req_ != MPI_REQUEST_NULL ) MPI_Test(&req_,&flag,MPI_STATUS_IGNORE);
+      return flag;
+    }
+
+    inline MPI_Request* native() noexcept { return &req_; }
+
+  };
+
+  // Complete a set of requests with a single MPI_Waitall
+  inline void WaitAll(std::vector<MPIRequest> &reqs) {
+
+    std::vector<MPI_Request> native;
+    for( auto &r : reqs ) native.emplace_back(*r.native());
+
+    MPI_Waitall(native.size(),native.data(),MPI_STATUSES_IGNORE);
+
+    for( size_t i = 0; i < reqs.size(); i++ ) *reqs[i].native() = native[i];
+
+  }
+
+  /**
+   * \brief MPI_Datatype describing an M x N column-major submatrix with
+   * leading dimension LDA, so strided data is communicated without packing.
+   *
+   * Returns the (predefined) element type and M * N in COUNT if contiguous;
+   * otherwise a committed vector type, COUNT = 1, which the caller frees.
+   */
+  template <typename Field>
+  inline MPI_Datatype MPISubmatrixType(const CB_INT M, const CB_INT N, 
+    const CB_INT LDA, int &COUNT) {
+
+    if( LDA == M or N == 1 ) {
+      COUNT = M * N;
+      return MPIType<Field>();
+    }
+
+    MPI_Datatype type;
+    MPI_Type_vector(N,M,LDA,MPIType<Field>(),&type);
+    MPI_Type_commit(&type);
+    COUNT = 1;
+    return type;
+
+  }
+
   template <typename Func>
   inline void RootExecute(const MPI_Comm c, const Func& op) {
 
@@ -38,6 +38,7 @@ extern "C" {
   void Cblacs_pinfo(CB_INT*,CB_INT*);
   void Cblacs_get(const CB_INT,const CB_INT,CB_INT*);
   void Cblacs_gridinit(CB_INT*,const char*,const CB_INT,const CB_INT);
+  void Cblacs_gridmap(CB_INT*,CB_INT*,const CB_INT,const CB_INT,const CB_INT);
   void Cblacs_gridinfo(const CB_INT,CB_INT*,CB_INT*,CB_INT*,CB_INT*);
   void Cblacs_barrier(const CB_INT,const char*);
   void Cblacs_gridexit(const CB_INT);
@@ -61,6 +62,23 @@ extern "C" {
   gesd_rv2d(CXXBLACS_BLACS_Complex8 ,cgerv2d_);
   gesd_rv2d(CXXBLACS_BLACS_Complex16,zgerv2d_);
 
+  // Trapezoidal point-to-point
+  #define trsd_rv2d(F,FUNC) \
+  void FUNC(const CB_INT*, const char*, const char*, const CB_INT *,\
+    const CB_INT *, F *, const CB_INT*, const CB_INT *, const CB_INT *);
+
+  trsd_rv2d(CB_INT                  ,itrsd2d_);
+  trsd_rv2d(float                   ,strsd2d_);
+  trsd_rv2d(double                  ,dtrsd2d_);
+  trsd_rv2d(CXXBLACS_BLACS_Complex8 ,ctrsd2d_);
+  trsd_rv2d(CXXBLACS_BLACS_Complex16,ztrsd2d_);
+
+  trsd_rv2d(CB_INT                  ,itrrv2d_);
+  trsd_rv2d(float                   ,strrv2d_);
+  trsd_rv2d(double                  ,dtrrv2d_);
+  trsd_rv2d(CXXBLACS_BLACS_Complex8 ,ctrrv2d_);
+  trsd_rv2d(CXXBLACS_BLACS_Complex16,ztrrv2d_);
+
 
 
   // BLACS collectives
@@ -82,6 +100,7 @@ extern "C" {
   void FUNC(const CB_INT *, const char*, const char*, const CB_INT*,\
     const CB_INT*, const F *, const CB_INT*);
 
+  gebs2d(CB_INT                  ,igebs2d_);
   gebs2d(float                   ,sgebs2d_);
   gebs2d(double                  ,dgebs2d_);
   gebs2d(CXXBLACS_BLACS_Complex8 ,cgebs2d_);
@@ -93,11 +112,56 @@ extern "C" {
   void FUNC(const CB_INT *, const char*, const char*, const CB_INT*,\
     const CB_INT*, const F *, const CB_INT*, const CB_INT *, const CB_INT*);
 
+  gebr2d(CB_INT                  ,igebr2d_);
   gebr2d(float                   ,sgebr2d_);
   gebr2d(double                  ,dgebr2d_);
   gebr2d(CXXBLACS_BLACS_Complex8 ,cgebr2d_);
   gebr2d(CXXBLACS_BLACS_Complex16,zgebr2d_);
 
+
+  // Element-wise absolute max / min (with optional location)
+  #define gamxn2d(F,FUNC) \
+  void FUNC(const CB_INT*, const char*, const char*, const CB_INT*,\
+    const CB_INT*, F*, const CB_INT*, CB_INT*, CB_INT*, const CB_INT*,\
+    const CB_INT*, const CB_INT*);
+
+  gamxn2d(CB_INT                  ,igamx2d_);
+  gamxn2d(float                   ,sgamx2d_);
+  gamxn2d(double                  ,dgamx2d_);
+  gamxn2d(CXXBLACS_BLACS_Complex8 ,cgamx2d_);
+  gamxn2d(CXXBLACS_BLACS_Complex16,zgamx2d_);
+
+  gamxn2d(CB_INT                  ,igamn2d_);
+  gamxn2d(float                   ,sgamn2d_);
+  gamxn2d(double                  ,dgamn2d_);
+  gamxn2d(CXXBLACS_BLACS_Complex8 ,cgamn2d_);
+  gamxn2d(CXXBLACS_BLACS_Complex16,zgamn2d_);
+
+
+  // Trapezoidal broadcast send
+  #define trbs2d(F,FUNC) \
+  void FUNC(const CB_INT *, const char*, const char*, const char*,\
+    const char*, const CB_INT*, const CB_INT*, const F *, const CB_INT*);
+
+  trbs2d(CB_INT                  ,itrbs2d_);
+  trbs2d(float                   ,strbs2d_);
+  trbs2d(double                  ,dtrbs2d_);
+  trbs2d(CXXBLACS_BLACS_Complex8 ,ctrbs2d_);
+  trbs2d(CXXBLACS_BLACS_Complex16,ztrbs2d_);
+
+
+  // Trapezoidal broadcast recv
+  #define trbr2d(F,FUNC) \
+  void FUNC(const CB_INT *, const char*, const char*, const char*,\
+    const char*, const CB_INT*, const CB_INT*, F *, const CB_INT*,\
+    const CB_INT*, const CB_INT*);
+
+  trbr2d(CB_INT                  ,itrbr2d_);
+  trbr2d(float                   ,strbr2d_);
+  trbr2d(double                  ,dtrbr2d_);
+  trbr2d(CXXBLACS_BLACS_Complex8 ,ctrbr2d_);
+  trbr2d(CXXBLACS_BLACS_Complex16,ztrbr2d_);
+
 };
     
 #endif
@@ -140,6 +204,198 @@ extern "C" {
   ptrmm(CXXBLACS_PBLAS_Complex8 ,pctrmm_);
   ptrmm(CXXBLACS_PBLAS_Complex16,pztrmm_);
 
+
+
+  #define ptradd(F,FUNC)\
+  void FUNC(const char*, const char*, const CB_INT*, const CB_INT*,\
+    const F*, const F*, const CB_INT*, const CB_INT*, const CB_INT*,\
+    const F*, F*, const CB_INT*, const CB_INT*, const CB_INT*);
+
+  ptradd(float                   ,pstradd_);
+  ptradd(double                  ,pdtradd_);
+  ptradd(CXXBLACS_PBLAS_Complex8 ,pctradd_);
+  ptradd(CXXBLACS_PBLAS_Complex16,pztradd_);
+
+
+
+  #define ptran(F,FUNC)\
+  void FUNC(const CB_INT*, const CB_INT*, const F*, const F*, const CB_INT*,\
+    const CB_INT*, const CB_INT*, const F*, F*, const CB_INT*,\
+    const CB_INT*, const CB_INT*);
+
+  ptran(float                   ,pstran_);
+  ptran(double                  ,pdtran_);
+  ptran(CXXBLACS_PBLAS_Complex8 ,pctranu_);
+  ptran(CXXBLACS_PBLAS_Complex16,pztranu_);
+  ptran(CXXBLACS_PBLAS_Complex8 ,pctranc_);
+  ptran(CXXBLACS_PBLAS_Complex16,pztranc_);
+
+
+
+  #define pgeadd(F,FUNC)\
+  void FUNC(const char*, const CB_INT*, const CB_INT*, const F*, const F*,\
+    const CB_INT*, const CB_INT*, const CB_INT*, const F*, F*,\
+    const CB_INT*, const CB_INT*, const CB_INT*);
+
+  pgeadd(float                   ,psgeadd_);
+  pgeadd(double                  ,pdgeadd_);
+  pgeadd(CXXBLACS_PBLAS_Complex8 ,pcgeadd_);
+  pgeadd(CXXBLACS_PBLAS_Complex16,pzgeadd_);
+
+
+
+  #define ptrsm(F,FUNC)\
+  void FUNC(const char*, const char*, const char*, const char*,\
+    const CB_INT*, const CB_INT*, const F*, const F*, const CB_INT*,\
+    const CB_INT*, const CB_INT*, F*, const CB_INT*, const CB_INT*,\
+    const CB_INT*);
+
+  ptrsm(float                   ,pstrsm_);
+  ptrsm(double                  ,pdtrsm_);
+  ptrsm(CXXBLACS_PBLAS_Complex8 ,pctrsm_);
+  ptrsm(CXXBLACS_PBLAS_Complex16,pztrsm_);
+
+
+
+  #define psyrk(F,RF,FUNC)\
+  void FUNC(const char*, const char*, const CB_INT*, const CB_INT*,\
+    const RF*, const F*, const CB_INT*, const CB_INT*, const CB_INT*,\
+    const RF*, F*, const CB_INT*, const CB_INT*, const CB_INT*);
+
+  psyrk(float                   ,float                   ,pssyrk_);
+  psyrk(double                  ,double                  ,pdsyrk_);
+  psyrk(CXXBLACS_PBLAS_Complex8 ,CXXBLACS_PBLAS_Complex8 ,pcsyrk_);
+  psyrk(CXXBLACS_PBLAS_Complex16,CXXBLACS_PBLAS_Complex16,pzsyrk_);
+
+  psyrk(CXXBLACS_PBLAS_Complex8 ,float                   ,pcherk_);
+  psyrk(CXXBLACS_PBLAS_Complex16,double                  ,pzherk_);
+
+
+
+  #define psyr2k(F,RF,FUNC)\
+  void FUNC(const char*, const char*, const CB_INT*, const CB_INT*,\
+    const F*, const F*, const CB_INT*, const CB_INT*, const CB_INT*,\
+    const F*, const CB_INT*, const CB_INT*, const CB_INT*, const RF*, F*,\
+    const CB_INT*, const CB_INT*, const CB_INT*);
+
+  psyr2k(float                   ,float                   ,pssyr2k_);
+  psyr2k(double                  ,double                  ,pdsyr2k_);
+  psyr2k(CXXBLACS_PBLAS_Complex8 ,CXXBLACS_PBLAS_Complex8 ,pcsyr2k_);
+  psyr2k(CXXBLACS_PBLAS_Complex16,CXXBLACS_PBLAS_Complex16,pzsyr2k_);
+
+  psyr2k(CXXBLACS_PBLAS_Complex8 ,float                   ,pcher2k_);
+  psyr2k(CXXBLACS_PBLAS_Complex16,double                  ,pzher2k_);
+
+
+
+  #define psymm(F,FUNC)\
+  void FUNC(const char*, const char*, const CB_INT*, const CB_INT*,\
+    const F*, const F*, const CB_INT*, const CB_INT*, const CB_INT*,\
+    const F*, const CB_INT*, const CB_INT*, const CB_INT*, const F*, F*,\
+    const CB_INT*, const CB_INT*, const CB_INT*);
+
+  psymm(float                   ,pssymm_);
+  psymm(double                  ,pdsymm_);
+  psymm(CXXBLACS_PBLAS_Complex8 ,pcsymm_);
+  psymm(CXXBLACS_PBLAS_Complex16,pzsymm_);
+
+  psymm(CXXBLACS_PBLAS_Complex8 ,pchemm_);
+  psymm(CXXBLACS_PBLAS_Complex16,pzhemm_);
+
+
+
+
+  // PBLAS Level 2
+
+  #define pgemv(F,FUNC)\
+  void FUNC(const char*, const CB_INT*, const CB_INT*, const F*, const F*,\
+    const CB_INT*, const CB_INT*, const CB_INT*, const F*, const CB_INT*,\
+    const CB_INT*, const CB_INT*, const CB_INT*, const F*, F*,\
+    const CB_INT*, const CB_INT*, const CB_INT*, const CB_INT*);
+
+  pgemv(float                   ,psgemv_);
+  pgemv(double                  ,pdgemv_);
+  pgemv(CXXBLACS_PBLAS_Complex8 ,pcgemv_);
+  pgemv(CXXBLACS_PBLAS_Complex16,pzgemv_);
+
+
+
+  #define psymv(F,FUNC)\
+  void FUNC(const char*, const CB_INT*, const F*, const F*, const CB_INT*,\
+    const CB_INT*, const CB_INT*, const F*, const CB_INT*, const CB_INT*,\
+    const CB_INT*, const CB_INT*, const F*, F*, const CB_INT*,\
+    const CB_INT*, const CB_INT*, const CB_INT*);
+
+  psymv(float                   ,pssymv_);
+  psymv(double                  ,pdsymv_);
+  psymv(CXXBLACS_PBLAS_Complex8 ,pchemv_);
+  psymv(CXXBLACS_PBLAS_Complex16,pzhemv_);
+
+
+
+  #define pger(F,FUNC)\
+  void FUNC(const CB_INT*, const CB_INT*, const F*, const F*, const CB_INT*,\
+    const CB_INT*, const CB_INT*, const CB_INT*, const F*, const CB_INT*,\
+    const CB_INT*, const CB_INT*, const CB_INT*, F*, const CB_INT*,\
+    const CB_INT*, const CB_INT*);
+
+  pger(float                   ,psger_);
+  pger(double                  ,pdger_);
+  pger(CXXBLACS_PBLAS_Complex8 ,pcgeru_);
+  pger(CXXBLACS_PBLAS_Complex16,pzgeru_);
+  pger(CXXBLACS_PBLAS_Complex8 ,pcgerc_);
+  pger(CXXBLACS_PBLAS_Complex16,pzgerc_);
+
+
+
+  // PBLAS Level 1
+
+  #define pdot(F,FUNC)\
+  void FUNC(const CB_INT*, F*, const F*, const CB_INT*, const CB_INT*,\
+    const CB_INT*, const CB_INT*, const F*, const CB_INT*, const CB_INT*,\
+    const CB_INT*, const CB_INT*);
+
+  pdot(float                   ,psdot_);
+  pdot(double                  ,pddot_);
+  pdot(CXXBLACS_PBLAS_Complex8 ,pcdotu_);
+  pdot(CXXBLACS_PBLAS_Complex16,pzdotu_);
+  pdot(CXXBLACS_PBLAS_Complex8 ,pcdotc_);
+  pdot(CXXBLACS_PBLAS_Complex16,pzdotc_);
+
+
+
+  #define pnrm2(F,RF,FUNC)\
+  void FUNC(const CB_INT*, RF*, const F*, const CB_INT*, const CB_INT*,\
+    const CB_INT*, const CB_INT*);
+
+  pnrm2(float                   ,float ,psnrm2_);
+  pnrm2(double                  ,double,pdnrm2_);
+  pnrm2(CXXBLACS_PBLAS_Complex8 ,float ,pscnrm2_);
+  pnrm2(CXXBLACS_PBLAS_Complex16,double,pdznrm2_);
+
+
+
+  #define paxpy(F,FUNC)\
+  void FUNC(const CB_INT*, const F*, const F*, const CB_INT*, const CB_INT*,\
+    const CB_INT*, const CB_INT*, F*, const CB_INT*, const CB_INT*,\
+    const CB_INT*, const CB_INT*);
+
+  paxpy(float                   ,psaxpy_);
+  paxpy(double                  ,pdaxpy_);
+  paxpy(CXXBLACS_PBLAS_Complex8 ,pcaxpy_);
+  paxpy(CXXBLACS_PBLAS_Complex16,pzaxpy_);
+
+
+
+  #define pscal(F,FUNC)\
+  void FUNC(const CB_INT*, const F*, F*, const CB_INT*, const CB_INT*,\
+    const CB_INT*, const CB_INT*);
+
+  pscal(float                   ,psscal_);
+  pscal(double                  ,pdscal_);
+  pscal(CXXBLACS_PBLAS_Complex8 ,pcscal_);
+  pscal(CXXBLACS_PBLAS_Complex16,pzscal_);
+
 }
 
 
@@ -177,6 +433,35 @@ extern "C" {
   plascl(CXXBLACS_SCALAPACK_Complex8 ,float ,pclascl_);
   plascl(CXXBLACS_SCALAPACK_Complex16,double,pzlascl_);
 
+  #define plaset(F,FUNC)\
+  void FUNC(const char*, const CB_INT*, const CB_INT*, const F*, const F*,\
+    F*, const CB_INT*, const CB_INT*, const CB_INT*);
+
+  plaset(float                       ,pslaset_);
+  plaset(double                      ,pdlaset_);
+  plaset(CXXBLACS_SCALAPACK_Complex8 ,pclaset_);
+  plaset(CXXBLACS_SCALAPACK_Complex16,pzlaset_);
+
+  #define placpy(F,FUNC)\
+  void FUNC(const char*, const CB_INT*, const CB_INT*, const F*,\
+    const CB_INT*, const CB_INT*, const CB_INT*, F*, const CB_INT*,\
+    const CB_INT*, const CB_INT*);
+
+  placpy(float                       ,pslacpy_);
+  placpy(double                      ,pdlacpy_);
+  placpy(CXXBLACS_SCALAPACK_Complex8 ,pclacpy_);
+  placpy(CXXBLACS_SCALAPACK_Complex16,pzlacpy_);
+
+  #define plapiv(F,FUNC)\
+  void FUNC(const char*, const char*, const char*, const CB_INT*,\
+    const CB_INT*, F*, const CB_INT*, const CB_INT*, const CB_INT*,\
+    CB_INT*, const CB_INT*, const CB_INT*, const CB_INT*, CB_INT*);
+
+  plapiv(float                       ,pslapiv_);
+  plapiv(double                      ,pdlapiv_);
+  plapiv(CXXBLACS_SCALAPACK_Complex8 ,pclapiv_);
+  plapiv(CXXBLACS_SCALAPACK_Complex16,pzlapiv_);
+
   #define psyev(F,FUNC)\
   void FUNC(const char*, const char*, const CB_INT*, F*, const CB_INT*, \
     const CB_INT*, const CB_INT*, F*, F*, const CB_INT*, const CB_INT*,\
@@ -233,6 +518,141 @@ extern "C" {
   ppotrf(CXXBLACS_SCALAPACK_Complex8 ,pcpotrf_);
   ppotrf(CXXBLACS_SCALAPACK_Complex16,pzpotrf_);
 
+  #define ppotrs(F,FUNC)\
+  void FUNC(const char*, const CB_INT*, const CB_INT*, const F*,\
+    const CB_INT*, const CB_INT*, const CB_INT*, F*, const CB_INT*,\
+    const CB_INT*, const CB_INT*, CB_INT*);
+
+  ppotrs(float                       ,pspotrs_);
+  ppotrs(double                      ,pdpotrs_);
+  ppotrs(CXXBLACS_SCALAPACK_Complex8 ,pcpotrs_);
+  ppotrs(CXXBLACS_SCALAPACK_Complex16,pzpotrs_);
+
+  #define pgetrf(F,FUNC)\
+  void FUNC(const CB_INT*, const CB_INT*, F*, const CB_INT*, const CB_INT*,\
+    const CB_INT*, CB_INT*, CB_INT*);
+
+  pgetrf(float                       ,psgetrf_);
+  pgetrf(double                      ,pdgetrf_);
+  pgetrf(CXXBLACS_SCALAPACK_Complex8 ,pcgetrf_);
+  pgetrf(CXXBLACS_SCALAPACK_Complex16,pzgetrf_);
+
+  #define pgetrs(F,FUNC)\
+  void FUNC(const char*, const CB_INT*, const CB_INT*, const F*,\
+    const CB_INT*, const CB_INT*, const CB_INT*, const CB_INT*, F*,\
+    const CB_INT*, const CB_INT*, const CB_INT*, CB_INT*);
+
+  pgetrs(float                       ,psgetrs_);
+  pgetrs(double                      ,pdgetrs_);
+  pgetrs(CXXBLACS_SCALAPACK_Complex8 ,pcgetrs_);
+  pgetrs(CXXBLACS_SCALAPACK_Complex16,pzgetrs_);
+
+
+
+
+  #define pgeqrf(F,FUNC)\
+  void FUNC(const CB_INT*, const CB_INT*, F*, const CB_INT*, const CB_INT*,\
+    const CB_INT*, F*, F*, const CB_INT*, CB_INT*);
+
+  pgeqrf(float                       ,psgeqrf_);
+  pgeqrf(double                      ,pdgeqrf_);
+  pgeqrf(CXXBLACS_SCALAPACK_Complex8 ,pcgeqrf_);
+  pgeqrf(CXXBLACS_SCALAPACK_Complex16,pzgeqrf_);
+
+  #define punmqr(F,FUNC)\
+  void FUNC(const char*, const char*, const CB_INT*, const CB_INT*,\
+    const CB_INT*, const F*, const CB_INT*, const CB_INT*, const CB_INT*,\
+    const F*, F*, const CB_INT*, const CB_INT*, const CB_INT*, F*,\
+    const CB_INT*, CB_INT*);
+
+  punmqr(float                       ,psormqr_);
+  punmqr(double                      ,pdormqr_);
+  punmqr(CXXBLACS_SCALAPACK_Complex8 ,pcunmqr_);
+  punmqr(CXXBLACS_SCALAPACK_Complex16,pzunmqr_);
+
+  #define pungqr(F,FUNC)\
+  void FUNC(const CB_INT*, const CB_INT*, const CB_INT*, F*, const CB_INT*,\
+    const CB_INT*, const CB_INT*, const F*, F*, const CB_INT*, CB_INT*);
+
+  pungqr(float                       ,psorgqr_);
+  pungqr(double                      ,pdorgqr_);
+  pungqr(CXXBLACS_SCALAPACK_Complex8 ,pcungqr_);
+  pungqr(CXXBLACS_SCALAPACK_Complex16,pzungqr_);
+
+
+
+
+  #define pstedc(F,FUNC)\
+  void FUNC(const char*, const CB_INT*, F*, F*, F*, const CB_INT*,\
+    const CB_INT*, const CB_INT*, F*, const CB_INT*, CB_INT*, const CB_INT*,\
+    CB_INT*);
+
+  pstedc(float ,psstedc_);
+  pstedc(double,pdstedc_);
+
+
+
+  #define ptrtri(F,FUNC)\
+  void FUNC(const char*, const char*, const CB_INT*, F*, const CB_INT*,\
+    const CB_INT*, const CB_INT*, CB_INT*);
+
+  ptrtri(float                       ,pstrtri_);
+  ptrtri(double                      ,pdtrtri_);
+  ptrtri(CXXBLACS_SCALAPACK_Complex8 ,pctrtri_);
+  ptrtri(CXXBLACS_SCALAPACK_Complex16,pztrtri_);
+
+
+
+  #define plange(F,RF,FUNC)\
+  RF FUNC(const char*, const CB_INT*, const CB_INT*, const F*,\
+    const CB_INT*, const CB_INT*, const CB_INT*, RF*);
+
+  plange(float                       ,float ,pslange_);
+  plange(double                      ,double,pdlange_);
+  plange(CXXBLACS_SCALAPACK_Complex8 ,float ,pclange_);
+  plange(CXXBLACS_SCALAPACK_Complex16,double,pzlange_);
+
+  #define plansy(F,RF,FUNC)\
+  RF FUNC(const char*, const char*, const CB_INT*, const F*, const CB_INT*,\
+    const CB_INT*, const CB_INT*, RF*);
+
+  plansy(float                       ,float ,pslansy_);
+  plansy(double                      ,double,pdlansy_);
+  plansy(CXXBLACS_SCALAPACK_Complex8 ,float ,pclansy_);
+  plansy(CXXBLACS_SCALAPACK_Complex16,double,pzlansy_);
+  plansy(CXXBLACS_SCALAPACK_Complex8 ,float ,pclanhe_);
+  plansy(CXXBLACS_SCALAPACK_Complex16,double,pzlanhe_);
+
+  #define plantr(F,RF,FUNC)\
+  RF FUNC(const char*, const char*, const char*, const CB_INT*,\
+    const CB_INT*, const F*, const CB_INT*, const CB_INT*, const CB_INT*,\
+    RF*);
+
+  plantr(float                       ,float ,pslantr_);
+  plantr(double                      ,double,pdlantr_);
+  plantr(CXXBLACS_SCALAPACK_Complex8 ,float ,pclantr_);
+  plantr(CXXBLACS_SCALAPACK_Complex16,double,pzlantr_);
+
+
+
+  #define pgesvd(F,FUNC)\
+  void FUNC(const char*, const char*, const CB_INT*, const CB_INT*, F*,\
+    const CB_INT*, const CB_INT*, const CB_INT*, F*, F*, const CB_INT*,\
+    const CB_INT*, const CB_INT*, F*, const CB_INT*, const CB_INT*,\
+    const CB_INT*, F*, const CB_INT*, CB_INT*);
+
+  #define pcgesvd(F,RF,FUNC)\
+  void FUNC(const char*, const char*, const CB_INT*, const CB_INT*, F*,\
+    const CB_INT*, const CB_INT*, const CB_INT*, RF*, F*, const CB_INT*,\
+    const CB_INT*, const CB_INT*, F*, const CB_INT*, const CB_INT*,\
+    const CB_INT*, F*, const CB_INT*, RF*, CB_INT*);
+
+  pgesvd(float ,psgesvd_);
+  pgesvd(double,pdgesvd_);
+
+  pcgesvd(CXXBLACS_SCALAPACK_Complex8 ,float ,pcgesvd_);
+  pcgesvd(CXXBLACS_SCALAPACK_Complex16,double,pzgesvd_);
+
 
 
 }
@@ -258,6 +678,99 @@ extern "C" {
   lacpy(CXXBLACS_LAPACK_Complex8 ,clacpy_);
   lacpy(CXXBLACS_LAPACK_Complex16,zlacpy_);
 
+  #define sterf(F,FUNC)\
+  void FUNC(const CB_INT*, F*, F*, CB_INT*);
+
+  sterf(float ,ssterf_);
+  sterf(double,dsterf_);
+
+  #define geqrf(F,FUNC)\
+  void FUNC(const CB_INT*, const CB_INT*, F*, const CB_INT*, F*, F*,\
+    const CB_INT*, CB_INT*);
+
+  geqrf(float                    ,sgeqrf_);
+  geqrf(double                   ,dgeqrf_);
+  geqrf(CXXBLACS_LAPACK_Complex8 ,cgeqrf_);
+  geqrf(CXXBLACS_LAPACK_Complex16,zgeqrf_);
+
+  #define ungqr(F,FUNC)\
+  void FUNC(const CB_INT*, const CB_INT*, const CB_INT*, F*, const CB_INT*,\
+    const F*, F*, const CB_INT*, CB_INT*);
+
+  ungqr(float                    ,sorgqr_);
+  ungqr(double                   ,dorgqr_);
+  ungqr(CXXBLACS_LAPACK_Complex8 ,cungqr_);
+  ungqr(CXXBLACS_LAPACK_Complex16,zungqr_);
+
+  #define syevd(F,FUNC)\
+  void FUNC(const char*, const char*, const CB_INT*, F*, const CB_INT*, F*,\
+    F*, const CB_INT*, CB_INT*, const CB_INT*, CB_INT*);
+
+  #define heevd(F,RF,FUNC)\
+  void FUNC(const char*, const char*, const CB_INT*, F*, const CB_INT*, RF*,\
+    F*, const CB_INT*, RF*, const CB_INT*, CB_INT*, const CB_INT*, CB_INT*);
+
+  syevd(float ,ssyevd_);
+  syevd(double,dsyevd_);
+  heevd(CXXBLACS_LAPACK_Complex8 ,float ,cheevd_);
+  heevd(CXXBLACS_LAPACK_Complex16,double,zheevd_);
+
+  #define syev(F,FUNC)\
+  void FUNC(const char*, const char*, const CB_INT*, F*, const CB_INT*, F*,\
+    F*, const CB_INT*, CB_INT*);
+
+  #define heev(F,RF,FUNC)\
+  void FUNC(const char*, const char*, const CB_INT*, F*, const CB_INT*, RF*,\
+    F*, const CB_INT*, RF*, CB_INT*);
+
+  syev(float ,ssyev_);
+  syev(double,dsyev_);
+  heev(CXXBLACS_LAPACK_Complex8 ,float ,cheev_);
+  heev(CXXBLACS_LAPACK_Complex16,double,zheev_);
+
+  #define gesv(F,FUNC)\
+  void FUNC(const CB_INT*, const CB_INT*, F*, const CB_INT*, CB_INT*, F*,\
+    const CB_INT*, CB_INT*);
+
+  gesv(float                    ,sgesv_);
+  gesv(double                   ,dgesv_);
+  gesv(CXXBLACS_LAPACK_Complex8 ,cgesv_);
+  gesv(CXXBLACS_LAPACK_Complex16,zgesv_);
+
+  #define getrf(F,FUNC)\
+  void FUNC(const CB_INT*, const CB_INT*, F*, const CB_INT*, CB_INT*, CB_INT*);
+
+  getrf(float                    ,sgetrf_);
+  getrf(double                   ,dgetrf_);
+  getrf(CXXBLACS_LAPACK_Complex8 ,cgetrf_);
+  getrf(CXXBLACS_LAPACK_Complex16,zgetrf_);
+
+  #define getrs(F,FUNC)\
+  void FUNC(const char*, const CB_INT*, const CB_INT*, const F*,\
+    const CB_INT*, const CB_INT*, F*, const CB_INT*, CB_INT*);
+
+  getrs(float                    ,sgetrs_);
+  getrs(double                   ,dgetrs_);
+  getrs(CXXBLACS_LAPACK_Complex8 ,cgetrs_);
+  getrs(CXXBLACS_LAPACK_Complex16,zgetrs_);
+
+  #define potrf(F,FUNC)\
+  void FUNC(const char*, const CB_INT*, F*, const CB_INT*, CB_INT*);
+
+  potrf(float                    ,spotrf_);
+  potrf(double                   ,dpotrf_);
+  potrf(CXXBLACS_LAPACK_Complex8 ,cpotrf_);
+  potrf(CXXBLACS_LAPACK_Complex16,zpotrf_);
+
+  #define potrs(F,FUNC)\
+  void FUNC(const char*, const CB_INT*, const CB_INT*, const F*,\
+    const CB_INT*, F*, const CB_INT*, CB_INT*);
+
+  potrs(float                    ,spotrs_);
+  potrs(double                   ,dpotrs_);
+  potrs(CXXBLACS_LAPACK_Complex8 ,cpotrs_);
+  potrs(CXXBLACS_LAPACK_Complex16,zpotrs_);
+
 }
 
 #endif
@@ -287,6 +800,16 @@ extern "C" {
   trmm(CXXBLACS_BLAS_Complex8 ,ctrmm_);
   trmm(CXXBLACS_BLAS_Complex16,ztrmm_);
 
+  #define trsm(F,FUNC)\
+  void FUNC(const char*, const char*, const char*, const char*,\
+    const CB_INT*, const CB_INT*, const F*, const F*, const CB_INT*,\
+    F*, const CB_INT*);
+      
+  trsm(float                  ,strsm_);
+  trsm(double                 ,dtrsm_);
+  trsm(CXXBLACS_BLAS_Complex8 ,ctrsm_);
+  trsm(CXXBLACS_BLAS_Complex16,ztrsm_);
+
 }
 
 #endif
@@ -21,10 +21,46 @@
 
 #include <cxxblacs/config.hpp>
 #include <cxxblacs/proto.hpp>
+#include <cxxblacs/misc.hpp>
+#include <cxxblacs/lapack.hpp>
 #include <vector>
+#include <type_traits>
+#include <algorithm>
 
 namespace CXXBLACS {
 
+  /**
+   * \brief Whether DESC describes a matrix on a single process (1 x 1 grid)
+   *
+   * The P* wrappers for GEMM, TRSM, GESV, GETRF, POTRF and the Hermitian 
+   * eigensolvers dispatch to the serial BLAS / LAPACK routine on such 
+   * grids, where the local buffer holds the entire matrix. Define
+   * CXXBLACS_DISABLE_SERIAL_DISPATCH to always call ScaLAPACK / PBLAS.
+   */
+  inline bool SingleProcessDesc(const CB_INT *DESC) {
+
+#ifdef CXXBLACS_DISABLE_SERIAL_DISPATCH
+    return false;
+#else
+    CB_INT NPROW, NPCOL, MYROW, MYCOL;
+    Cblacs_gridinfo(DESC[1],&NPROW,&NPCOL,&MYROW,&MYCOL);
+    return NPROW == 1 and NPCOL == 1;
+#endif
+
+  }
+
+  /**
+   * \brief Pointer to A(IA,JA) for a matrix on a single process
+   */
+  template <typename Field>
+  inline Field* LocalSubmatrix(Field *A, const CB_INT IA, const CB_INT JA,
+    const CB_INT *DESCA) {
+
+    return A + (IA-1) + (JA-1)*DESCA[8];
+
+  }
+
+
 
   template <typename Field, typename RF>
   inline CB_INT PLASCL(const char TYPE, const RF CTO, const RF CFROM,
@@ -60,6 +96,157 @@ namespace CXXBLACS {
 
 
 
+
+  template <typename Field>
+  inline void PLASET(const char UPLO, const CB_INT M, const CB_INT N,
+    const Field ALPHA, const Field BETA, Field *A, const CB_INT IA, 
+    const CB_INT JA, const CB_INT *DESCA);
+
+  #define PLASET_IMPL(F,FUNC)\
+  template <>\
+  inline void PLASET(const char UPLO, const CB_INT M, const CB_INT N,\
+    const F ALPHA, const F BETA, F *A, const CB_INT IA, const CB_INT JA,\
+    const CB_INT *DESCA) {\
+    FUNC(&UPLO,&M,&N,ToScalapackType(cc(&ALPHA)),ToScalapackType(cc(&BETA)),\
+      ToScalapackType(A),&IA,&JA,DESCA);\
+  }
+
+  PLASET_IMPL(float               ,pslaset_);
+  PLASET_IMPL(double              ,pdlaset_);
+  PLASET_IMPL(std::complex<float> ,pclaset_);
+  PLASET_IMPL(std::complex<double>,pzlaset_);
+
+  template <typename Field>
+  inline void PLASET(const char UPLO, const CB_INT M, const CB_INT N,
+    const Field ALPHA, const Field BETA, Field *A, const CB_INT IA, 
+    const CB_INT JA, const ScaLAPACK_Desc_t DESCA) {
+
+    PLASET(UPLO,M,N,ALPHA,BETA,A,IA,JA,&DESCA[0]);
+
+  }
+
+
+
+
+  template <typename Field>
+  inline void PLACPY(const char UPLO, const CB_INT M, const CB_INT N,
+    const Field *A, const CB_INT IA, const CB_INT JA, const CB_INT *DESCA,
+    Field *B, const CB_INT IB, const CB_INT JB, const CB_INT *DESCB);
+
+  #define PLACPY_IMPL(F,FUNC)\
+  template <>\
+  inline void PLACPY(const char UPLO, const CB_INT M, const CB_INT N,\
+    const F *A, const CB_INT IA, const CB_INT JA, const CB_INT *DESCA,\
+    F *B, const CB_INT IB, const CB_INT JB, const CB_INT *DESCB) {\
+    FUNC(&UPLO,&M,&N,ToScalapackType(A),&IA,&JA,DESCA,ToScalapackType(B),\
+      &IB,&JB,DESCB);\
+  }
+
+  PLACPY_IMPL(float               ,pslacpy_);
+  PLACPY_IMPL(double              ,pdlacpy_);
+  PLACPY_IMPL(std::complex<float> ,pclacpy_);
+  PLACPY_IMPL(std::complex<double>,pzlacpy_);
+
+  template <typename Field>
+  inline void PLACPY(const char UPLO, const CB_INT M, const CB_INT N,
+    const Field *A, const CB_INT IA, const CB_INT JA, 
+    const ScaLAPACK_Desc_t DESCA, Field *B, const CB_INT IB, 
+    const CB_INT JB, const ScaLAPACK_Desc_t DESCB) {
+
+    PLACPY(UPLO,M,N,A,IA,JA,&DESCA[0],B,IB,JB,&DESCB[0]);
+
+  }
+
+
+
+
+  /**
+   *  \brief Apply a sequence of row (ROWCOL = 'R') or column 
+   *  (ROWCOL = 'C') interchanges to a distributed matrix.
+   *
+   *  See ScaLAPACK documentation of P?LAPIV for the layout of IPIV
+   *  (described by DESCIP) and the size of IWORK.
+   */
+  template <typename Field>
+  inline void PLAPIV(const char DIREC, const char ROWCOL, const char PIVROC,
+    const CB_INT M, const CB_INT N, Field *A, const CB_INT IA, 
+    const CB_INT JA, const CB_INT *DESCA, CB_INT *IPIV, const CB_INT IP,
+    const CB_INT JP, const CB_INT *DESCIP, CB_INT *IWORK);
+
+  #define PLAPIV_IMPL(F,FUNC)\
+  template <>\
+  inline void PLAPIV(const char DIREC, const char ROWCOL, const char PIVROC,\
+    const CB_INT M, const CB_INT N, F *A, const CB_INT IA, const CB_INT JA,\
+    const CB_INT *DESCA, CB_INT *IPIV, const CB_INT IP, const CB_INT JP,\
+    const CB_INT *DESCIP, CB_INT *IWORK) {\
+    FUNC(&DIREC,&ROWCOL,&PIVROC,&M,&N,ToScalapackType(A),&IA,&JA,DESCA,\
+      IPIV,&IP,&JP,DESCIP,IWORK);\
+  }
+
+  PLAPIV_IMPL(float               ,pslapiv_);
+  PLAPIV_IMPL(double              ,pdlapiv_);
+  PLAPIV_IMPL(std::complex<float> ,pclapiv_);
+  PLAPIV_IMPL(std::complex<double>,pzlapiv_);
+
+  /**
+   *  \brief Apply interchanges to A(IA:IA+M-1,JA:JA+N-1) using a pivot
+   *  vector in the layout produced by PGETRF.
+   *
+   *  For ROWCOL = 'R', IPIV holds LOCr(M_A) + MB_A entries (global row
+   *  indices) and is replicated across process columns. For ROWCOL = 'C',
+   *  IPIV holds LOCc(N_A) + NB_A entries (global column indices) and is 
+   *  replicated across process rows. The trailing block of IPIV is used
+   *  as workspace by ScaLAPACK.
+   */
+  template <typename Field>
+  inline void PLAPIV(const char DIREC, const char ROWCOL, const CB_INT M,
+    const CB_INT N, Field *A, const CB_INT IA, const CB_INT JA, 
+    const CB_INT *DESCA, CB_INT *IPIV) {
+
+    CB_INT NPROW, NPCOL, MYROW, MYCOL;
+    Cblacs_gridinfo(DESCA[1],&NPROW,&NPCOL,&MYROW,&MYCOL);
+
+    const bool ROW = ROWCOL == 'R' or ROWCOL == 'r';
+
+    const CB_INT MpA = NumRoc(DESCA[2],DESCA[4],MYROW,DESCA[6],NPROW);
+
+    ScaLAPACK_Desc_t DESCIP = ROW ?
+      DescInit(DESCA[2] + DESCA[4]*NPROW,1,DESCA[4],1,DESCA[6],MYCOL,
+        DESCA[1],MpA + DESCA[4]) :
+      DescInit(1,DESCA[3] + DESCA[5]*NPCOL,1,DESCA[5],MYROW,DESCA[7],
+        DESCA[1],1);
+
+    // IWORK is not referenced when IPIV need not be transposed
+    CB_INT IDUM;
+
+    if( ROW )
+      PLAPIV(DIREC,'R','C',M,N,A,IA,JA,DESCA,IPIV,IA,1,&DESCIP[0],&IDUM);
+    else
+      PLAPIV(DIREC,'C','R',M,N,A,IA,JA,DESCA,IPIV,1,JA,&DESCIP[0],&IDUM);
+
+  }
+
+  template <typename Field, typename... Args>
+  inline void PLAPIV(const char DIREC, const char ROWCOL, 
+    const char PIVROC, const CB_INT M, const CB_INT N, Field *A, 
+    const CB_INT IA, const CB_INT JA, const ScaLAPACK_Desc_t DESCA, 
+    Args... args) {
+
+    PLAPIV(DIREC,ROWCOL,PIVROC,M,N,A,IA,JA,&DESCA[0],args...);
+
+  }
+
+  template <typename Field>
+  inline void PLAPIV(const char DIREC, const char ROWCOL, const CB_INT M,
+    const CB_INT N, Field *A, const CB_INT IA, const CB_INT JA, 
+    const ScaLAPACK_Desc_t DESCA, CB_INT *IPIV) {
+
+    PLAPIV(DIREC,ROWCOL,M,N,A,IA,JA,&DESCA[0],IPIV);
+
+  }
+
+
+
   template <typename Field>
   inline void PGEMM(const char TRANSA, const char TRANSB, const CB_INT M,
     const CB_INT N, const CB_INT K, const Field ALPHA, const Field* A,
@@ -77,6 +264,13 @@ namespace CXXBLACS {
     const CB_INT* DESCB, const F BETA, F* C,\
     const CB_INT IC, const CB_INT JC, const CB_INT* DESCC){\
     \
+    if( SingleProcessDesc(DESCA) ) {\
+      GEMM(TRANSA,TRANSB,M,N,K,ALPHA,LocalSubmatrix(A,IA,JA,DESCA),DESCA[8],\
+        LocalSubmatrix(B,IB,JB,DESCB),DESCB[8],BETA,\
+        LocalSubmatrix(C,IC,JC,DESCC),DESCC[8]);\
+      return;\
+    }\
+    \
     FUNC(&TRANSA,&TRANSB,&M,&N,&K,ToPblasType(&ALPHA),ToPblasType(A),&IA,&JA,\
       DESCA,ToPblasType(B),&IB,&JB,DESCB,ToPblasType(&BETA),ToPblasType(C),\
       &IC,&JC,DESCC);\
@@ -142,391 +336,1990 @@ namespace CXXBLACS {
 
 
 
+  template <typename Field>
+  inline void PTRSM(const char SIDE, const char UPLO, const char TRANSA,
+    const char DIAG, const CB_INT M, const CB_INT N, const Field ALPHA,
+    const Field *A, const CB_INT IA, const CB_INT JA, const CB_INT *DESCA,
+    Field *B, const CB_INT IB, const CB_INT JB, const CB_INT *DESCB);
+
+
+  #define PTRSM_IMPL(F,FUNC)\
+  template <>\
+  inline void PTRSM(const char SIDE, const char UPLO, const char TRANSA,\
+    const char DIAG, const CB_INT M, const CB_INT N, const F ALPHA,\
+    const F *A, const CB_INT IA, const CB_INT JA, const CB_INT *DESCA,\
+    F *B, const CB_INT IB, const CB_INT JB, const CB_INT *DESCB) {\
+    if( SingleProcessDesc(DESCA) ) {\
+      TRSM(SIDE,UPLO,TRANSA,DIAG,M,N,ALPHA,LocalSubmatrix(A,IA,JA,DESCA),\
+        DESCA[8],LocalSubmatrix(B,IB,JB,DESCB),DESCB[8]);\
+      return;\
+    }\
+    FUNC(&SIDE,&UPLO,&TRANSA,&DIAG,&M,&N,ToPblasType(&ALPHA),ToPblasType(A),\
+      &IA,&JA,DESCA,ToPblasType(B),&IB,&JB,DESCB);\
+  }
 
+  PTRSM_IMPL(float               ,pstrsm_);
+  PTRSM_IMPL(double              ,pdtrsm_);
+  PTRSM_IMPL(std::complex<float> ,pctrsm_);
+  PTRSM_IMPL(std::complex<double>,pztrsm_);
 
+  template <typename Field>
+  inline void PTRSM(const char SIDE, const char UPLO, const char TRANSA,
+    const char DIAG, const CB_INT M, const CB_INT N, const Field ALPHA,
+    const Field *A, const CB_INT IA, const CB_INT JA, 
+    const ScaLAPACK_Desc_t DESCA, Field *B, const CB_INT IB, const CB_INT JB, 
+    const ScaLAPACK_Desc_t DESCB) {
 
+    PTRSM(SIDE,UPLO,TRANSA,DIAG,M,N,ALPHA,A,IA,JA,&DESCA[0],B,IB,JB,&DESCB[0]);
 
+  }
 
 
 
 
   template <typename Field>
-  inline void PGEMR2D(const CB_INT M, const CB_INT N, const Field *A,
-    const CB_INT IA, const CB_INT JA, const CB_INT *DESCA, Field *B,
-    const CB_INT IB, const CB_INT JB, const CB_INT *DESCB, const CB_INT ICTXT);
+  inline void PSYRK(const char UPLO, const char TRANS, const CB_INT N,
+    const CB_INT K, const Field ALPHA, const Field *A, const CB_INT IA,
+    const CB_INT JA, const CB_INT *DESCA, const Field BETA, Field *C,
+    const CB_INT IC, const CB_INT JC, const CB_INT *DESCC);
+
+  /**
+   *  \brief Hermitian rank-K update.
+   *
+   *  Wraps P?HERK for complex fields. For real fields P?HERK reduces to
+   *  P?SYRK, and TRANS = 'C' is interpreted as 'T'.
+   */
+  template <typename Field, typename RealField>
+  inline void PHERK(const char UPLO, const char TRANS, const CB_INT N,
+    const CB_INT K, const RealField ALPHA, const Field *A, const CB_INT IA,
+    const CB_INT JA, const CB_INT *DESCA, const RealField BETA, Field *C,
+    const CB_INT IC, const CB_INT JC, const CB_INT *DESCC);
 
-  #define PGEMR2D_IMPL(F,FUNC)\
+  #define PSYRK_IMPL(F,FUNC)\
   template <>\
-  inline void PGEMR2D(const CB_INT M, const CB_INT N, const F *A,\
-    const CB_INT IA, const CB_INT JA, const CB_INT *DESCA, F *B,\
-    const CB_INT IB, const CB_INT JB, const CB_INT *DESCB, const CB_INT ICTXT){\
-    \
-    FUNC(&M,&N,ToScalapackType(A),&IA,&JA,DESCA,ToScalapackType(B),&IB,&JB,\
-      DESCB,&ICTXT);\
+  inline void PSYRK(const char UPLO, const char TRANS, const CB_INT N,\
+    const CB_INT K, const F ALPHA, const F *A, const CB_INT IA,\
+    const CB_INT JA, const CB_INT *DESCA, const F BETA, F *C,\
+    const CB_INT IC, const CB_INT JC, const CB_INT *DESCC) {\
+    FUNC(&UPLO,&TRANS,&N,&K,ToPblasType(&ALPHA),ToPblasType(A),&IA,&JA,\
+      DESCA,ToPblasType(&BETA),ToPblasType(C),&IC,&JC,DESCC);\
   }
 
-  PGEMR2D_IMPL(float                       ,psgemr2d_);
-  PGEMR2D_IMPL(double                      ,pdgemr2d_);
-  PGEMR2D_IMPL(std::complex<float> ,pcgemr2d_);
-  PGEMR2D_IMPL(std::complex<double>,pzgemr2d_);
+  #define PSYRK_HERK_IMPL(F,FUNC)\
+  template <>\
+  inline void PHERK(const char UPLO, const char TRANS, const CB_INT N,\
+    const CB_INT K, const F ALPHA, const F *A, const CB_INT IA,\
+    const CB_INT JA, const CB_INT *DESCA, const F BETA, F *C,\
+    const CB_INT IC, const CB_INT JC, const CB_INT *DESCC) {\
+    const char TRANS_R = ( TRANS == 'C' or TRANS == 'c' ) ? 'T' : TRANS;\
+    FUNC(&UPLO,&TRANS_R,&N,&K,&ALPHA,A,&IA,&JA,DESCA,&BETA,C,&IC,&JC,\
+      DESCC);\
+  }
+
+  #define PHERK_IMPL(F,RF,FUNC)\
+  template <>\
+  inline void PHERK(const char UPLO, const char TRANS, const CB_INT N,\
+    const CB_INT K, const RF ALPHA, const F *A, const CB_INT IA,\
+    const CB_INT JA, const CB_INT *DESCA, const RF BETA, F *C,\
+    const CB_INT IC, const CB_INT JC, const CB_INT *DESCC) {\
+    FUNC(&UPLO,&TRANS,&N,&K,&ALPHA,ToPblasType(A),&IA,&JA,DESCA,&BETA,\
+      ToPblasType(C),&IC,&JC,DESCC);\
+  }
+
+  PSYRK_IMPL(float               ,pssyrk_);
+  PSYRK_IMPL(double              ,pdsyrk_);
+  PSYRK_IMPL(std::complex<float> ,pcsyrk_);
+  PSYRK_IMPL(std::complex<double>,pzsyrk_);
+
+  PSYRK_HERK_IMPL(float ,pssyrk_);
+  PSYRK_HERK_IMPL(double,pdsyrk_);
+  PHERK_IMPL(std::complex<float> ,float ,pcherk_);
+  PHERK_IMPL(std::complex<double>,double,pzherk_);
 
   template <typename Field>
-  inline void PGEMR2D(const CB_INT M, const CB_INT N, const Field *A,
-    const CB_INT IA, const CB_INT JA, const ScaLAPACK_Desc_t DESCA, Field *B,
-    const CB_INT IB, const CB_INT JB, const ScaLAPACK_Desc_t DESCB, 
-    const CB_INT ICTXT) {
+  inline void PSYRK(const char UPLO, const char TRANS, const CB_INT N,
+    const CB_INT K, const Field ALPHA, const Field *A, const CB_INT IA,
+    const CB_INT JA, const ScaLAPACK_Desc_t DESCA, const Field BETA, 
+    Field *C, const CB_INT IC, const CB_INT JC, 
+    const ScaLAPACK_Desc_t DESCC) {
 
-    PGEMR2D(M,N,A,IA,JA,&DESCA[0],B,IB,JB,&DESCB[0],ICTXT);
+    PSYRK(UPLO,TRANS,N,K,ALPHA,A,IA,JA,&DESCA[0],BETA,C,IC,JC,&DESCC[0]);
 
   }
 
+  template <typename Field, typename RealField>
+  inline void PHERK(const char UPLO, const char TRANS, const CB_INT N,
+    const CB_INT K, const RealField ALPHA, const Field *A, const CB_INT IA,
+    const CB_INT JA, const ScaLAPACK_Desc_t DESCA, const RealField BETA, 
+    Field *C, const CB_INT IC, const CB_INT JC, 
+    const ScaLAPACK_Desc_t DESCC) {
 
+    PHERK(UPLO,TRANS,N,K,ALPHA,A,IA,JA,&DESCA[0],BETA,C,IC,JC,&DESCC[0]);
 
+  }
 
-  template <typename Field>
-  inline CB_INT PSYEV(const char JOBZ, const char UPLO, const CB_INT N,
-    Field *A, const CB_INT IA, const CB_INT JA, const CB_INT *DESCA,
-    Field *W, Field *Z, const CB_INT IZ, const CB_INT JZ, const CB_INT *DESCZ,
-    Field *WORK, const CB_INT LWORK);
-
-  template <typename Field>
-  inline CB_INT PSYEVD(const char JOBZ, const char UPLO, const CB_INT N,
-    Field *A, const CB_INT IA, const CB_INT JA, const CB_INT *DESCA,
-    Field *W, Field *Z, const CB_INT IZ, const CB_INT JZ, const CB_INT *DESCZ,
-    Field *WORK, const CB_INT LWORK, CB_INT *IWORK, const CB_INT LIWORK);
 
-  template <typename Field, typename RealField>
-  inline CB_INT PHEEV(const char JOBZ, const char UPLO, const CB_INT N,
-    Field *A, const CB_INT IA, const CB_INT JA, const CB_INT *DESCA,
-    RealField *W, Field *Z, const CB_INT IZ, const CB_INT JZ, 
-    const CB_INT *DESCZ, Field *WORK, const CB_INT LWORK, RealField *RWORK,
-    const CB_INT LRWORK);
 
-  template <typename Field, typename RealField>
-  inline CB_INT PHEEVD(const char JOBZ, const char UPLO, const CB_INT N,
-    Field *A, const CB_INT IA, const CB_INT JA, const CB_INT *DESCA,
-    RealField *W, Field *Z, const CB_INT IZ, const CB_INT JZ, 
-    const CB_INT *DESCZ, Field *WORK, const CB_INT LWORK, RealField *RWORK,
-    const CB_INT LRWORK, CB_INT* IWORK, const CB_INT LIWORK);
 
 
+  template <typename Field>
+  inline void PSYR2K(const char UPLO, const char TRANS, const CB_INT N,
+    const CB_INT K, const Field ALPHA, const Field *A, const CB_INT IA,
+    const CB_INT JA, const CB_INT *DESCA, const Field *B, const CB_INT IB,
+    const CB_INT JB, const CB_INT *DESCB, const Field BETA, Field *C,
+    const CB_INT IC, const CB_INT JC, const CB_INT *DESCC);
+
+  /**
+   *  \brief Hermitian rank-2K update.
+   *
+   *  Wraps P?HER2K for complex fields. For real fields P?HER2K reduces to
+   *  P?SYR2K, and TRANS = 'C' is interpreted as 'T'.
+   */
+  template <typename Field, typename RealField>
+  inline void PHER2K(const char UPLO, const char TRANS, const CB_INT N,
+    const CB_INT K, const Field ALPHA, const Field *A, const CB_INT IA,
+    const CB_INT JA, const CB_INT *DESCA, const Field *B, const CB_INT IB,
+    const CB_INT JB, const CB_INT *DESCB, const RealField BETA, Field *C,
+    const CB_INT IC, const CB_INT JC, const CB_INT *DESCC);
 
-  #define PSYEV_IMPL(F,FUNC)\
+  #define PSYR2K_IMPL(F,FUNC)\
   template <>\
-  inline CB_INT PSYEV(const char JOBZ, const char UPLO, const CB_INT N,\
-    F *A, const CB_INT IA, const CB_INT JA, const CB_INT *DESCA,\
-    F *W, F *Z, const CB_INT IZ, const CB_INT JZ, const CB_INT *DESCZ,\
-    F *WORK, const CB_INT LWORK) {\
-    \
-    if( DESCA[4] != DESCA[5] ) {\
-      std::runtime_error err("MB must be the same as NB in P?SYEV");\
-      throw err;\
-    }\
-    CB_INT INFO;\
-    FUNC(&JOBZ,&UPLO,&N,A,&IA,&JA,DESCA,W,Z,&IZ,&JZ,DESCZ,WORK,&LWORK,&INFO);\
-    return INFO;\
-    \
+  inline void PSYR2K(const char UPLO, const char TRANS, const CB_INT N,\
+    const CB_INT K, const F ALPHA, const F *A, const CB_INT IA,\
+    const CB_INT JA, const CB_INT *DESCA, const F *B, const CB_INT IB,\
+    const CB_INT JB, const CB_INT *DESCB, const F BETA, F *C,\
+    const CB_INT IC, const CB_INT JC, const CB_INT *DESCC) {\
+    FUNC(&UPLO,&TRANS,&N,&K,ToPblasType(&ALPHA),ToPblasType(A),&IA,&JA,\
+      DESCA,ToPblasType(B),&IB,&JB,DESCB,ToPblasType(&BETA),ToPblasType(C),\
+      &IC,&JC,DESCC);\
   }
 
-  #define PSYEVD_IMPL(F,FUNC)\
+  #define PSYR2K_HER2K_IMPL(F,FUNC)\
   template <>\
-  inline CB_INT PSYEVD(const char JOBZ, const char UPLO, const CB_INT N,\
-    F *A, const CB_INT IA, const CB_INT JA, const CB_INT *DESCA,\
-    F *W, F *Z, const CB_INT IZ, const CB_INT JZ, const CB_INT *DESCZ,\
-    F *WORK, const CB_INT LWORK, CB_INT* IWORK, const CB_INT LIWORK) {\
-    \
-    if( DESCA[4] != DESCA[5] ) {\
-      std::runtime_error err("MB must be the same as NB in P?SYEV");\
-      throw err;\
-    }\
-    CB_INT INFO;\
-    FUNC(&JOBZ,&UPLO,&N,A,&IA,&JA,DESCA,W,Z,&IZ,&JZ,DESCZ,WORK,&LWORK,\
-      IWORK,&LIWORK,&INFO);\
-    return INFO;\
-    \
+  inline void PHER2K(const char UPLO, const char TRANS, const CB_INT N,\
+    const CB_INT K, const F ALPHA, const F *A, const CB_INT IA,\
+    const CB_INT JA, const CB_INT *DESCA, const F *B, const CB_INT IB,\
+    const CB_INT JB, const CB_INT *DESCB, const F BETA, F *C,\
+    const CB_INT IC, const CB_INT JC, const CB_INT *DESCC) {\
+    const char TRANS_R = ( TRANS == 'C' or TRANS == 'c' ) ? 'T' : TRANS;\
+    FUNC(&UPLO,&TRANS_R,&N,&K,&ALPHA,A,&IA,&JA,DESCA,B,&IB,&JB,DESCB,\
+      &BETA,C,&IC,&JC,DESCC);\
   }
 
-  #define PHEEV_IMPL(F,RF,FUNC)\
+  #define PHER2K_IMPL(F,RF,FUNC)\
   template <>\
-  inline CB_INT PHEEV(const char JOBZ, const char UPLO, const CB_INT N,\
-    F *A, const CB_INT IA, const CB_INT JA, const CB_INT *DESCA,\
-    RF *W, F *Z, const CB_INT IZ, const CB_INT JZ, const CB_INT *DESCZ,\
-    F *WORK, const CB_INT LWORK, RF* RWORK, const CB_INT LRWORK) {\
-    \
-    if( DESCA[4] != DESCA[5] ) {\
-      std::runtime_error err("MB must be the same as NB in P?HEEV");\
-      throw err;\
-    }\
-    CB_INT INFO;\
-    FUNC(&JOBZ,&UPLO,&N,ToScalapackType(A),&IA,&JA,DESCA,W,ToScalapackType(Z),\
-      &IZ,&JZ,DESCZ,ToScalapackType(WORK),&LWORK,RWORK,&LRWORK,&INFO);\
-    return INFO;\
-    \
+  inline void PHER2K(const char UPLO, const char TRANS, const CB_INT N,\
+    const CB_INT K, const F ALPHA, const F *A, const CB_INT IA,\
+    const CB_INT JA, const CB_INT *DESCA, const F *B, const CB_INT IB,\
+    const CB_INT JB, const CB_INT *DESCB, const RF BETA, F *C,\
+    const CB_INT IC, const CB_INT JC, const CB_INT *DESCC) {\
+    FUNC(&UPLO,&TRANS,&N,&K,ToPblasType(&ALPHA),ToPblasType(A),&IA,&JA,\
+      DESCA,ToPblasType(B),&IB,&JB,DESCB,&BETA,ToPblasType(C),&IC,&JC,\
+      DESCC);\
   }
 
-  #define PHEEVD_IMPL(F,RF,FUNC)\
-  template <>\
-  inline CB_INT PHEEVD(const char JOBZ, const char UPLO, const CB_INT N,\
-    F *A, const CB_INT IA, const CB_INT JA, const CB_INT *DESCA,\
-    RF *W, F *Z, const CB_INT IZ, const CB_INT JZ, const CB_INT *DESCZ,\
-    F *WORK, const CB_INT LWORK, RF* RWORK, const CB_INT LRWORK,\
-    CB_INT *IWORK, const CB_INT LIWORK) {\
-    \
-    if( DESCA[4] != DESCA[5] ) {\
-      std::runtime_error err("MB must be the same as NB in P?HEEV");\
-      throw err;\
-    }\
-    CB_INT INFO;\
-    FUNC(&JOBZ,&UPLO,&N,ToScalapackType(A),&IA,&JA,DESCA,W,ToScalapackType(Z),\
-      &IZ,&JZ,DESCZ,ToScalapackType(WORK),&LWORK,RWORK,&LRWORK,IWORK,&LIWORK,\
-      &INFO);\
-    return INFO;\
-    \
-  }
+  PSYR2K_IMPL(float               ,pssyr2k_);
+  PSYR2K_IMPL(double              ,pdsyr2k_);
+  PSYR2K_IMPL(std::complex<float> ,pcsyr2k_);
+  PSYR2K_IMPL(std::complex<double>,pzsyr2k_);
 
-  PSYEV_IMPL(float ,pssyev_);
-  PSYEV_IMPL(double,pdsyev_);
-  PSYEVD_IMPL(float ,pssyevd_);
-  PSYEVD_IMPL(double,pdsyevd_);
+  PSYR2K_HER2K_IMPL(float ,pssyr2k_);
+  PSYR2K_HER2K_IMPL(double,pdsyr2k_);
+  PHER2K_IMPL(std::complex<float> ,float ,pcher2k_);
+  PHER2K_IMPL(std::complex<double>,double,pzher2k_);
 
-  PHEEV_IMPL(std::complex<float> ,float ,pcheev_);
-  PHEEV_IMPL(std::complex<double>,double,pzheev_);
-  PHEEVD_IMPL(std::complex<float> ,float ,pcheevd_);
-  PHEEVD_IMPL(std::complex<double>,double,pzheevd_);
+  template <typename Field>
+  inline void PSYR2K(const char UPLO, const char TRANS, const CB_INT N,
+    const CB_INT K, const Field ALPHA, const Field *A, const CB_INT IA,
+    const CB_INT JA, const ScaLAPACK_Desc_t DESCA, const Field *B, 
+    const CB_INT IB, const CB_INT JB, const ScaLAPACK_Desc_t DESCB, 
+    const Field BETA, Field *C, const CB_INT IC, const CB_INT JC, 
+    const ScaLAPACK_Desc_t DESCC) {
 
-  // LWORK obtaining variants
+    PSYR2K(UPLO,TRANS,N,K,ALPHA,A,IA,JA,&DESCA[0],B,IB,JB,&DESCB[0],BETA,
+      C,IC,JC,&DESCC[0]);
 
-  template <typename Field>
-  inline CB_INT PSYEV(const char JOBZ, const char UPLO, const CB_INT N,
-    Field *A, const CB_INT IA, const CB_INT JA, const CB_INT *DESCA,
-    Field *W, Field *Z, const CB_INT IZ, const CB_INT JZ, const CB_INT *DESCZ) {
+  }
 
-    CB_INT LWORK = -1;
-    std::vector< Field > WORK(5);
+  template <typename Field, typename RealField>
+  inline void PHER2K(const char UPLO, const char TRANS, const CB_INT N,
+    const CB_INT K, const Field ALPHA, const Field *A, const CB_INT IA,
+    const CB_INT JA, const ScaLAPACK_Desc_t DESCA, const Field *B, 
+    const CB_INT IB, const CB_INT JB, const ScaLAPACK_Desc_t DESCB, 
+    const RealField BETA, Field *C, const CB_INT IC, const CB_INT JC, 
+    const ScaLAPACK_Desc_t DESCC) {
 
-    auto INFO = PSYEV( JOBZ, UPLO, N, A, IA, JA, DESCA, W, Z, IZ, JZ, DESCZ,
-                  WORK.data(), LWORK );
+    PHER2K(UPLO,TRANS,N,K,ALPHA,A,IA,JA,&DESCA[0],B,IB,JB,&DESCB[0],BETA,
+      C,IC,JC,&DESCC[0]);
 
-    if( INFO == 0) {
+  }
 
-      LWORK = CB_INT( WORK[0] );
-      WORK.resize(LWORK);
-      INFO = PSYEV( JOBZ, UPLO, N, A, IA, JA, DESCA, W, Z, IZ, JZ, DESCZ,
-               WORK.data(), LWORK );
 
-    }
 
-    return INFO;
 
+  template <typename Field>
+  inline void PSYMM(const char SIDE, const char UPLO, const CB_INT M,
+    const CB_INT N, const Field ALPHA, const Field *A, const CB_INT IA,
+    const CB_INT JA, const CB_INT *DESCA, const Field *B, const CB_INT IB,
+    const CB_INT JB, const CB_INT *DESCB, const Field BETA, Field *C,
+    const CB_INT IC, const CB_INT JC, const CB_INT *DESCC);
+
+  /**
+   *  \brief Hermitian matrix-matrix product.
+   *
+   *  Wraps P?HEMM for complex fields. For real fields P?HEMM reduces to
+   *  P?SYMM.
+   */
+  template <typename Field>
+  inline void PHEMM(const char SIDE, const char UPLO, const CB_INT M,
+    const CB_INT N, const Field ALPHA, const Field *A, const CB_INT IA,
+    const CB_INT JA, const CB_INT *DESCA, const Field *B, const CB_INT IB,
+    const CB_INT JB, const CB_INT *DESCB, const Field BETA, Field *C,
+    const CB_INT IC, const CB_INT JC, const CB_INT *DESCC);
+
+  #define PSYMM_IMPL(NAME,F,FUNC)\
+  template <>\
+  inline void NAME(const char SIDE, const char UPLO, const CB_INT M,\
+    const CB_INT N, const F ALPHA, const F *A, const CB_INT IA,\
+    const CB_INT JA, const CB_INT *DESCA, const F *B, const CB_INT IB,\
+    const CB_INT JB, const CB_INT *DESCB, const F BETA, F *C,\
+    const CB_INT IC, const CB_INT JC, const CB_INT *DESCC) {\
+    FUNC(&SIDE,&UPLO,&M,&N,ToPblasType(&ALPHA),ToPblasType(A),&IA,&JA,\
+      DESCA,ToPblasType(B),&IB,&JB,DESCB,ToPblasType(&BETA),ToPblasType(C),\
+      &IC,&JC,DESCC);\
   }
 
+  PSYMM_IMPL(PSYMM,float               ,pssymm_);
+  PSYMM_IMPL(PSYMM,double              ,pdsymm_);
+  PSYMM_IMPL(PSYMM,std::complex<float> ,pcsymm_);
+  PSYMM_IMPL(PSYMM,std::complex<double>,pzsymm_);
+
+  PSYMM_IMPL(PHEMM,float               ,pssymm_);
+  PSYMM_IMPL(PHEMM,double              ,pdsymm_);
+  PSYMM_IMPL(PHEMM,std::complex<float> ,pchemm_);
+  PSYMM_IMPL(PHEMM,std::complex<double>,pzhemm_);
+
   template <typename Field>
-  inline CB_INT PSYEVD(const char JOBZ, const char UPLO, const CB_INT N,
-    Field *A, const CB_INT IA, const CB_INT JA, const CB_INT *DESCA,
-    Field *W, Field *Z, const CB_INT IZ, const CB_INT JZ, const CB_INT *DESCZ) {
+  inline void PSYMM(const char SIDE, const char UPLO, const CB_INT M,
+    const CB_INT N, const Field ALPHA, const Field *A, const CB_INT IA,
+    const CB_INT JA, const ScaLAPACK_Desc_t DESCA, const Field *B, 
+    const CB_INT IB, const CB_INT JB, const ScaLAPACK_Desc_t DESCB, 
+    const Field BETA, Field *C, const CB_INT IC, const CB_INT JC, 
+    const ScaLAPACK_Desc_t DESCC) {
 
-    CB_INT LWORK  = -1;
+    PSYMM(SIDE,UPLO,M,N,ALPHA,A,IA,JA,&DESCA[0],B,IB,JB,&DESCB[0],BETA,
+      C,IC,JC,&DESCC[0]);
+
+  }
+
+  template <typename Field>
+  inline void PHEMM(const char SIDE, const char UPLO, const CB_INT M,
+    const CB_INT N, const Field ALPHA, const Field *A, const CB_INT IA,
+    const CB_INT JA, const ScaLAPACK_Desc_t DESCA, const Field *B, 
+    const CB_INT IB, const CB_INT JB, const ScaLAPACK_Desc_t DESCB, 
+    const Field BETA, Field *C, const CB_INT IC, const CB_INT JC, 
+    const ScaLAPACK_Desc_t DESCC) {
+
+    PHEMM(SIDE,UPLO,M,N,ALPHA,A,IA,JA,&DESCA[0],B,IB,JB,&DESCB[0],BETA,
+      C,IC,JC,&DESCC[0]);
+
+  }
+
+
+
+
+
+  // PBLAS Level 2
+  //
+  // Distributed vectors are stored as N x 1 (INCX = 1) or 1 x N 
+  // (INCX = M_X) distributed matricies
+
+  template <typename Field>
+  inline void PGEMV(const char TRANS, const CB_INT M, const CB_INT N,
+    const Field ALPHA, const Field *A, const CB_INT IA, const CB_INT JA,
+    const CB_INT *DESCA, const Field *X, const CB_INT IX, const CB_INT JX,
+    const CB_INT *DESCX, const CB_INT INCX, const Field BETA, Field *Y,
+    const CB_INT IY, const CB_INT JY, const CB_INT *DESCY, 
+    const CB_INT INCY);
+
+  #define PGEMV_IMPL(F,FUNC)\
+  template <>\
+  inline void PGEMV(const char TRANS, const CB_INT M, const CB_INT N,\
+    const F ALPHA, const F *A, const CB_INT IA, const CB_INT JA,\
+    const CB_INT *DESCA, const F *X, const CB_INT IX, const CB_INT JX,\
+    const CB_INT *DESCX, const CB_INT INCX, const F BETA, F *Y,\
+    const CB_INT IY, const CB_INT JY, const CB_INT *DESCY,\
+    const CB_INT INCY) {\
+    FUNC(&TRANS,&M,&N,ToPblasType(&ALPHA),ToPblasType(A),&IA,&JA,DESCA,\
+      ToPblasType(X),&IX,&JX,DESCX,&INCX,ToPblasType(&BETA),ToPblasType(Y),\
+      &IY,&JY,DESCY,&INCY);\
+  }
+
+  PGEMV_IMPL(float               ,psgemv_);
+  PGEMV_IMPL(double              ,pdgemv_);
+  PGEMV_IMPL(std::complex<float> ,pcgemv_);
+  PGEMV_IMPL(std::complex<double>,pzgemv_);
+
+  template <typename Field>
+  inline void PGEMV(const char TRANS, const CB_INT M, const CB_INT N,
+    const Field ALPHA, const Field *A, const CB_INT IA, const CB_INT JA,
+    const ScaLAPACK_Desc_t DESCA, const Field *X, const CB_INT IX, 
+    const CB_INT JX, const ScaLAPACK_Desc_t DESCX, const CB_INT INCX, 
+    const Field BETA, Field *Y, const CB_INT IY, const CB_INT JY, 
+    const ScaLAPACK_Desc_t DESCY, const CB_INT INCY) {
+
+    PGEMV(TRANS,M,N,ALPHA,A,IA,JA,&DESCA[0],X,IX,JX,&DESCX[0],INCX,BETA,
+      Y,IY,JY,&DESCY[0],INCY);
+
+  }
+
+
+
+
+  /**
+   *  \brief Symmetric (real) / Hermitian (complex) matrix-vector product.
+   *
+   *  PBLAS only provides P?SYMV for real fields, PHEMV covers all four 
+   *  fields and reduces to P?SYMV for real fields.
+   */
+  template <typename Field>
+  inline void PHEMV(const char UPLO, const CB_INT N, const Field ALPHA,
+    const Field *A, const CB_INT IA, const CB_INT JA, const CB_INT *DESCA,
+    const Field *X, const CB_INT IX, const CB_INT JX, const CB_INT *DESCX,
+    const CB_INT INCX, const Field BETA, Field *Y, const CB_INT IY, 
+    const CB_INT JY, const CB_INT *DESCY, const CB_INT INCY);
+
+  template <typename Field>
+  inline void PSYMV(const char UPLO, const CB_INT N, const Field ALPHA,
+    const Field *A, const CB_INT IA, const CB_INT JA, const CB_INT *DESCA,
+    const Field *X, const CB_INT IX, const CB_INT JX, const CB_INT *DESCX,
+    const CB_INT INCX, const Field BETA, Field *Y, const CB_INT IY, 
+    const CB_INT JY, const CB_INT *DESCY, const CB_INT INCY);
+
+  #define PSYMV_IMPL(NAME,F,FUNC)\
+  template <>\
+  inline void NAME(const char UPLO, const CB_INT N, const F ALPHA,\
+    const F *A, const CB_INT IA, const CB_INT JA, const CB_INT *DESCA,\
+    const F *X, const CB_INT IX, const CB_INT JX, const CB_INT *DESCX,\
+    const CB_INT INCX, const F BETA, F *Y, const CB_INT IY,\
+    const CB_INT JY, const CB_INT *DESCY, const CB_INT INCY) {\
+    FUNC(&UPLO,&N,ToPblasType(&ALPHA),ToPblasType(A),&IA,&JA,DESCA,\
+      ToPblasType(X),&IX,&JX,DESCX,&INCX,ToPblasType(&BETA),ToPblasType(Y),\
+      &IY,&JY,DESCY,&INCY);\
+  }
+
+  PSYMV_IMPL(PSYMV,float               ,pssymv_);
+  PSYMV_IMPL(PSYMV,double              ,pdsymv_);
+
+  PSYMV_IMPL(PHEMV,float               ,pssymv_);
+  PSYMV_IMPL(PHEMV,double              ,pdsymv_);
+  PSYMV_IMPL(PHEMV,std::complex<float> ,pchemv_);
+  PSYMV_IMPL(PHEMV,std::complex<double>,pzhemv_);
+
+  template <typename Field>
+  inline void PSYMV(const char UPLO, const CB_INT N, const Field ALPHA,
+    const Field *A, const CB_INT IA, const CB_INT JA, 
+    const ScaLAPACK_Desc_t DESCA, const Field *X, const CB_INT IX, 
+    const CB_INT JX, const ScaLAPACK_Desc_t DESCX, const CB_INT INCX, 
+    const Field BETA, Field *Y, const CB_INT IY, const CB_INT JY, 
+    const ScaLAPACK_Desc_t DESCY, const CB_INT INCY) {
+
+    PSYMV(UPLO,N,ALPHA,A,IA,JA,&DESCA[0],X,IX,JX,&DESCX[0],INCX,BETA,
+      Y,IY,JY,&DESCY[0],INCY);
+
+  }
+
+  template <typename Field>
+  inline void PHEMV(const char UPLO, const CB_INT N, const Field ALPHA,
+    const Field *A, const CB_INT IA, const CB_INT JA, 
+    const ScaLAPACK_Desc_t DESCA, const Field *X, const CB_INT IX, 
+    const CB_INT JX, const ScaLAPACK_Desc_t DESCX, const CB_INT INCX, 
+    const Field BETA, Field *Y, const CB_INT IY, const CB_INT JY, 
+    const ScaLAPACK_Desc_t DESCY, const CB_INT INCY) {
+
+    PHEMV(UPLO,N,ALPHA,A,IA,JA,&DESCA[0],X,IX,JX,&DESCX[0],INCX,BETA,
+      Y,IY,JY,&DESCY[0],INCY);
+
+  }
+
+
+
+
+  /**
+   *  \brief Rank-1 updates A = ALPHA * X * Y**T (PGER) and 
+   *  A = ALPHA * X * Y**H (PGERC).
+   *
+   *  For real fields both reduce to P?GER.
+   */
+  template <typename Field>
+  inline void PGER(const CB_INT M, const CB_INT N, const Field ALPHA,
+    const Field *X, const CB_INT IX, const CB_INT JX, const CB_INT *DESCX,
+    const CB_INT INCX, const Field *Y, const CB_INT IY, const CB_INT JY,
+    const CB_INT *DESCY, const CB_INT INCY, Field *A, const CB_INT IA,
+    const CB_INT JA, const CB_INT *DESCA);
+
+  template <typename Field>
+  inline void PGERC(const CB_INT M, const CB_INT N, const Field ALPHA,
+    const Field *X, const CB_INT IX, const CB_INT JX, const CB_INT *DESCX,
+    const CB_INT INCX, const Field *Y, const CB_INT IY, const CB_INT JY,
+    const CB_INT *DESCY, const CB_INT INCY, Field *A, const CB_INT IA,
+    const CB_INT JA, const CB_INT *DESCA);
+
+  #define PGER_IMPL(NAME,F,FUNC)\
+  template <>\
+  inline void NAME(const CB_INT M, const CB_INT N, const F ALPHA,\
+    const F *X, const CB_INT IX, const CB_INT JX, const CB_INT *DESCX,\
+    const CB_INT INCX, const F *Y, const CB_INT IY, const CB_INT JY,\
+    const CB_INT *DESCY, const CB_INT INCY, F *A, const CB_INT IA,\
+    const CB_INT JA, const CB_INT *DESCA) {\
+    FUNC(&M,&N,ToPblasType(&ALPHA),ToPblasType(X),&IX,&JX,DESCX,&INCX,\
+      ToPblasType(Y),&IY,&JY,DESCY,&INCY,ToPblasType(A),&IA,&JA,DESCA);\
+  }
+
+  PGER_IMPL(PGER,float               ,psger_);
+  PGER_IMPL(PGER,double              ,pdger_);
+  PGER_IMPL(PGER,std::complex<float> ,pcgeru_);
+  PGER_IMPL(PGER,std::complex<double>,pzgeru_);
+
+  PGER_IMPL(PGERC,float               ,psger_);
+  PGER_IMPL(PGERC,double              ,pdger_);
+  PGER_IMPL(PGERC,std::complex<float> ,pcgerc_);
+  PGER_IMPL(PGERC,std::complex<double>,pzgerc_);
+
+  template <typename Field>
+  inline void PGER(const CB_INT M, const CB_INT N, const Field ALPHA,
+    const Field *X, const CB_INT IX, const CB_INT JX, 
+    const ScaLAPACK_Desc_t DESCX, const CB_INT INCX, const Field *Y, 
+    const CB_INT IY, const CB_INT JY, const ScaLAPACK_Desc_t DESCY, 
+    const CB_INT INCY, Field *A, const CB_INT IA, const CB_INT JA, 
+    const ScaLAPACK_Desc_t DESCA) {
+
+    PGER(M,N,ALPHA,X,IX,JX,&DESCX[0],INCX,Y,IY,JY,&DESCY[0],INCY,
+      A,IA,JA,&DESCA[0]);
+
+  }
+
+  template <typename Field>
+  inline void PGERC(const CB_INT M, const CB_INT N, const Field ALPHA,
+    const Field *X, const CB_INT IX, const CB_INT JX, 
+    const ScaLAPACK_Desc_t DESCX, const CB_INT INCX, const Field *Y, 
+    const CB_INT IY, const CB_INT JY, const ScaLAPACK_Desc_t DESCY, 
+    const CB_INT INCY, Field *A, const CB_INT IA, const CB_INT JA, 
+    const ScaLAPACK_Desc_t DESCA) {
+
+    PGERC(M,N,ALPHA,X,IX,JX,&DESCX[0],INCX,Y,IY,JY,&DESCY[0],INCY,
+      A,IA,JA,&DESCA[0]);
+
+  }
+
+
+
+
+  // PBLAS Level 1
+  //
+  // NOTE: As in the PBLAS, the results of the reductions (PDOT, PDOTC and 
+  // PNRM2) are only returned in the scope of the vector operands, i.e. on
+  // the process column owning an N x 1 vector (process row for 1 x N).
+  // They are undefined elsewhere, and must be broadcast (e.g. through 
+  // BlacsGrid::Broadcast) if required on the full grid.
+
+  /**
+   *  \brief Distributed dot products X**T * Y (PDOT) and X**H * Y (PDOTC).
+   *
+   *  For real fields both reduce to P?DOT.
+   */
+  template <typename Field>
+  inline Field PDOT(const CB_INT N, const Field *X, const CB_INT IX,
+    const CB_INT JX, const CB_INT *DESCX, const CB_INT INCX, const Field *Y,
+    const CB_INT IY, const CB_INT JY, const CB_INT *DESCY, 
+    const CB_INT INCY);
+
+  template <typename Field>
+  inline Field PDOTC(const CB_INT N, const Field *X, const CB_INT IX,
+    const CB_INT JX, const CB_INT *DESCX, const CB_INT INCX, const Field *Y,
+    const CB_INT IY, const CB_INT JY, const CB_INT *DESCY, 
+    const CB_INT INCY);
+
+  #define PDOT_IMPL(NAME,F,FUNC)\
+  template <>\
+  inline F NAME(const CB_INT N, const F *X, const CB_INT IX,\
+    const CB_INT JX, const CB_INT *DESCX, const CB_INT INCX, const F *Y,\
+    const CB_INT IY, const CB_INT JY, const CB_INT *DESCY,\
+    const CB_INT INCY) {\
+    F DOT(0.);\
+    FUNC(&N,ToPblasType(&DOT),ToPblasType(X),&IX,&JX,DESCX,&INCX,\
+      ToPblasType(Y),&IY,&JY,DESCY,&INCY);\
+    return DOT;\
+  }
+
+  PDOT_IMPL(PDOT,float               ,psdot_);
+  PDOT_IMPL(PDOT,double              ,pddot_);
+  PDOT_IMPL(PDOT,std::complex<float> ,pcdotu_);
+  PDOT_IMPL(PDOT,std::complex<double>,pzdotu_);
+
+  PDOT_IMPL(PDOTC,float               ,psdot_);
+  PDOT_IMPL(PDOTC,double              ,pddot_);
+  PDOT_IMPL(PDOTC,std::complex<float> ,pcdotc_);
+  PDOT_IMPL(PDOTC,std::complex<double>,pzdotc_);
+
+  template <typename Field>
+  inline Field PDOT(const CB_INT N, const Field *X, const CB_INT IX,
+    const CB_INT JX, const ScaLAPACK_Desc_t DESCX, const CB_INT INCX, 
+    const Field *Y, const CB_INT IY, const CB_INT JY, 
+    const ScaLAPACK_Desc_t DESCY, const CB_INT INCY) {
+
+    return PDOT(N,X,IX,JX,&DESCX[0],INCX,Y,IY,JY,&DESCY[0],INCY);
+
+  }
+
+  template <typename Field>
+  inline Field PDOTC(const CB_INT N, const Field *X, const CB_INT IX,
+    const CB_INT JX, const ScaLAPACK_Desc_t DESCX, const CB_INT INCX, 
+    const Field *Y, const CB_INT IY, const CB_INT JY, 
+    const ScaLAPACK_Desc_t DESCY, const CB_INT INCY) {
+
+    return PDOTC(N,X,IX,JX,&DESCX[0],INCX,Y,IY,JY,&DESCY[0],INCY);
+
+  }
+
+
+
+
+  template <typename Field, 
+            typename RealField = typename CXXBLACS_REAL_TYPE<Field>::type>
+  inline RealField PNRM2(const CB_INT N, const Field *X, const CB_INT IX,
+    const CB_INT JX, const CB_INT *DESCX, const CB_INT INCX);
+
+  #define PNRM2_IMPL(F,RF,FUNC)\
+  template <>\
+  inline RF PNRM2(const CB_INT N, const F *X, const CB_INT IX,\
+    const CB_INT JX, const CB_INT *DESCX, const CB_INT INCX) {\
+    RF NRM2(0.);\
+    FUNC(&N,&NRM2,ToPblasType(X),&IX,&JX,DESCX,&INCX);\
+    return NRM2;\
+  }
+
+  PNRM2_IMPL(float               ,float ,psnrm2_);
+  PNRM2_IMPL(double              ,double,pdnrm2_);
+  PNRM2_IMPL(std::complex<float> ,float ,pscnrm2_);
+  PNRM2_IMPL(std::complex<double>,double,pdznrm2_);
+
+  template <typename Field>
+  inline typename CXXBLACS_REAL_TYPE<Field>::type PNRM2(const CB_INT N, 
+    const Field *X, const CB_INT IX, const CB_INT JX, 
+    const ScaLAPACK_Desc_t DESCX, const CB_INT INCX) {
+
+    return PNRM2(N,X,IX,JX,&DESCX[0],INCX);
+
+  }
+
+
+
+
+  template <typename Field>
+  inline void PAXPY(const CB_INT N, const Field ALPHA, const Field *X,
+    const CB_INT IX, const CB_INT JX, const CB_INT *DESCX, const CB_INT INCX,
+    Field *Y, const CB_INT IY, const CB_INT JY, const CB_INT *DESCY,
+    const CB_INT INCY);
+
+  #define PAXPY_IMPL(F,FUNC)\
+  template <>\
+  inline void PAXPY(const CB_INT N, const F ALPHA, const F *X,\
+    const CB_INT IX, const CB_INT JX, const CB_INT *DESCX, const CB_INT INCX,\
+    F *Y, const CB_INT IY, const CB_INT JY, const CB_INT *DESCY,\
+    const CB_INT INCY) {\
+    FUNC(&N,ToPblasType(&ALPHA),ToPblasType(X),&IX,&JX,DESCX,&INCX,\
+      ToPblasType(Y),&IY,&JY,DESCY,&INCY);\
+  }
+
+  PAXPY_IMPL(float               ,psaxpy_);
+  PAXPY_IMPL(double              ,pdaxpy_);
+  PAXPY_IMPL(std::complex<float> ,pcaxpy_);
+  PAXPY_IMPL(std::complex<double>,pzaxpy_);
+
+  template <typename Field>
+  inline void PAXPY(const CB_INT N, const Field ALPHA, const Field *X,
+    const CB_INT IX, const CB_INT JX, const ScaLAPACK_Desc_t DESCX, 
+    const CB_INT INCX, Field *Y, const CB_INT IY, const CB_INT JY, 
+    const ScaLAPACK_Desc_t DESCY, const CB_INT INCY) {
+
+    PAXPY(N,ALPHA,X,IX,JX,&DESCX[0],INCX,Y,IY,JY,&DESCY[0],INCY);
+
+  }
+
+
+
+
+  template <typename Field>
+  inline void PSCAL(const CB_INT N, const Field ALPHA, Field *X,
+    const CB_INT IX, const CB_INT JX, const CB_INT *DESCX, 
+    const CB_INT INCX);
+
+  #define PSCAL_IMPL(F,FUNC)\
+  template <>\
+  inline void PSCAL(const CB_INT N, const F ALPHA, F *X,\
+    const CB_INT IX, const CB_INT JX, const CB_INT *DESCX,\
+    const CB_INT INCX) {\
+    FUNC(&N,ToPblasType(&ALPHA),ToPblasType(X),&IX,&JX,DESCX,&INCX);\
+  }
+
+  PSCAL_IMPL(float               ,psscal_);
+  PSCAL_IMPL(double              ,pdscal_);
+  PSCAL_IMPL(std::complex<float> ,pcscal_);
+  PSCAL_IMPL(std::complex<double>,pzscal_);
+
+  template <typename Field>
+  inline void PSCAL(const CB_INT N, const Field ALPHA, Field *X,
+    const CB_INT IX, const CB_INT JX, const ScaLAPACK_Desc_t DESCX, 
+    const CB_INT INCX) {
+
+    PSCAL(N,ALPHA,X,IX,JX,&DESCX[0],INCX);
+
+  }
+
+
+
+  template <typename Field>
+  inline void PTRADD(const char UPLO, const char TRANS, const CB_INT M,
+    const CB_INT N, const Field ALPHA, const Field *A, const CB_INT IA,
+    const CB_INT JA, const CB_INT *DESCA, const Field BETA, Field *C,
+    const CB_INT IC, const CB_INT JC, const CB_INT *DESCC);
+
+  #define PTRADD_IMPL(F,FUNC)\
+  template <>\
+  inline void PTRADD(const char UPLO, const char TRANS, const CB_INT M,\
+    const CB_INT N, const F ALPHA, const F *A, const CB_INT IA,\
+    const CB_INT JA, const CB_INT *DESCA, const F BETA, F *C,\
+    const CB_INT IC, const CB_INT JC, const CB_INT *DESCC) {\
+    FUNC(&UPLO,&TRANS,&M,&N,ToPblasType(&ALPHA),ToPblasType(A),&IA,&JA,\
+      DESCA,ToPblasType(&BETA),ToPblasType(C),&IC,&JC,DESCC);\
+  }
+
+  PTRADD_IMPL(float               ,pstradd_);
+  PTRADD_IMPL(double              ,pdtradd_);
+  PTRADD_IMPL(std::complex<float> ,pctradd_);
+  PTRADD_IMPL(std::complex<double>,pztradd_);
+
+  template <typename Field>
+  inline void PTRADD(const char UPLO, const char TRANS, const CB_INT M,
+    const CB_INT N, const Field ALPHA, const Field *A, const CB_INT IA,
+    const CB_INT JA, const ScaLAPACK_Desc_t DESCA, const Field BETA, 
+    Field *C, const CB_INT IC, const CB_INT JC, 
+    const ScaLAPACK_Desc_t DESCC) {
+
+    PTRADD(UPLO,TRANS,M,N,ALPHA,A,IA,JA,&DESCA[0],BETA,C,IC,JC,&DESCC[0]);
+
+  }
+
+
+
+
+  /**
+   *  \brief C = BETA * C + ALPHA * A**T (PTRAN) and 
+   *  C = BETA * C + ALPHA * A**H (PTRANC), C is M x N.
+   *
+   *  For real fields both reduce to P?TRAN.
+   */
+  template <typename Field>
+  inline void PTRAN(const CB_INT M, const CB_INT N, const Field ALPHA,
+    const Field *A, const CB_INT IA, const CB_INT JA, const CB_INT *DESCA,
+    const Field BETA, Field *C, const CB_INT IC, const CB_INT JC,
+    const CB_INT *DESCC);
+
+  template <typename Field>
+  inline void PTRANC(const CB_INT M, const CB_INT N, const Field ALPHA,
+    const Field *A, const CB_INT IA, const CB_INT JA, const CB_INT *DESCA,
+    const Field BETA, Field *C, const CB_INT IC, const CB_INT JC,
+    const CB_INT *DESCC);
+
+  #define PTRAN_IMPL(NAME,F,FUNC)\
+  template <>\
+  inline void NAME(const CB_INT M, const CB_INT N, const F ALPHA,\
+    const F *A, const CB_INT IA, const CB_INT JA, const CB_INT *DESCA,\
+    const F BETA, F *C, const CB_INT IC, const CB_INT JC,\
+    const CB_INT *DESCC) {\
+    FUNC(&M,&N,ToPblasType(&ALPHA),ToPblasType(A),&IA,&JA,DESCA,\
+      ToPblasType(&BETA),ToPblasType(C),&IC,&JC,DESCC);\
+  }
+
+  PTRAN_IMPL(PTRAN,float               ,pstran_);
+  PTRAN_IMPL(PTRAN,double              ,pdtran_);
+  PTRAN_IMPL(PTRAN,std::complex<float> ,pctranu_);
+  PTRAN_IMPL(PTRAN,std::complex<double>,pztranu_);
+
+  PTRAN_IMPL(PTRANC,float               ,pstran_);
+  PTRAN_IMPL(PTRANC,double              ,pdtran_);
+  PTRAN_IMPL(PTRANC,std::complex<float> ,pctranc_);
+  PTRAN_IMPL(PTRANC,std::complex<double>,pztranc_);
+
+  template <typename Field>
+  inline void PTRAN(const CB_INT M, const CB_INT N, const Field ALPHA,
+    const Field *A, const CB_INT IA, const CB_INT JA, 
+    const ScaLAPACK_Desc_t DESCA, const Field BETA, Field *C, 
+    const CB_INT IC, const CB_INT JC, const ScaLAPACK_Desc_t DESCC) {
+
+    PTRAN(M,N,ALPHA,A,IA,JA,&DESCA[0],BETA,C,IC,JC,&DESCC[0]);
+
+  }
+
+  template <typename Field>
+  inline void PTRANC(const CB_INT M, const CB_INT N, const Field ALPHA,
+    const Field *A, const CB_INT IA, const CB_INT JA, 
+    const ScaLAPACK_Desc_t DESCA, const Field BETA, Field *C, 
+    const CB_INT IC, const CB_INT JC, const ScaLAPACK_Desc_t DESCC) {
+
+    PTRANC(M,N,ALPHA,A,IA,JA,&DESCA[0],BETA,C,IC,JC,&DESCC[0]);
+
+  }
+
+
+
+
+  template <typename Field>
+  inline void PGEADD(const char TRANS, const CB_INT M, const CB_INT N,
+    const Field ALPHA, const Field *A, const CB_INT IA, const CB_INT JA,
+    const CB_INT *DESCA, const Field BETA, Field *C, const CB_INT IC,
+    const CB_INT JC, const CB_INT *DESCC);
+
+  #define PGEADD_IMPL(F,FUNC)\
+  template <>\
+  inline void PGEADD(const char TRANS, const CB_INT M, const CB_INT N,\
+    const F ALPHA, const F *A, const CB_INT IA, const CB_INT JA,\
+    const CB_INT *DESCA, const F BETA, F *C, const CB_INT IC,\
+    const CB_INT JC, const CB_INT *DESCC) {\
+    FUNC(&TRANS,&M,&N,ToPblasType(&ALPHA),ToPblasType(A),&IA,&JA,DESCA,\
+      ToPblasType(&BETA),ToPblasType(C),&IC,&JC,DESCC);\
+  }
+
+  PGEADD_IMPL(float               ,psgeadd_);
+  PGEADD_IMPL(double              ,pdgeadd_);
+  PGEADD_IMPL(std::complex<float> ,pcgeadd_);
+  PGEADD_IMPL(std::complex<double>,pzgeadd_);
+
+  template <typename Field>
+  inline void PGEADD(const char TRANS, const CB_INT M, const CB_INT N,
+    const Field ALPHA, const Field *A, const CB_INT IA, const CB_INT JA,
+    const ScaLAPACK_Desc_t DESCA, const Field BETA, Field *C, 
+    const CB_INT IC, const CB_INT JC, const ScaLAPACK_Desc_t DESCC) {
+
+    PGEADD(TRANS,M,N,ALPHA,A,IA,JA,&DESCA[0],BETA,C,IC,JC,&DESCC[0]);
+
+  }
+
+
+
+
+
+
+
+
+
+
+
+
+  template <typename Field>
+  inline void PGEMR2D(const CB_INT M, const CB_INT N, const Field *A,
+    const CB_INT IA, const CB_INT JA, const CB_INT *DESCA, Field *B,
+    const CB_INT IB, const CB_INT JB, const CB_INT *DESCB, const CB_INT ICTXT);
+
+  #define PGEMR2D_IMPL(F,FUNC)\
+  template <>\
+  inline void PGEMR2D(const CB_INT M, const CB_INT N, const F *A,\
+    const CB_INT IA, const CB_INT JA, const CB_INT *DESCA, F *B,\
+    const CB_INT IB, const CB_INT JB, const CB_INT *DESCB, const CB_INT ICTXT){\
+    \
+    FUNC(&M,&N,ToScalapackType(A),&IA,&JA,DESCA,ToScalapackType(B),&IB,&JB,\
+      DESCB,&ICTXT);\
+  }
+
+  PGEMR2D_IMPL(float                       ,psgemr2d_);
+  PGEMR2D_IMPL(double                      ,pdgemr2d_);
+  PGEMR2D_IMPL(std::complex<float> ,pcgemr2d_);
+  PGEMR2D_IMPL(std::complex<double>,pzgemr2d_);
+
+  template <typename Field>
+  inline void PGEMR2D(const CB_INT M, const CB_INT N, const Field *A,
+    const CB_INT IA, const CB_INT JA, const ScaLAPACK_Desc_t DESCA, Field *B,
+    const CB_INT IB, const CB_INT JB, const ScaLAPACK_Desc_t DESCB, 
+    const CB_INT ICTXT) {
+
+    PGEMR2D(M,N,A,IA,JA,&DESCA[0],B,IB,JB,&DESCB[0],ICTXT);
+
+  }
+
+
+
+
+  /**
+   * \brief Serial Hermitian eigensolve of a matrix on a single process 
+   * (see SingleProcessDesc) with the P?HEEV(D) conventions: eigenvectors
+   * are formed in A by ?HEEV(D) and copied to Z.
+   */
+  template <typename Field, typename RealField>
+  inline CB_INT SerialHEEV(const bool DC, const char JOBZ, const char UPLO,
+    const CB_INT N, Field *A, const CB_INT IA, const CB_INT JA, 
+    const CB_INT *DESCA, RealField *W, Field *Z, const CB_INT IZ, 
+    const CB_INT JZ, const CB_INT *DESCZ) {
+
+    Field *ALoc = LocalSubmatrix(A,IA,JA,DESCA);
+
+    auto INFO = DC ? HEEVD(JOBZ,UPLO,N,ALoc,DESCA[8],W) :
+                     HEEV (JOBZ,UPLO,N,ALoc,DESCA[8],W);
+
+    if( INFO == 0 and (JOBZ == 'V' or JOBZ == 'v') )
+      LACOPY('A',N,N,ALoc,DESCA[8],LocalSubmatrix(Z,IZ,JZ,DESCZ),DESCZ[8]);
+
+    return INFO;
+
+  }
+
+  template <typename Field>
+  inline CB_INT PSYEV(const char JOBZ, const char UPLO, const CB_INT N,
+    Field *A, const CB_INT IA, const CB_INT JA, const CB_INT *DESCA,
+    Field *W, Field *Z, const CB_INT IZ, const CB_INT JZ, const CB_INT *DESCZ,
+    Field *WORK, const CB_INT LWORK);
+
+  template <typename Field>
+  inline CB_INT PSYEVD(const char JOBZ, const char UPLO, const CB_INT N,
+    Field *A, const CB_INT IA, const CB_INT JA, const CB_INT *DESCA,
+    Field *W, Field *Z, const CB_INT IZ, const CB_INT JZ, const CB_INT *DESCZ,
+    Field *WORK, const CB_INT LWORK, CB_INT *IWORK, const CB_INT LIWORK);
+
+  template <typename Field, typename RealField>
+  inline CB_INT PHEEV(const char JOBZ, const char UPLO, const CB_INT N,
+    Field *A, const CB_INT IA, const CB_INT JA, const CB_INT *DESCA,
+    RealField *W, Field *Z, const CB_INT IZ, const CB_INT JZ, 
+    const CB_INT *DESCZ, Field *WORK, const CB_INT LWORK, RealField *RWORK,
+    const CB_INT LRWORK);
+
+  template <typename Field, typename RealField>
+  inline CB_INT PHEEVD(const char JOBZ, const char UPLO, const CB_INT N,
+    Field *A, const CB_INT IA, const CB_INT JA, const CB_INT *DESCA,
+    RealField *W, Field *Z, const CB_INT IZ, const CB_INT JZ, 
+    const CB_INT *DESCZ, Field *WORK, const CB_INT LWORK, RealField *RWORK,
+    const CB_INT LRWORK, CB_INT* IWORK, const CB_INT LIWORK);
+
+
+
+  #define PSYEV_IMPL(F,FUNC)\
+  template <>\
+  inline CB_INT PSYEV(const char JOBZ, const char UPLO, const CB_INT N,\
+    F *A, const CB_INT IA, const CB_INT JA, const CB_INT *DESCA,\
+    F *W, F *Z, const CB_INT IZ, const CB_INT JZ, const CB_INT *DESCZ,\
+    F *WORK, const CB_INT LWORK) {\
+    \
+    if( DESCA[4] != DESCA[5] ) {\
+      std::runtime_error err("MB must be the same as NB in P?SYEV");\
+      throw err;\
+    }\
+    if( SingleProcessDesc(DESCA) ) {\
+      if( LWORK == -1 ) { WORK[0] = F(1.); return 0; }\
+      return SerialHEEV(false,JOBZ,UPLO,N,A,IA,JA,DESCA,W,Z,IZ,JZ,DESCZ);\
+    }\
+    CB_INT INFO;\
+    FUNC(&JOBZ,&UPLO,&N,A,&IA,&JA,DESCA,W,Z,&IZ,&JZ,DESCZ,WORK,&LWORK,&INFO);\
+    return INFO;\
+    \
+  }
+
+  #define PSYEVD_IMPL(F,FUNC)\
+  template <>\
+  inline CB_INT PSYEVD(const char JOBZ, const char UPLO, const CB_INT N,\
+    F *A, const CB_INT IA, const CB_INT JA, const CB_INT *DESCA,\
+    F *W, F *Z, const CB_INT IZ, const CB_INT JZ, const CB_INT *DESCZ,\
+    F *WORK, const CB_INT LWORK, CB_INT* IWORK, const CB_INT LIWORK) {\
+    \
+    if( DESCA[4] != DESCA[5] ) {\
+      std::runtime_error err("MB must be the same as NB in P?SYEV");\
+      throw err;\
+    }\
+    if( SingleProcessDesc(DESCA) ) {\
+      if( LWORK == -1 or LIWORK == -1 ) {\
+        WORK[0] = F(1.); IWORK[0] = 1; return 0;\
+      }\
+      return SerialHEEV(true,JOBZ,UPLO,N,A,IA,JA,DESCA,W,Z,IZ,JZ,DESCZ);\
+    }\
+    CB_INT INFO;\
+    FUNC(&JOBZ,&UPLO,&N,A,&IA,&JA,DESCA,W,Z,&IZ,&JZ,DESCZ,WORK,&LWORK,\
+      IWORK,&LIWORK,&INFO);\
+    return INFO;\
+    \
+  }
+
+  #define PHEEV_IMPL(F,RF,FUNC)\
+  template <>\
+  inline CB_INT PHEEV(const char JOBZ, const char UPLO, const CB_INT N,\
+    F *A, const CB_INT IA, const CB_INT JA, const CB_INT *DESCA,\
+    RF *W, F *Z, const CB_INT IZ, const CB_INT JZ, const CB_INT *DESCZ,\
+    F *WORK, const CB_INT LWORK, RF* RWORK, const CB_INT LRWORK) {\
+    \
+    if( DESCA[4] != DESCA[5] ) {\
+      std::runtime_error err("MB must be the same as NB in P?HEEV");\
+      throw err;\
+    }\
+    if( SingleProcessDesc(DESCA) ) {\
+      if( LWORK == -1 ) { WORK[0] = F(1.); return 0; }\
+      return SerialHEEV(false,JOBZ,UPLO,N,A,IA,JA,DESCA,W,Z,IZ,JZ,DESCZ);\
+    }\
+    CB_INT INFO;\
+    FUNC(&JOBZ,&UPLO,&N,ToScalapackType(A),&IA,&JA,DESCA,W,ToScalapackType(Z),\
+      &IZ,&JZ,DESCZ,ToScalapackType(WORK),&LWORK,RWORK,&LRWORK,&INFO);\
+    return INFO;\
+    \
+  }
+
+  #define PHEEVD_IMPL(F,RF,FUNC)\
+  template <>\
+  inline CB_INT PHEEVD(const char JOBZ, const char UPLO, const CB_INT N,\
+    F *A, const CB_INT IA, const CB_INT JA, const CB_INT *DESCA,\
+    RF *W, F *Z, const CB_INT IZ, const CB_INT JZ, const CB_INT *DESCZ,\
+    F *WORK, const CB_INT LWORK, RF* RWORK, const CB_INT LRWORK,\
+    CB_INT *IWORK, const CB_INT LIWORK) {\
+    \
+    if( DESCA[4] != DESCA[5] ) {\
+      std::runtime_error err("MB must be the same as NB in P?HEEV");\
+      throw err;\
+    }\
+    if( SingleProcessDesc(DESCA) ) {\
+      if( LWORK == -1 or LRWORK == -1 or LIWORK == -1 ) {\
+        WORK[0] = F(1.); RWORK[0] = RF(1.); IWORK[0] = 1; return 0;\
+      }\
+      return SerialHEEV(true,JOBZ,UPLO,N,A,IA,JA,DESCA,W,Z,IZ,JZ,DESCZ);\
+    }\
+    CB_INT INFO;\
+    FUNC(&JOBZ,&UPLO,&N,ToScalapackType(A),&IA,&JA,DESCA,W,ToScalapackType(Z),\
+      &IZ,&JZ,DESCZ,ToScalapackType(WORK),&LWORK,RWORK,&LRWORK,IWORK,&LIWORK,\
+      &INFO);\
+    return INFO;\
+    \
+  }
+
+  PSYEV_IMPL(float ,pssyev_);
+  PSYEV_IMPL(double,pdsyev_);
+  PSYEVD_IMPL(float ,pssyevd_);
+  PSYEVD_IMPL(double,pdsyevd_);
+
+  PHEEV_IMPL(std::complex<float> ,float ,pcheev_);
+  PHEEV_IMPL(std::complex<double>,double,pzheev_);
+  PHEEVD_IMPL(std::complex<float> ,float ,pcheevd_);
+  PHEEVD_IMPL(std::complex<double>,double,pzheevd_);
+
+  // For real fields P?HEEVD reduces to P?SYEVD (RWORK is not referenced,
+  // a workspace query yields RWORK[0] = 1)
+
+  #define PHEEVD_REAL_IMPL(F)\
+  template <>\
+  inline CB_INT PHEEVD(const char JOBZ, const char UPLO, const CB_INT N,\
+    F *A, const CB_INT IA, const CB_INT JA, const CB_INT *DESCA,\
+    F *W, F *Z, const CB_INT IZ, const CB_INT JZ, const CB_INT *DESCZ,\
+    F *WORK, const CB_INT LWORK, F* RWORK, const CB_INT LRWORK,\
+    CB_INT *IWORK, const CB_INT LIWORK) {\
+    \
+    auto INFO = PSYEVD(JOBZ,UPLO,N,A,IA,JA,DESCA,W,Z,IZ,JZ,DESCZ,WORK,LWORK,\
+      IWORK,LIWORK);\
+    if( LRWORK == -1 ) RWORK[0] = F(1.);\
+    return INFO;\
+    \
+  }
+
+  PHEEVD_REAL_IMPL(float );
+  PHEEVD_REAL_IMPL(double);
+
+  // LWORK obtaining variants
+
+  template <typename Field>
+  inline CB_INT PSYEV(const char JOBZ, const char UPLO, const CB_INT N,
+    Field *A, const CB_INT IA, const CB_INT JA, const CB_INT *DESCA,
+    Field *W, Field *Z, const CB_INT IZ, const CB_INT JZ, const CB_INT *DESCZ) {
+
+    CB_INT LWORK = -1;
+    std::vector< Field > WORK(5);
+
+    auto INFO = PSYEV( JOBZ, UPLO, N, A, IA, JA, DESCA, W, Z, IZ, JZ, DESCZ,
+                  WORK.data(), LWORK );
+
+    if( INFO == 0) {
+
+      LWORK = CB_INT( WORK[0] );
+      WORK.resize(LWORK);
+      INFO = PSYEV( JOBZ, UPLO, N, A, IA, JA, DESCA, W, Z, IZ, JZ, DESCZ,
+               WORK.data(), LWORK );
+
+    }
+
+    return INFO;
+
+  }
+
+  template <typename Field>
+  inline CB_INT PSYEVD(const char JOBZ, const char UPLO, const CB_INT N,
+    Field *A, const CB_INT IA, const CB_INT JA, const CB_INT *DESCA,
+    Field *W, Field *Z, const CB_INT IZ, const CB_INT JZ, const CB_INT *DESCZ) {
+
+    CB_INT LWORK  = -1;
+    CB_INT LIWORK = -1;
+    std::vector< Field >  WORK(5);
+    std::vector< CB_INT > IWORK(5);
+
+    auto INFO = PSYEVD( JOBZ, UPLO, N, A, IA, JA, DESCA, W, Z, IZ, JZ, DESCZ,
+                  WORK.data(), LWORK, IWORK.data(), LIWORK );
+
+    if( INFO == 0 ) {
+
+      LWORK  = CB_INT( WORK[0] );
+      LIWORK = IWORK[0];
+      WORK.resize(LWORK);
+      IWORK.resize(LIWORK);
+
+      INFO = PSYEVD( JOBZ, UPLO, N, A, IA, JA, DESCA, W, Z, IZ, JZ, DESCZ,
+               WORK.data(), LWORK, IWORK.data(), LIWORK );
+
+    }
+
+    return INFO;
+
+
+  }
+
+  template <typename Field, typename RealField>
+  inline CB_INT PHEEV(const char JOBZ, const char UPLO, const CB_INT N,
+    Field *A, const CB_INT IA, const CB_INT JA, const CB_INT *DESCA,
+    RealField *W, Field *Z, const CB_INT IZ, const CB_INT JZ, 
+    const CB_INT *DESCZ ) {
+
+    CB_INT LRWORK = 4*N - 2;
+    std::vector< RealField > RWORK(LRWORK);
+
+    CB_INT LWORK = -1;
+    std::vector< Field > WORK(5);
+
+    auto INFO = PHEEV( JOBZ, UPLO, N, A, IA, JA, DESCA, W, Z, IZ, JZ, DESCZ,
+                  WORK.data(), LWORK, RWORK.data(), LRWORK );
+
+    if( INFO == 0) {
+
+      LWORK = CB_INT( std::real(WORK[0]) );
+      WORK.resize(LWORK);
+      INFO = PHEEV( JOBZ, UPLO, N, A, IA, JA, DESCA, W, Z, IZ, JZ, DESCZ,
+               WORK.data(), LWORK, RWORK.data(), LRWORK );
+
+    }
+
+    return INFO;
+
+
+  }
+
+  template <typename Field, typename RealField>
+  inline CB_INT PHEEVD(const char JOBZ, const char UPLO, const CB_INT N,
+    Field *A, const CB_INT IA, const CB_INT JA, const CB_INT *DESCA,
+    RealField *W, Field *Z, const CB_INT IZ, const CB_INT JZ, 
+    const CB_INT *DESCZ) {
+
+    //CB_INT LRWORK = 4*N - 2;
+    //std::vector< RealField > RWORK(LRWORK);
+
+    CB_INT LWORK  = -1;
     CB_INT LIWORK = -1;
+    CB_INT LRWORK = -1;
     std::vector< Field >  WORK(5);
     std::vector< CB_INT > IWORK(5);
+    std::vector< RealField> RWORK(5);
+
+    auto INFO = PHEEVD( JOBZ, UPLO, N, A, IA, JA, DESCA, W, Z, IZ, JZ, DESCZ,
+                  WORK.data(), LWORK, RWORK.data(), LRWORK, IWORK.data(), 
+                  LIWORK );
+
+    if( INFO == 0 ) {
+
+      LWORK  = CB_INT( std::real(WORK[0]) );
+      LIWORK = IWORK[0];
+      LRWORK = RWORK[0];
+      WORK.resize(LWORK);
+      IWORK.resize(LIWORK);
+      RWORK.resize(LRWORK);
+
+      INFO = PHEEVD( JOBZ, UPLO, N, A, IA, JA, DESCA, W, Z, IZ, JZ, DESCZ,
+               WORK.data(), LWORK, RWORK.data(), LRWORK, IWORK.data(), 
+               LIWORK );
+
+    }
+
+    return INFO;
+  }
+
+
+
+  // Conversion from ScaLAPACK_Desc_t -> CB_INT*
+
+  template <typename Field, typename... Args>
+  inline CB_INT PSYEV(const char JOBZ, const char UPLO, const CB_INT N,
+    Field *A, const CB_INT IA, const CB_INT JA, const ScaLAPACK_Desc_t DESCA,
+    Field *W, Field *Z, const CB_INT IZ, const CB_INT JZ, 
+    const ScaLAPACK_Desc_t DESCZ, Args... args) {
+
+    return PSYEV(JOBZ,UPLO,N,A,IA,JA,&DESCA[0],W,Z,IZ,JZ,&DESCZ[0],args...);
+
+  }
+
+  template <typename Field, typename... Args>
+  inline CB_INT PSYEVD(const char JOBZ, const char UPLO, const CB_INT N,
+    Field *A, const CB_INT IA, const CB_INT JA, const ScaLAPACK_Desc_t DESCA,
+    Field *W, Field *Z, const CB_INT IZ, const CB_INT JZ, 
+    const ScaLAPACK_Desc_t DESCZ, Args... args) {
+
+    return PSYEVD(JOBZ,UPLO,N,A,IA,JA,&DESCA[0],W,Z,IZ,JZ,&DESCZ[0],args...);
+
+  }
+
+  template <typename Field, typename RealField, typename... Args>
+  inline CB_INT PHEEV(const char JOBZ, const char UPLO, const CB_INT N,
+    Field *A, const CB_INT IA, const CB_INT JA, const ScaLAPACK_Desc_t DESCA,
+    RealField *W, Field *Z, const CB_INT IZ, const CB_INT JZ, 
+    const ScaLAPACK_Desc_t DESCZ, Args... args) {
+
+    return PHEEV(JOBZ,UPLO,N,A,IA,JA,&DESCA[0],W,Z,IZ,JZ,&DESCZ[0],args...);
+
+  }
+
+  template <typename Field, typename RealField, typename... Args>
+  inline CB_INT PHEEVD(const char JOBZ, const char UPLO, const CB_INT N,
+    Field *A, const CB_INT IA, const CB_INT JA, const ScaLAPACK_Desc_t DESCA,
+    RealField *W, Field *Z, const CB_INT IZ, const CB_INT JZ, 
+    const ScaLAPACK_Desc_t DESCZ, Args... args ) { 
+
+    return PHEEVD(JOBZ,UPLO,N,A,IA,JA,&DESCA[0],W,Z,IZ,JZ,&DESCZ[0],args...);
+
+  }
+
+
+
+
+
+  template <typename Field>
+  inline CB_INT PGESV(const CB_INT N, const CB_INT NRHS, Field *A, 
+    const CB_INT IA, const CB_INT JA, const CB_INT *DESCA, 
+    CB_INT *IPIV, Field *B, const CB_INT IB, const CB_INT JB,
+    const CB_INT *DESCB);
+
+  #define PGESV_IMPL(F,FUNC)\
+  template <>\
+  inline CB_INT PGESV(const CB_INT N, const CB_INT NRHS, F *A, \
+    const CB_INT IA, const CB_INT JA, const CB_INT *DESCA, \
+    CB_INT *IPIV, F *B, const CB_INT IB, const CB_INT JB, \
+    const CB_INT *DESCB) {\
+    \
+    if( SingleProcessDesc(DESCA) ) {\
+      auto INFO = GESV(N,NRHS,LocalSubmatrix(A,IA,JA,DESCA),DESCA[8],\
+        IPIV+IA-1,LocalSubmatrix(B,IB,JB,DESCB),DESCB[8]);\
+      for( CB_INT i = 0; i < N; i++ ) IPIV[IA-1+i] += IA-1;\
+      return INFO;\
+    }\
+    \
+    CB_INT INFO;\
+    FUNC(&N,&NRHS,ToScalapackType(A),&IA,&JA,DESCA,IPIV,ToScalapackType(B),\
+      &IB,&JB,DESCB,&INFO);\
+    return INFO;\
+    \
+  }
+
+  PGESV_IMPL(float                       ,psgesv_);
+  PGESV_IMPL(double                      ,pdgesv_);
+  PGESV_IMPL(std::complex<float> ,pcgesv_);
+  PGESV_IMPL(std::complex<double>,pzgesv_);
+
+  template <typename Field>
+  inline CB_INT PGESV(const CB_INT N, const CB_INT NRHS, Field *A, 
+    const CB_INT IA, const CB_INT JA, const ScaLAPACK_Desc_t DESCA, 
+    CB_INT *IPIV, Field *B, const CB_INT IB, const CB_INT JB,
+    const ScaLAPACK_Desc_t DESCB) {
+
+    return PGESV(N,NRHS,A,IA,JA,&DESCA[0],IPIV,B,IB,JB,&DESCB[0]);
+
+  }
+
+
+  template <typename Field>
+  inline CB_INT PPOTRF(const char UPLO, const CB_INT N, Field *A,
+    const CB_INT IA, const CB_INT JA, const CB_INT *DESCA);
+
+  #define PPOTRF_IMPL(F,FUNC)\
+  template <>\
+  inline CB_INT PPOTRF(const char UPLO, const CB_INT N, F *A,\
+    const CB_INT IA, const CB_INT JA, const CB_INT *DESCA) {\
+    \
+    if( SingleProcessDesc(DESCA) ) \
+      return POTRF(UPLO,N,LocalSubmatrix(A,IA,JA,DESCA),DESCA[8]);\
+    \
+    CB_INT INFO;\
+    FUNC(&UPLO,&N,ToScalapackType(A),&IA,&JA,DESCA,&INFO);\
+    return INFO;\
+    \
+  }
+
+  PPOTRF_IMPL(float                       ,pspotrf_);
+  PPOTRF_IMPL(double                      ,pdpotrf_);
+  PPOTRF_IMPL(std::complex<float> ,pcpotrf_);
+  PPOTRF_IMPL(std::complex<double>,pzpotrf_);
+
+
+  template <typename Field>
+  inline CB_INT PPOTRF(const char UPLO, const CB_INT N, Field *A,
+    const CB_INT IA, const CB_INT JA, const ScaLAPACK_Desc_t DESCA) {
+
+    return PPOTRF(UPLO,N,A,IA,JA,&DESCA[0]);
+
+  }
+
+
+
+
+  /**
+   *  \brief Solve A * X = B with the Cholesky factorization from PPOTRF
+   */
+  template <typename Field>
+  inline CB_INT PPOTRS(const char UPLO, const CB_INT N, const CB_INT NRHS,
+    const Field *A, const CB_INT IA, const CB_INT JA, const CB_INT *DESCA,
+    Field *B, const CB_INT IB, const CB_INT JB, const CB_INT *DESCB);
+
+  #define PPOTRS_IMPL(F,FUNC)\
+  template <>\
+  inline CB_INT PPOTRS(const char UPLO, const CB_INT N, const CB_INT NRHS,\
+    const F *A, const CB_INT IA, const CB_INT JA, const CB_INT *DESCA,\
+    F *B, const CB_INT IB, const CB_INT JB, const CB_INT *DESCB) {\
+    \
+    if( SingleProcessDesc(DESCA) ) \
+      return POTRS(UPLO,N,NRHS,LocalSubmatrix(A,IA,JA,DESCA),DESCA[8],\
+        LocalSubmatrix(B,IB,JB,DESCB),DESCB[8]);\
+    \
+    CB_INT INFO;\
+    FUNC(&UPLO,&N,&NRHS,ToScalapackType(cc(A)),&IA,&JA,DESCA,\
+      ToScalapackType(B),&IB,&JB,DESCB,&INFO);\
+    return INFO;\
+    \
+  }
+
+  PPOTRS_IMPL(float               ,pspotrs_);
+  PPOTRS_IMPL(double              ,pdpotrs_);
+  PPOTRS_IMPL(std::complex<float> ,pcpotrs_);
+  PPOTRS_IMPL(std::complex<double>,pzpotrs_);
+
+
+  template <typename Field>
+  inline CB_INT PPOTRS(const char UPLO, const CB_INT N, const CB_INT NRHS,
+    const Field *A, const CB_INT IA, const CB_INT JA, 
+    const ScaLAPACK_Desc_t DESCA, Field *B, const CB_INT IB, 
+    const CB_INT JB, const ScaLAPACK_Desc_t DESCB) {
+
+    return PPOTRS(UPLO,N,NRHS,A,IA,JA,&DESCA[0],B,IB,JB,&DESCB[0]);
+
+  }
+
+
+
+
+  /**
+   *  \brief LU factorization with partial pivoting of A(IA:IA+M-1,JA:JA+N-1)
+   *
+   *  IPIV holds LOCr(M_A) + MB_A entries (global row indices), see PLAPIV.
+   */
+  template <typename Field>
+  inline CB_INT PGETRF(const CB_INT M, const CB_INT N, Field *A,
+    const CB_INT IA, const CB_INT JA, const CB_INT *DESCA, CB_INT *IPIV);
+
+  #define PGETRF_IMPL(F,FUNC)\
+  template <>\
+  inline CB_INT PGETRF(const CB_INT M, const CB_INT N, F *A,\
+    const CB_INT IA, const CB_INT JA, const CB_INT *DESCA, CB_INT *IPIV) {\
+    \
+    if( SingleProcessDesc(DESCA) ) {\
+      auto INFO = GETRF(M,N,LocalSubmatrix(A,IA,JA,DESCA),DESCA[8],\
+        IPIV+IA-1);\
+      for( CB_INT i = 0; i < std::min(M,N); i++ ) IPIV[IA-1+i] += IA-1;\
+      return INFO;\
+    }\
+    \
+    CB_INT INFO;\
+    FUNC(&M,&N,ToScalapackType(A),&IA,&JA,DESCA,IPIV,&INFO);\
+    return INFO;\
+    \
+  }
+
+  PGETRF_IMPL(float               ,psgetrf_);
+  PGETRF_IMPL(double              ,pdgetrf_);
+  PGETRF_IMPL(std::complex<float> ,pcgetrf_);
+  PGETRF_IMPL(std::complex<double>,pzgetrf_);
+
+
+  template <typename Field>
+  inline CB_INT PGETRF(const CB_INT M, const CB_INT N, Field *A,
+    const CB_INT IA, const CB_INT JA, const ScaLAPACK_Desc_t DESCA, 
+    CB_INT *IPIV) {
+
+    return PGETRF(M,N,A,IA,JA,&DESCA[0],IPIV);
+
+  }
+
+
+
+
+  /**
+   *  \brief Solve op(A) * X = B with the LU factorization from PGETRF
+   */
+  template <typename Field>
+  inline CB_INT PGETRS(const char TRANS, const CB_INT N, const CB_INT NRHS,
+    const Field *A, const CB_INT IA, const CB_INT JA, const CB_INT *DESCA,
+    const CB_INT *IPIV, Field *B, const CB_INT IB, const CB_INT JB,
+    const CB_INT *DESCB);
+
+  #define PGETRS_IMPL(F,FUNC)\
+  template <>\
+  inline CB_INT PGETRS(const char TRANS, const CB_INT N, const CB_INT NRHS,\
+    const F *A, const CB_INT IA, const CB_INT JA, const CB_INT *DESCA,\
+    const CB_INT *IPIV, F *B, const CB_INT IB, const CB_INT JB,\
+    const CB_INT *DESCB) {\
+    \
+    if( SingleProcessDesc(DESCA) ) {\
+      std::vector<CB_INT> LIPIV(IPIV+IA-1,IPIV+IA-1+N);\
+      for( auto &p : LIPIV ) p -= IA-1;\
+      return GETRS(TRANS,N,NRHS,LocalSubmatrix(A,IA,JA,DESCA),DESCA[8],\
+        LIPIV.data(),LocalSubmatrix(B,IB,JB,DESCB),DESCB[8]);\
+    }\
+    \
+    CB_INT INFO;\
+    FUNC(&TRANS,&N,&NRHS,ToScalapackType(cc(A)),&IA,&JA,DESCA,IPIV,\
+      ToScalapackType(B),&IB,&JB,DESCB,&INFO);\
+    return INFO;\
+    \
+  }
+
+  PGETRS_IMPL(float               ,psgetrs_);
+  PGETRS_IMPL(double              ,pdgetrs_);
+  PGETRS_IMPL(std::complex<float> ,pcgetrs_);
+  PGETRS_IMPL(std::complex<double>,pzgetrs_);
+
+
+  template <typename Field>
+  inline CB_INT PGETRS(const char TRANS, const CB_INT N, const CB_INT NRHS,
+    const Field *A, const CB_INT IA, const CB_INT JA, 
+    const ScaLAPACK_Desc_t DESCA, const CB_INT *IPIV, Field *B, 
+    const CB_INT IB, const CB_INT JB, const ScaLAPACK_Desc_t DESCB) {
+
+    return PGETRS(TRANS,N,NRHS,A,IA,JA,&DESCA[0],IPIV,B,IB,JB,&DESCB[0]);
+
+  }
+
+
+
+
+
+  template <typename Field>
+  inline CB_INT PGEQRF(const CB_INT M, const CB_INT N, Field *A,
+    const CB_INT IA, const CB_INT JA, const CB_INT *DESCA, Field *TAU,
+    Field *WORK, const CB_INT LWORK);
+
+  #define PGEQRF_IMPL(F,FUNC)\
+  template <>\
+  inline CB_INT PGEQRF(const CB_INT M, const CB_INT N, F *A,\
+    const CB_INT IA, const CB_INT JA, const CB_INT *DESCA, F *TAU,\
+    F *WORK, const CB_INT LWORK) {\
+    \
+    CB_INT INFO;\
+    FUNC(&M,&N,ToScalapackType(A),&IA,&JA,DESCA,ToScalapackType(TAU),\
+      ToScalapackType(WORK),&LWORK,&INFO);\
+    return INFO;\
+    \
+  }
+
+  PGEQRF_IMPL(float               ,psgeqrf_);
+  PGEQRF_IMPL(double              ,pdgeqrf_);
+  PGEQRF_IMPL(std::complex<float> ,pcgeqrf_);
+  PGEQRF_IMPL(std::complex<double>,pzgeqrf_);
+
+
+  /**
+   *  \brief Apply Q (or Q**H) from a P?GEQRF factorization.
+   *
+   *  Wraps P?UNMQR for complex fields. For real fields P?UNMQR reduces to
+   *  P?ORMQR, and TRANS = 'C' is interpreted as 'T'.
+   */
+  template <typename Field>
+  inline CB_INT PUNMQR(const char SIDE, const char TRANS, const CB_INT M,
+    const CB_INT N, const CB_INT K, const Field *A, const CB_INT IA,
+    const CB_INT JA, const CB_INT *DESCA, const Field *TAU, Field *C,
+    const CB_INT IC, const CB_INT JC, const CB_INT *DESCC, Field *WORK,
+    const CB_INT LWORK);
+
+  #define PORMQR_IMPL(F,FUNC)\
+  template <>\
+  inline CB_INT PUNMQR(const char SIDE, const char TRANS, const CB_INT M,\
+    const CB_INT N, const CB_INT K, const F *A, const CB_INT IA,\
+    const CB_INT JA, const CB_INT *DESCA, const F *TAU, F *C,\
+    const CB_INT IC, const CB_INT JC, const CB_INT *DESCC, F *WORK,\
+    const CB_INT LWORK) {\
+    \
+    const char TRANS_R = ( TRANS == 'C' or TRANS == 'c' ) ? 'T' : TRANS;\
+    CB_INT INFO;\
+    FUNC(&SIDE,&TRANS_R,&M,&N,&K,A,&IA,&JA,DESCA,TAU,C,&IC,&JC,DESCC,\
+      WORK,&LWORK,&INFO);\
+    return INFO;\
+    \
+  }
+
+  #define PUNMQR_IMPL(F,FUNC)\
+  template <>\
+  inline CB_INT PUNMQR(const char SIDE, const char TRANS, const CB_INT M,\
+    const CB_INT N, const CB_INT K, const F *A, const CB_INT IA,\
+    const CB_INT JA, const CB_INT *DESCA, const F *TAU, F *C,\
+    const CB_INT IC, const CB_INT JC, const CB_INT *DESCC, F *WORK,\
+    const CB_INT LWORK) {\
+    \
+    CB_INT INFO;\
+    FUNC(&SIDE,&TRANS,&M,&N,&K,ToScalapackType(A),&IA,&JA,DESCA,\
+      ToScalapackType(TAU),ToScalapackType(C),&IC,&JC,DESCC,\
+      ToScalapackType(WORK),&LWORK,&INFO);\
+    return INFO;\
+    \
+  }
+
+  PORMQR_IMPL(float               ,psormqr_);
+  PORMQR_IMPL(double              ,pdormqr_);
+  PUNMQR_IMPL(std::complex<float> ,pcunmqr_);
+  PUNMQR_IMPL(std::complex<double>,pzunmqr_);
+
+  // LWORK obtaining variants
+
+  template <typename Field>
+  inline CB_INT PGEQRF(const CB_INT M, const CB_INT N, Field *A,
+    const CB_INT IA, const CB_INT JA, const CB_INT *DESCA, Field *TAU) {
+
+    CB_INT LWORK = -1;
+    std::vector< Field > WORK(5);
+
+    auto INFO = PGEQRF( M, N, A, IA, JA, DESCA, TAU, WORK.data(), LWORK );
+
+    if( INFO == 0 ) {
+
+      LWORK = CB_INT( std::real(WORK[0]) );
+      WORK.resize(LWORK);
+      INFO = PGEQRF( M, N, A, IA, JA, DESCA, TAU, WORK.data(), LWORK );
+
+    }
+
+    return INFO;
+
+  }
+
+  template <typename Field>
+  inline CB_INT PUNMQR(const char SIDE, const char TRANS, const CB_INT M,
+    const CB_INT N, const CB_INT K, const Field *A, const CB_INT IA,
+    const CB_INT JA, const CB_INT *DESCA, const Field *TAU, Field *C,
+    const CB_INT IC, const CB_INT JC, const CB_INT *DESCC) {
+
+    CB_INT LWORK = -1;
+    std::vector< Field > WORK(5);
+
+    auto INFO = PUNMQR( SIDE, TRANS, M, N, K, A, IA, JA, DESCA, TAU, 
+                  C, IC, JC, DESCC, WORK.data(), LWORK );
+
+    if( INFO == 0 ) {
+
+      LWORK = CB_INT( std::real(WORK[0]) );
+      WORK.resize(LWORK);
+      INFO = PUNMQR( SIDE, TRANS, M, N, K, A, IA, JA, DESCA, TAU, 
+               C, IC, JC, DESCC, WORK.data(), LWORK );
+
+    }
+
+    return INFO;
+
+  }
 
-    auto INFO = PSYEVD( JOBZ, UPLO, N, A, IA, JA, DESCA, W, Z, IZ, JZ, DESCZ,
-                  WORK.data(), LWORK, IWORK.data(), LIWORK );
+  // Conversion from ScaLAPACK_Desc_t -> CB_INT*
 
-    if( INFO == 0 ) {
+  template <typename Field, typename... Args>
+  inline CB_INT PGEQRF(const CB_INT M, const CB_INT N, Field *A,
+    const CB_INT IA, const CB_INT JA, const ScaLAPACK_Desc_t DESCA, 
+    Field *TAU, Args... args) {
 
-      LWORK  = CB_INT( WORK[0] );
-      LIWORK = IWORK[0];
-      WORK.resize(LWORK);
-      IWORK.resize(LIWORK);
+    return PGEQRF(M,N,A,IA,JA,&DESCA[0],TAU,args...);
 
-      INFO = PSYEVD( JOBZ, UPLO, N, A, IA, JA, DESCA, W, Z, IZ, JZ, DESCZ,
-               WORK.data(), LWORK, IWORK.data(), LIWORK );
+  }
+
+  template <typename Field, typename... Args>
+  inline CB_INT PUNMQR(const char SIDE, const char TRANS, const CB_INT M,
+    const CB_INT N, const CB_INT K, const Field *A, const CB_INT IA,
+    const CB_INT JA, const ScaLAPACK_Desc_t DESCA, const Field *TAU, 
+    Field *C, const CB_INT IC, const CB_INT JC, 
+    const ScaLAPACK_Desc_t DESCC, Args... args) {
+
+    return PUNMQR(SIDE,TRANS,M,N,K,A,IA,JA,&DESCA[0],TAU,C,IC,JC,&DESCC[0],
+      args...);
+
+  }
 
-    }
 
-    return INFO;
 
 
+  /**
+   *  \brief Form the explicit Q from a P?GEQRF factorization.
+   *
+   *  Wraps P?UNGQR for complex fields. For real fields P?UNGQR reduces to
+   *  P?ORGQR.
+   */
+  template <typename Field>
+  inline CB_INT PUNGQR(const CB_INT M, const CB_INT N, const CB_INT K, 
+    Field *A, const CB_INT IA, const CB_INT JA, const CB_INT *DESCA, 
+    const Field *TAU, Field *WORK, const CB_INT LWORK);
+
+  #define PUNGQR_IMPL(F,FUNC)\
+  template <>\
+  inline CB_INT PUNGQR(const CB_INT M, const CB_INT N, const CB_INT K,\
+    F *A, const CB_INT IA, const CB_INT JA, const CB_INT *DESCA,\
+    const F *TAU, F *WORK, const CB_INT LWORK) {\
+    \
+    CB_INT INFO;\
+    FUNC(&M,&N,&K,ToScalapackType(A),&IA,&JA,DESCA,ToScalapackType(TAU),\
+      ToScalapackType(WORK),&LWORK,&INFO);\
+    return INFO;\
+    \
   }
 
-  template <typename Field, typename RealField>
-  inline CB_INT PHEEV(const char JOBZ, const char UPLO, const CB_INT N,
-    Field *A, const CB_INT IA, const CB_INT JA, const CB_INT *DESCA,
-    RealField *W, Field *Z, const CB_INT IZ, const CB_INT JZ, 
-    const CB_INT *DESCZ ) {
+  PUNGQR_IMPL(float               ,psorgqr_);
+  PUNGQR_IMPL(double              ,pdorgqr_);
+  PUNGQR_IMPL(std::complex<float> ,pcungqr_);
+  PUNGQR_IMPL(std::complex<double>,pzungqr_);
 
-    CB_INT LRWORK = 4*N - 2;
-    std::vector< RealField > RWORK(LRWORK);
+  // LWORK obtaining variant
+
+  template <typename Field>
+  inline CB_INT PUNGQR(const CB_INT M, const CB_INT N, const CB_INT K, 
+    Field *A, const CB_INT IA, const CB_INT JA, const CB_INT *DESCA, 
+    const Field *TAU) {
 
     CB_INT LWORK = -1;
     std::vector< Field > WORK(5);
 
-    auto INFO = PHEEV( JOBZ, UPLO, N, A, IA, JA, DESCA, W, Z, IZ, JZ, DESCZ,
-                  WORK.data(), LWORK, RWORK.data(), LRWORK );
+    auto INFO = PUNGQR( M, N, K, A, IA, JA, DESCA, TAU, WORK.data(), LWORK );
 
-    if( INFO == 0) {
+    if( INFO == 0 ) {
 
       LWORK = CB_INT( std::real(WORK[0]) );
       WORK.resize(LWORK);
-      INFO = PHEEV( JOBZ, UPLO, N, A, IA, JA, DESCA, W, Z, IZ, JZ, DESCZ,
-               WORK.data(), LWORK, RWORK.data(), LRWORK );
+      INFO = PUNGQR( M, N, K, A, IA, JA, DESCA, TAU, WORK.data(), LWORK );
 
     }
 
     return INFO;
 
+  }
+
+  // Conversion from ScaLAPACK_Desc_t -> CB_INT*
+
+  template <typename Field, typename... Args>
+  inline CB_INT PUNGQR(const CB_INT M, const CB_INT N, const CB_INT K, 
+    Field *A, const CB_INT IA, const CB_INT JA, const ScaLAPACK_Desc_t DESCA,
+    const Field *TAU, Args... args) {
+
+    return PUNGQR(M,N,K,A,IA,JA,&DESCA[0],TAU,args...);
 
   }
 
-  template <typename Field, typename RealField>
-  inline CB_INT PHEEVD(const char JOBZ, const char UPLO, const CB_INT N,
-    Field *A, const CB_INT IA, const CB_INT JA, const CB_INT *DESCA,
-    RealField *W, Field *Z, const CB_INT IZ, const CB_INT JZ, 
-    const CB_INT *DESCZ) {
+  // P?ORMQR / P?ORGQR naming for real fields
 
-    //CB_INT LRWORK = 4*N - 2;
-    //std::vector< RealField > RWORK(LRWORK);
+  template <typename... Args>
+  inline CB_INT PORMQR(Args... args) { return PUNMQR(args...); }
+
+  template <typename... Args>
+  inline CB_INT PORGQR(Args... args) { return PUNGQR(args...); }
+
+
+
+
+  template <typename Field>
+  inline CB_INT PSTEDC(const char COMPZ, const CB_INT N, Field *D, Field *E,
+    Field *Q, const CB_INT IQ, const CB_INT JQ, const CB_INT *DESCQ,
+    Field *WORK, const CB_INT LWORK, CB_INT *IWORK, const CB_INT LIWORK);
+
+  #define PSTEDC_IMPL(F,FUNC)\
+  template <>\
+  inline CB_INT PSTEDC(const char COMPZ, const CB_INT N, F *D, F *E,\
+    F *Q, const CB_INT IQ, const CB_INT JQ, const CB_INT *DESCQ,\
+    F *WORK, const CB_INT LWORK, CB_INT *IWORK, const CB_INT LIWORK) {\
+    \
+    CB_INT INFO;\
+    FUNC(&COMPZ,&N,D,E,Q,&IQ,&JQ,DESCQ,WORK,&LWORK,IWORK,&LIWORK,&INFO);\
+    return INFO;\
+    \
+  }
+
+  PSTEDC_IMPL(float ,psstedc_);
+  PSTEDC_IMPL(double,pdstedc_);
+
+  template <typename Field>
+  inline CB_INT PSTEDC(const char COMPZ, const CB_INT N, Field *D, Field *E,
+    Field *Q, const CB_INT IQ, const CB_INT JQ, const CB_INT *DESCQ) {
 
     CB_INT LWORK  = -1;
     CB_INT LIWORK = -1;
-    CB_INT LRWORK = -1;
     std::vector< Field >  WORK(5);
     std::vector< CB_INT > IWORK(5);
-    std::vector< RealField> RWORK(5);
 
-    auto INFO = PHEEVD( JOBZ, UPLO, N, A, IA, JA, DESCA, W, Z, IZ, JZ, DESCZ,
-                  WORK.data(), LWORK, RWORK.data(), LRWORK, IWORK.data(), 
-                  LIWORK );
+    auto INFO = PSTEDC( COMPZ, N, D, E, Q, IQ, JQ, DESCQ, WORK.data(), LWORK,
+                  IWORK.data(), LIWORK );
 
     if( INFO == 0 ) {
 
-      LWORK  = CB_INT( std::real(WORK[0]) );
+      LWORK  = CB_INT( WORK[0] );
       LIWORK = IWORK[0];
-      LRWORK = RWORK[0];
       WORK.resize(LWORK);
       IWORK.resize(LIWORK);
-      RWORK.resize(LRWORK);
 
-      INFO = PHEEVD( JOBZ, UPLO, N, A, IA, JA, DESCA, W, Z, IZ, JZ, DESCZ,
-               WORK.data(), LWORK, RWORK.data(), LRWORK, IWORK.data(), 
-               LIWORK );
+      INFO = PSTEDC( COMPZ, N, D, E, Q, IQ, JQ, DESCQ, WORK.data(), LWORK,
+               IWORK.data(), LIWORK );
 
     }
 
     return INFO;
+
   }
 
+  template <typename Field, typename... Args>
+  inline CB_INT PSTEDC(const char COMPZ, const CB_INT N, Field *D, Field *E,
+    Field *Q, const CB_INT IQ, const CB_INT JQ, const ScaLAPACK_Desc_t DESCQ,
+    Args... args) {
 
+    return PSTEDC(COMPZ,N,D,E,Q,IQ,JQ,&DESCQ[0],args...);
 
-  // Conversion from ScaLAPACK_Desc_t -> CB_INT*
+  }
 
-  template <typename Field, typename... Args>
-  inline CB_INT PSYEV(const char JOBZ, const char UPLO, const CB_INT N,
-    Field *A, const CB_INT IA, const CB_INT JA, const ScaLAPACK_Desc_t DESCA,
-    Field *W, Field *Z, const CB_INT IZ, const CB_INT JZ, 
-    const ScaLAPACK_Desc_t DESCZ, Args... args) {
 
-    return PSYEV(JOBZ,UPLO,N,A,IA,JA,&DESCA[0],W,Z,IZ,JZ,&DESCZ[0],args...);
+
+
+
+  template <typename Field>
+  inline CB_INT PTRTRI(const char UPLO, const char DIAG, const CB_INT N,
+    Field *A, const CB_INT IA, const CB_INT JA, const CB_INT *DESCA);
+
+  #define PTRTRI_IMPL(F,FUNC)\
+  template <>\
+  inline CB_INT PTRTRI(const char UPLO, const char DIAG, const CB_INT N,\
+    F *A, const CB_INT IA, const CB_INT JA, const CB_INT *DESCA) {\
+    \
+    CB_INT INFO;\
+    FUNC(&UPLO,&DIAG,&N,ToScalapackType(A),&IA,&JA,DESCA,&INFO);\
+    return INFO;\
+    \
+  }
+
+  PTRTRI_IMPL(float               ,pstrtri_);
+  PTRTRI_IMPL(double              ,pdtrtri_);
+  PTRTRI_IMPL(std::complex<float> ,pctrtri_);
+  PTRTRI_IMPL(std::complex<double>,pztrtri_);
+
+  template <typename Field>
+  inline CB_INT PTRTRI(const char UPLO, const char DIAG, const CB_INT N,
+    Field *A, const CB_INT IA, const CB_INT JA, 
+    const ScaLAPACK_Desc_t DESCA) {
+
+    return PTRTRI(UPLO,DIAG,N,A,IA,JA,&DESCA[0]);
+
+  }
+
+
+
+
+  /**
+   *  \brief Workspace size which is sufficient for all NORM types of
+   *  the P?LAN?? family (row and column reductions, plus the LCM
+   *  redistribution of P?LANSY / P?LANHE on non-square grids).
+   */
+  inline CB_INT PLANWorkSize(const CB_INT *DESCA) {
+
+    CB_INT NPROW, NPCOL, MYROW, MYCOL;
+    Cblacs_gridinfo(DESCA[1],&NPROW,&NPCOL,&MYROW,&MYCOL);
+
+    const CB_INT NP0 = 
+      NumRoc(DESCA[2],DESCA[4],MYROW,DESCA[6],NPROW) + DESCA[4];
+    const CB_INT NQ0 = 
+      NumRoc(DESCA[3],DESCA[5],MYCOL,DESCA[7],NPCOL) + DESCA[5];
+
+    return 2*NQ0 + 2*NP0 + DESCA[4];
+
+  }
+
+  template <typename Field, 
+            typename RealField = typename CXXBLACS_REAL_TYPE<Field>::type>
+  inline RealField PLANGE(const char NORM, const CB_INT M, const CB_INT N,
+    const Field *A, const CB_INT IA, const CB_INT JA, const CB_INT *DESCA,
+    RealField *WORK);
+
+  #define PLANGE_IMPL(F,RF,FUNC)\
+  template <>\
+  inline RF PLANGE(const char NORM, const CB_INT M, const CB_INT N,\
+    const F *A, const CB_INT IA, const CB_INT JA, const CB_INT *DESCA,\
+    RF *WORK) {\
+    \
+    return FUNC(&NORM,&M,&N,ToScalapackType(A),&IA,&JA,DESCA,WORK);\
+    \
+  }
+
+  PLANGE_IMPL(float               ,float ,pslange_);
+  PLANGE_IMPL(double              ,double,pdlange_);
+  PLANGE_IMPL(std::complex<float> ,float ,pclange_);
+  PLANGE_IMPL(std::complex<double>,double,pzlange_);
+
+  // WORK allocating variant
+
+  template <typename Field, 
+            typename RealField = typename CXXBLACS_REAL_TYPE<Field>::type>
+  inline RealField PLANGE(const char NORM, const CB_INT M, const CB_INT N,
+    const Field *A, const CB_INT IA, const CB_INT JA, const CB_INT *DESCA) {
+
+    std::vector< RealField > WORK(PLANWorkSize(DESCA));
+
+    return PLANGE(NORM,M,N,A,IA,JA,DESCA,WORK.data());
 
   }
 
   template <typename Field, typename... Args>
-  inline CB_INT PSYEVD(const char JOBZ, const char UPLO, const CB_INT N,
-    Field *A, const CB_INT IA, const CB_INT JA, const ScaLAPACK_Desc_t DESCA,
-    Field *W, Field *Z, const CB_INT IZ, const CB_INT JZ, 
-    const ScaLAPACK_Desc_t DESCZ, Args... args) {
+  inline typename CXXBLACS_REAL_TYPE<Field>::type PLANGE(const char NORM, 
+    const CB_INT M, const CB_INT N, const Field *A, const CB_INT IA, 
+    const CB_INT JA, const ScaLAPACK_Desc_t DESCA, Args... args) {
 
-    return PSYEVD(JOBZ,UPLO,N,A,IA,JA,&DESCA[0],W,Z,IZ,JZ,&DESCZ[0],args...);
+    return PLANGE(NORM,M,N,A,IA,JA,&DESCA[0],args...);
 
   }
 
-  template <typename Field, typename RealField, typename... Args>
-  inline CB_INT PHEEV(const char JOBZ, const char UPLO, const CB_INT N,
-    Field *A, const CB_INT IA, const CB_INT JA, const ScaLAPACK_Desc_t DESCA,
-    RealField *W, Field *Z, const CB_INT IZ, const CB_INT JZ, 
-    const ScaLAPACK_Desc_t DESCZ, Args... args) {
 
-    return PHEEV(JOBZ,UPLO,N,A,IA,JA,&DESCA[0],W,Z,IZ,JZ,&DESCZ[0],args...);
 
+  template <typename Field, 
+            typename RealField = typename CXXBLACS_REAL_TYPE<Field>::type>
+  inline RealField PLANSY(const char NORM, const char UPLO, const CB_INT N,
+    const Field *A, const CB_INT IA, const CB_INT JA, const CB_INT *DESCA,
+    RealField *WORK);
+
+  template <typename Field, 
+            typename RealField = typename CXXBLACS_REAL_TYPE<Field>::type>
+  inline RealField PLANHE(const char NORM, const char UPLO, const CB_INT N,
+    const Field *A, const CB_INT IA, const CB_INT JA, const CB_INT *DESCA,
+    RealField *WORK);
+
+  #define PLANSY_IMPL(NAME,F,RF,FUNC)\
+  template <>\
+  inline RF NAME(const char NORM, const char UPLO, const CB_INT N,\
+    const F *A, const CB_INT IA, const CB_INT JA, const CB_INT *DESCA,\
+    RF *WORK) {\
+    \
+    return FUNC(&NORM,&UPLO,&N,ToScalapackType(A),&IA,&JA,DESCA,WORK);\
+    \
   }
 
-  template <typename Field, typename RealField, typename... Args>
-  inline CB_INT PHEEVD(const char JOBZ, const char UPLO, const CB_INT N,
-    Field *A, const CB_INT IA, const CB_INT JA, const ScaLAPACK_Desc_t DESCA,
-    RealField *W, Field *Z, const CB_INT IZ, const CB_INT JZ, 
-    const ScaLAPACK_Desc_t DESCZ, Args... args ) { 
+  PLANSY_IMPL(PLANSY,float               ,float ,pslansy_);
+  PLANSY_IMPL(PLANSY,double              ,double,pdlansy_);
+  PLANSY_IMPL(PLANSY,std::complex<float> ,float ,pclansy_);
+  PLANSY_IMPL(PLANSY,std::complex<double>,double,pzlansy_);
 
-    return PHEEVD(JOBZ,UPLO,N,A,IA,JA,&DESCA[0],W,Z,IZ,JZ,&DESCZ[0],args...);
+  PLANSY_IMPL(PLANHE,float               ,float ,pslansy_);
+  PLANSY_IMPL(PLANHE,double              ,double,pdlansy_);
+  PLANSY_IMPL(PLANHE,std::complex<float> ,float ,pclanhe_);
+  PLANSY_IMPL(PLANHE,std::complex<double>,double,pzlanhe_);
+
+  // WORK allocating variants
+
+  template <typename Field, 
+            typename RealField = typename CXXBLACS_REAL_TYPE<Field>::type>
+  inline RealField PLANSY(const char NORM, const char UPLO, const CB_INT N,
+    const Field *A, const CB_INT IA, const CB_INT JA, const CB_INT *DESCA) {
+
+    std::vector< RealField > WORK(PLANWorkSize(DESCA));
+
+    return PLANSY(NORM,UPLO,N,A,IA,JA,DESCA,WORK.data());
 
   }
 
+  template <typename Field, 
+            typename RealField = typename CXXBLACS_REAL_TYPE<Field>::type>
+  inline RealField PLANHE(const char NORM, const char UPLO, const CB_INT N,
+    const Field *A, const CB_INT IA, const CB_INT JA, const CB_INT *DESCA) {
 
+    std::vector< RealField > WORK(PLANWorkSize(DESCA));
 
+    return PLANHE(NORM,UPLO,N,A,IA,JA,DESCA,WORK.data());
 
+  }
 
-  template <typename Field>
-  inline CB_INT PGESV(const CB_INT N, const CB_INT NRHS, Field *A, 
-    const CB_INT IA, const CB_INT JA, const CB_INT *DESCA, 
-    CB_INT *IPIV, Field *B, const CB_INT IB, const CB_INT JB,
-    const CB_INT *DESCB);
+  template <typename Field, typename... Args>
+  inline typename CXXBLACS_REAL_TYPE<Field>::type PLANSY(const char NORM, 
+    const char UPLO, const CB_INT N, const Field *A, const CB_INT IA, 
+    const CB_INT JA, const ScaLAPACK_Desc_t DESCA, Args... args) {
 
-  #define PGESV_IMPL(F,FUNC)\
+    return PLANSY(NORM,UPLO,N,A,IA,JA,&DESCA[0],args...);
+
+  }
+
+  template <typename Field, typename... Args>
+  inline typename CXXBLACS_REAL_TYPE<Field>::type PLANHE(const char NORM, 
+    const char UPLO, const CB_INT N, const Field *A, const CB_INT IA, 
+    const CB_INT JA, const ScaLAPACK_Desc_t DESCA, Args... args) {
+
+    return PLANHE(NORM,UPLO,N,A,IA,JA,&DESCA[0],args...);
+
+  }
+
+
+
+  template <typename Field, 
+            typename RealField = typename CXXBLACS_REAL_TYPE<Field>::type>
+  inline RealField PLANTR(const char NORM, const char UPLO, const char DIAG,
+    const CB_INT M, const CB_INT N, const Field *A, const CB_INT IA, 
+    const CB_INT JA, const CB_INT *DESCA, RealField *WORK);
+
+  #define PLANTR_IMPL(F,RF,FUNC)\
   template <>\
-  inline CB_INT PGESV(const CB_INT N, const CB_INT NRHS, F *A, \
-    const CB_INT IA, const CB_INT JA, const CB_INT *DESCA, \
-    CB_INT *IPIV, F *B, const CB_INT IB, const CB_INT JB, \
-    const CB_INT *DESCB) {\
+  inline RF PLANTR(const char NORM, const char UPLO, const char DIAG,\
+    const CB_INT M, const CB_INT N, const F *A, const CB_INT IA,\
+    const CB_INT JA, const CB_INT *DESCA, RF *WORK) {\
     \
-    CB_INT INFO;\
-    FUNC(&N,&NRHS,ToScalapackType(A),&IA,&JA,DESCA,IPIV,ToScalapackType(B),\
-      &IB,&JB,DESCB,&INFO);\
-    return INFO;\
+    return FUNC(&NORM,&UPLO,&DIAG,&M,&N,ToScalapackType(A),&IA,&JA,DESCA,\
+      WORK);\
     \
   }
 
-  PGESV_IMPL(float                       ,psgesv_);
-  PGESV_IMPL(double                      ,pdgesv_);
-  PGESV_IMPL(std::complex<float> ,pcgesv_);
-  PGESV_IMPL(std::complex<double>,pzgesv_);
+  PLANTR_IMPL(float               ,float ,pslantr_);
+  PLANTR_IMPL(double              ,double,pdlantr_);
+  PLANTR_IMPL(std::complex<float> ,float ,pclantr_);
+  PLANTR_IMPL(std::complex<double>,double,pzlantr_);
 
-  template <typename Field>
-  inline CB_INT PGESV(const CB_INT N, const CB_INT NRHS, Field *A, 
-    const CB_INT IA, const CB_INT JA, const ScaLAPACK_Desc_t DESCA, 
-    CB_INT *IPIV, Field *B, const CB_INT IB, const CB_INT JB,
-    const ScaLAPACK_Desc_t DESCB) {
+  // WORK allocating variant
 
-    return PGESV(N,NRHS,A,IA,JA,&DESCA[0],IPIV,B,IB,JB,&DESCB[0]);
+  template <typename Field, 
+            typename RealField = typename CXXBLACS_REAL_TYPE<Field>::type>
+  inline RealField PLANTR(const char NORM, const char UPLO, const char DIAG,
+    const CB_INT M, const CB_INT N, const Field *A, const CB_INT IA, 
+    const CB_INT JA, const CB_INT *DESCA) {
+
+    std::vector< RealField > WORK(PLANWorkSize(DESCA));
+
+    return PLANTR(NORM,UPLO,DIAG,M,N,A,IA,JA,DESCA,WORK.data());
 
   }
 
+  template <typename Field, typename... Args>
+  inline typename CXXBLACS_REAL_TYPE<Field>::type PLANTR(const char NORM, 
+    const char UPLO, const char DIAG, const CB_INT M, const CB_INT N, 
+    const Field *A, const CB_INT IA, const CB_INT JA, 
+    const ScaLAPACK_Desc_t DESCA, Args... args) {
 
-  template <typename Field>
-  inline CB_INT PPOTRF(const char UPLO, const CB_INT N, Field *A,
-    const CB_INT IA, const CB_INT JA, const CB_INT *DESCA);
+    return PLANTR(NORM,UPLO,DIAG,M,N,A,IA,JA,&DESCA[0],args...);
 
-  #define PPOTRF_IMPL(F,FUNC)\
+  }
+
+
+
+
+  /**
+   *  \brief Singular value decomposition of a general distributed matrix
+   *
+   *  JOBU = 'V' (JOBVT = 'V') computes the leading min(M,N) left (right)
+   *  singular vectors, 'N' skips them entirely, in which case U (VT) is not
+   *  referenced and may be passed as nullptr (along with its descriptor).
+   *  RWORK is only referenced for complex fields.
+   */
+  template <typename Field, typename RealField>
+  inline CB_INT PGESVD(const char JOBU, const char JOBVT, const CB_INT M,
+    const CB_INT N, Field *A, const CB_INT IA, const CB_INT JA, 
+    const CB_INT *DESCA, RealField *S, Field *U, const CB_INT IU, 
+    const CB_INT JU, const CB_INT *DESCU, Field *VT, const CB_INT IVT,
+    const CB_INT JVT, const CB_INT *DESCVT, Field *WORK, const CB_INT LWORK,
+    RealField *RWORK);
+
+  #define PGESVD_IMPL(F,FUNC)\
   template <>\
-  inline CB_INT PPOTRF(const char UPLO, const CB_INT N, F *A,\
-    const CB_INT IA, const CB_INT JA, const CB_INT *DESCA) {\
+  inline CB_INT PGESVD(const char JOBU, const char JOBVT, const CB_INT M,\
+    const CB_INT N, F *A, const CB_INT IA, const CB_INT JA,\
+    const CB_INT *DESCA, F *S, F *U, const CB_INT IU, const CB_INT JU,\
+    const CB_INT *DESCU, F *VT, const CB_INT IVT, const CB_INT JVT,\
+    const CB_INT *DESCVT, F *WORK, const CB_INT LWORK, F * /* RWORK */) {\
     \
     CB_INT INFO;\
-    FUNC(&UPLO,&N,ToScalapackType(A),&IA,&JA,DESCA,&INFO);\
+    FUNC(&JOBU,&JOBVT,&M,&N,A,&IA,&JA,DESCA,S,U,&IU,&JU,\
+      DESCU ? DESCU : DESCA,VT,&IVT,&JVT,DESCVT ? DESCVT : DESCA,\
+      WORK,&LWORK,&INFO);\
     return INFO;\
     \
   }
 
-  PPOTRF_IMPL(float                       ,pspotrf_);
-  PPOTRF_IMPL(double                      ,pdpotrf_);
-  PPOTRF_IMPL(std::complex<float> ,pcpotrf_);
-  PPOTRF_IMPL(std::complex<double>,pzpotrf_);
+  #define PCGESVD_IMPL(F,RF,FUNC)\
+  template <>\
+  inline CB_INT PGESVD(const char JOBU, const char JOBVT, const CB_INT M,\
+    const CB_INT N, F *A, const CB_INT IA, const CB_INT JA,\
+    const CB_INT *DESCA, RF *S, F *U, const CB_INT IU, const CB_INT JU,\
+    const CB_INT *DESCU, F *VT, const CB_INT IVT, const CB_INT JVT,\
+    const CB_INT *DESCVT, F *WORK, const CB_INT LWORK, RF *RWORK) {\
+    \
+    CB_INT INFO;\
+    FUNC(&JOBU,&JOBVT,&M,&N,ToScalapackType(A),&IA,&JA,DESCA,S,\
+      ToScalapackType(U),&IU,&JU,DESCU ? DESCU : DESCA,ToScalapackType(VT),\
+      &IVT,&JVT,DESCVT ? DESCVT : DESCA,ToScalapackType(WORK),&LWORK,RWORK,\
+      &INFO);\
+    return INFO;\
+    \
+  }
 
+  PGESVD_IMPL(float ,psgesvd_);
+  PGESVD_IMPL(double,pdgesvd_);
 
-  template <typename Field>
-  inline CB_INT PPOTRF(const char UPLO, const CB_INT N, Field *A,
-    const CB_INT IA, const CB_INT JA, const ScaLAPACK_Desc_t DESCA) {
+  PCGESVD_IMPL(std::complex<float> ,float ,pcgesvd_);
+  PCGESVD_IMPL(std::complex<double>,double,pzgesvd_);
 
-    return PPOTRF(UPLO,N,A,IA,JA,&DESCA[0]);
+  // LWORK obtaining variant
+
+  template <typename Field, typename RealField>
+  inline CB_INT PGESVD(const char JOBU, const char JOBVT, const CB_INT M,
+    const CB_INT N, Field *A, const CB_INT IA, const CB_INT JA, 
+    const CB_INT *DESCA, RealField *S, Field *U, const CB_INT IU, 
+    const CB_INT JU, const CB_INT *DESCU, Field *VT, const CB_INT IVT,
+    const CB_INT JVT, const CB_INT *DESCVT) {
+
+    // RWORK is only required for complex fields
+    CB_INT LRWORK = std::is_same<Field,RealField>::value ? 
+                      1 : 1 + 4*std::max(M,N);
+    std::vector< RealField > RWORK(LRWORK);
+
+    CB_INT LWORK = -1;
+    std::vector< Field > WORK(5);
+
+    auto INFO = PGESVD( JOBU, JOBVT, M, N, A, IA, JA, DESCA, S, U, IU, JU,
+                  DESCU, VT, IVT, JVT, DESCVT, WORK.data(), LWORK, 
+                  RWORK.data() );
+
+    if( INFO == 0 ) {
+
+      LWORK = CB_INT( std::real(WORK[0]) );
+      WORK.resize(LWORK);
+      INFO = PGESVD( JOBU, JOBVT, M, N, A, IA, JA, DESCA, S, U, IU, JU,
+               DESCU, VT, IVT, JVT, DESCVT, WORK.data(), LWORK, 
+               RWORK.data() );
+
+    }
+
+    return INFO;
+
+  }
+
+  // Conversion from ScaLAPACK_Desc_t -> CB_INT*
+
+  template <typename Field, typename RealField, typename... Args>
+  inline CB_INT PGESVD(const char JOBU, const char JOBVT, const CB_INT M,
+    const CB_INT N, Field *A, const CB_INT IA, const CB_INT JA, 
+    const ScaLAPACK_Desc_t DESCA, RealField *S, Field *U, const CB_INT IU, 
+    const CB_INT JU, const ScaLAPACK_Desc_t DESCU, Field *VT, 
+    const CB_INT IVT, const CB_INT JVT, const ScaLAPACK_Desc_t DESCVT, 
+    Args... args) {
+
+    return PGESVD(JOBU,JOBVT,M,N,A,IA,JA,&DESCA[0],S,U,IU,JU,&DESCU[0],
+      VT,IVT,JVT,&DESCVT[0],args...);
 
   }
 
@@ -0,0 +1,268 @@
+/*
+ *  A simple C++ Wrapper for BLACS along with minimal extra functionality to 
+ *  aid the the high-level development of distributed memory linear algebra.
+ *  Copyright (C) 2016-2018 David Williams-Young
+
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "algorithms_ut.hpp"
+
+template <typename Field, typename RealType>
+void adaptive_eig_test( const AdaptiveGridPolicy &POLICY, CB_INT N ) {
+
+  // Synchronize processes
+  MPI_Barrier(MPI_COMM_WORLD);
+
+  BlacsGrid grid(MPI_COMM_WORLD,4,4);
+
+  std::vector<Field> A, ALoc, ARef, ZLoc, ZRef, AZ;
+  std::vector<RealType> W(N), WRef(N);
+
+  CB_INT MLoc, NLoc;
+  std::tie(MLoc,NLoc) = grid.getLocalDims(N,N);
+
+  ALoc.resize(MLoc * NLoc);
+  ZLoc.resize(MLoc * NLoc);
+  ZRef.resize(MLoc * NLoc);
+  AZ.resize(MLoc * NLoc);
+
+  auto DescA = grid.descInit(N,N,0,0,MLoc);
+
+  // Hermitian matrix on root
+  A = hermitian<Field>(N);
+
+  grid.Scatter(N,N,A.data(),N,ALoc.data(),MLoc,0,0);
+  ARef = ALoc;
+  std::vector<Field> AOrig(ALoc);
+
+  EXPECT_EQ( (PHEEVD_ADAPTIVE(grid,'V','L',N,ALoc.data(),MLoc,W.data(),
+    ZLoc.data(),MLoc,POLICY)), 0 );
+
+  EXPECT_EQ( (PHEEVD('V','L',N,ARef.data(),1,1,DescA,WRef.data(),
+    ZRef.data(),1,1,DescA)), 0 );
+
+  // Eigenvalues agree with the full grid solve
+  for( CB_INT i = 0; i < N; i++ ) EXPECT_NEAR( W[i], WRef[i], 1e-10 );
+
+  // A * Z = Z * diag(W)
+  PGEMM('N','N',N,N,N,Field(1.),AOrig.data(),1,1,DescA,ZLoc.data(),1,1,
+    DescA,Field(0.),AZ.data(),1,1,DescA);
+
+  for( CB_INT jLoc = 0; jLoc < NLoc; jLoc++ ) {
+    const CB_INT j = IndxL2G(jLoc,grid.NB(),grid.iProcCol(),0,
+      grid.nProcCol());
+    for( CB_INT iLoc = 0; iLoc < MLoc; iLoc++ )
+      ZLoc[iLoc + jLoc*MLoc] *= W[j];
+  }
+
+  EXPECT_NEAR( (grid.DiffMaxAbs(N,N,AZ.data(),MLoc,ZLoc.data(),MLoc)), 0.,
+    1e-10 );
+
+  // Synchronize processes
+  MPI_Barrier(MPI_COMM_WORLD);
+
+}
+
+
+// Policy selecting NP processes (all if NP <= 0) for a problem of WORK flops
+inline AdaptiveGridPolicy policy_for( const double WORK, const CB_INT NP ) {
+
+  if( NP <= 0 ) return AdaptiveGridPolicy(0.,0.);
+  if( NP == 1 ) return AdaptiveGridPolicy(0.,WORK);
+  return AdaptiveGridPolicy(WORK / (NP + 0.5), 0.);
+
+}
+
+template <typename Field>
+void adaptive_gesv_test( CB_INT NP, CB_INT N, CB_INT NRHS ) {
+
+  // Synchronize processes
+  MPI_Barrier(MPI_COMM_WORLD);
+
+  BlacsGrid grid(MPI_COMM_WORLD,4,4);
+
+  CB_INT MLoc, NLoc, NRHSLoc;
+  std::tie(MLoc,NLoc)    = grid.getLocalDims(N,N);
+  std::tie(MLoc,NRHSLoc) = grid.getLocalDims(N,NRHS);
+
+  std::vector<Field> G(MLoc * NLoc), ALoc(G.size()), BLoc(MLoc * NRHSLoc);
+  std::generate(G.begin(),G.end(),[](){ return generate<Field>(); });
+  std::generate(BLoc.begin(),BLoc.end(),[](){ return generate<Field>(); });
+
+  auto DescA = grid.descInit(N,N,0,0,MLoc);
+  auto DescB = grid.descInit(N,NRHS,0,0,MLoc);
+
+  // A = G + N * I
+  PLASET('A',N,N,Field(0.),Field(N),ALoc.data(),1,1,DescA);
+  PGEADD('N',N,N,Field(1.),G.data(),1,1,DescA,Field(1.),ALoc.data(),1,1,
+    DescA);
+
+  std::vector<Field> AOrig(ALoc), BOrig(BLoc);
+
+  const double WORK = 2./3. * N * N * N + 2. * N * N * NRHS;
+  EXPECT_EQ( (PGESV_ADAPTIVE(grid,N,NRHS,ALoc.data(),MLoc,BLoc.data(),MLoc,
+    policy_for(WORK,NP))), 0 );
+
+  // A * X = B
+  PGEMM('N','N',N,NRHS,N,Field(-1.),AOrig.data(),1,1,DescA,BLoc.data(),
+    1,1,DescB,Field(1.),BOrig.data(),1,1,DescB);
+  EXPECT_NEAR( (PLANGE('M',N,NRHS,BOrig.data(),1,1,DescB)), 0., 1e-10 );
+
+  // Synchronize processes
+  MPI_Barrier(MPI_COMM_WORLD);
+
+}
+
+template <typename Field>
+void adaptive_posv_test( CB_INT NP, CB_INT N, CB_INT NRHS ) {
+
+  // Synchronize processes
+  MPI_Barrier(MPI_COMM_WORLD);
+
+  BlacsGrid grid(MPI_COMM_WORLD,4,4);
+
+  CB_INT MLoc, NLoc, NRHSLoc;
+  std::tie(MLoc,NLoc)    = grid.getLocalDims(N,N);
+  std::tie(MLoc,NRHSLoc) = grid.getLocalDims(N,NRHS);
+
+  std::vector<Field> G(MLoc * NLoc), ALoc(G.size()), BLoc(MLoc * NRHSLoc);
+  std::generate(G.begin(),G.end(),[](){ return generate<Field>(); });
+  std::generate(BLoc.begin(),BLoc.end(),[](){ return generate<Field>(); });
+
+  auto DescA = grid.descInit(N,N,0,0,MLoc);
+  auto DescB = grid.descInit(N,NRHS,0,0,MLoc);
+
+  // A = G**H * G + N * I
+  PLASET('A',N,N,Field(0.),Field(N),ALoc.data(),1,1,DescA);
+  PGEMM('C','N',N,N,N,Field(1.),G.data(),1,1,DescA,G.data(),1,1,DescA,
+    Field(1.),ALoc.data(),1,1,DescA);
+
+  std::vector<Field> AOrig(ALoc), BOrig(BLoc);
+
+  const double WORK = N * N * N / 3. + 2. * N * N * NRHS;
+  EXPECT_EQ( (PPOSV_ADAPTIVE(grid,'L',N,NRHS,ALoc.data(),MLoc,BLoc.data(),
+    MLoc,policy_for(WORK,NP))), 0 );
+
+  // A * X = B
+  PGEMM('N','N',N,NRHS,N,Field(-1.),AOrig.data(),1,1,DescA,BLoc.data(),
+    1,1,DescB,Field(1.),BOrig.data(),1,1,DescB);
+  EXPECT_NEAR( (PLANGE('M',N,NRHS,BOrig.data(),1,1,DescB)), 0., 1e-10 );
+
+  // Synchronize processes
+  MPI_Barrier(MPI_COMM_WORLD);
+
+}
+
+template <typename Field>
+void adaptive_gemm_test( CB_INT NP, char TRANSA, char TRANSB, CB_INT M, 
+  CB_INT N, CB_INT K ) {
+
+  // Synchronize processes
+  MPI_Barrier(MPI_COMM_WORLD);
+
+  BlacsGrid grid(MPI_COMM_WORLD,4,4);
+
+  const bool NoTransA = std::toupper(TRANSA) == 'N';
+  const bool NoTransB = std::toupper(TRANSB) == 'N';
+
+  const CB_INT MRowsA = NoTransA ? M : K, NColsA = NoTransA ? K : M;
+  const CB_INT MRowsB = NoTransB ? K : N, NColsB = NoTransB ? N : K;
+
+  CB_INT MLocA, NLocA, MLocB, NLocB, MLocC, NLocC;
+  std::tie(MLocA,NLocA) = grid.getLocalDims(MRowsA,NColsA);
+  std::tie(MLocB,NLocB) = grid.getLocalDims(MRowsB,NColsB);
+  std::tie(MLocC,NLocC) = grid.getLocalDims(M,N);
+
+  std::vector<Field> ALoc(MLocA * NLocA), BLoc(MLocB * NLocB), 
+    CLoc(MLocC * NLocC);
+  std::generate(ALoc.begin(),ALoc.end(),[](){ return generate<Field>(); });
+  std::generate(BLoc.begin(),BLoc.end(),[](){ return generate<Field>(); });
+  std::generate(CLoc.begin(),CLoc.end(),[](){ return generate<Field>(); });
+
+  std::vector<Field> CRef(CLoc);
+
+  auto DescA = grid.descInit(MRowsA,NColsA,0,0,MLocA);
+  auto DescB = grid.descInit(MRowsB,NColsB,0,0,MLocB);
+  auto DescC = grid.descInit(M,N,0,0,MLocC);
+
+  const Field ALPHA(2.), BETA(-0.5);
+
+  PGEMM_ADAPTIVE(grid,TRANSA,TRANSB,M,N,K,ALPHA,ALoc.data(),MLocA,
+    BLoc.data(),MLocB,BETA,CLoc.data(),MLocC,policy_for(2.*M*N*K,NP));
+
+  PGEMM(TRANSA,TRANSB,M,N,K,ALPHA,ALoc.data(),1,1,DescA,BLoc.data(),1,1,
+    DescB,BETA,CRef.data(),1,1,DescC);
+
+  EXPECT_NEAR( (grid.DiffMaxAbs(M,N,CLoc.data(),MLocC,CRef.data(),MLocC)), 
+    0., 1e-10 );
+
+  // Synchronize processes
+  MPI_Barrier(MPI_COMM_WORLD);
+
+}
+
+
+TEST(ADAPTIVE,ADAPTIVE_PROC_COUNT) {
+
+  AdaptiveGridPolicy policy(10.,100.);
+
+  EXPECT_EQ( AdaptiveProcCount(50. ,16,policy), 1  );
+  EXPECT_EQ( AdaptiveProcCount(100.,16,policy), 1  );
+  EXPECT_EQ( AdaptiveProcCount(120.,16,policy), 12 );
+  EXPECT_EQ( AdaptiveProcCount(1e4 ,16,policy), 16 );
+
+  EXPECT_EQ( AdaptiveProcCount(1e4 ,16,AdaptiveGridPolicy(0.,0.)), 16 );
+
+}
+
+TEST(ADAPTIVE,ADAPTIVE_GRID) {
+
+  BlacsGrid grid(MPI_COMM_WORLD,4,4);
+  const CB_INT NPROC = grid.nProc();
+
+  AdaptiveGrid full(grid,1e4,AdaptiveGridPolicy(0.,0.));
+  EXPECT_EQ( full.nProc(), NPROC );
+  EXPECT_TRUE( full.full() );
+  EXPECT_FALSE( full.i_participate() );
+
+  AdaptiveGrid serial(grid,1e4,AdaptiveGridPolicy(0.,1e4));
+  EXPECT_EQ( serial.nProc(), 1 );
+  EXPECT_TRUE( serial.serial() );
+  EXPECT_EQ( serial.full(), NPROC == 1 );
+  EXPECT_EQ( serial.i_participate(), NPROC > 1 and grid.iProc() == 0 );
+
+}
+
+#define ADAPTIVE_TEST_IMPL(NAME,F,RF)\
+  TEST(ADAPTIVE,ADAPTIVE_FULL_##NAME) {\
+    adaptive_eig_test<F,RF>(AdaptiveGridPolicy(0.,0.),CXXBLACS_M); }\
+  TEST(ADAPTIVE,ADAPTIVE_SHRINK_##NAME) {\
+    adaptive_eig_test<F,RF>(AdaptiveGridPolicy(\
+      4.5 * CXXBLACS_M * CXXBLACS_M * CXXBLACS_M, 0.),CXXBLACS_M); }\
+  TEST(ADAPTIVE,ADAPTIVE_SERIAL_##NAME) {\
+    adaptive_eig_test<F,RF>(AdaptiveGridPolicy(),CXXBLACS_M); }\
+  TEST(ADAPTIVE,ADAPTIVE_PGESV_##NAME) {\
+    for( CB_INT NP : {0,2,1} )\
+      adaptive_gesv_test<F>(NP,CXXBLACS_M,CXXBLACS_NRHS); }\
+  TEST(ADAPTIVE,ADAPTIVE_PPOSV_##NAME) {\
+    for( CB_INT NP : {0,2,1} )\
+      adaptive_posv_test<F>(NP,CXXBLACS_M,CXXBLACS_NRHS); }\
+  TEST(ADAPTIVE,ADAPTIVE_PGEMM_##NAME) {\
+    for( CB_INT NP : {0,2,1} ) {\
+      adaptive_gemm_test<F>(NP,'N','N',CXXBLACS_M,CXXBLACS_N,CXXBLACS_K);\
+      adaptive_gemm_test<F>(NP,'c','n',CXXBLACS_M,CXXBLACS_N,CXXBLACS_K);\
+    } }
+
+ADAPTIVE_TEST_IMPL(Double ,double              ,double);
+ADAPTIVE_TEST_IMPL(CDouble,std::complex<double>,double);
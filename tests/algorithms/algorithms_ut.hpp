@@ -0,0 +1,97 @@
+/*
+ *  A simple C++ Wrapper for BLACS along with minimal extra functionality to 
+ *  aid the the high-level development of distributed memory linear algebra.
+ *  Copyright (C) 2016-2018 David Williams-Young
+
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <ut.hpp>
+#include <cxxblacs.hpp>
+
+#include <algorithm>
+#include <random>
+
+using namespace CXXBLACS;
+
+constexpr CB_INT CXXBLACS_M = 200;
+constexpr CB_INT CXXBLACS_N = 150;
+constexpr CB_INT CXXBLACS_K = 7;
+
+constexpr CB_INT CXXBLACS_NRHS = 15;
+
+static std::default_random_engine gen;
+
+namespace CXXBLACS {
+  template <typename Field>
+  inline Field generate();
+  
+  template <>
+  inline double generate(){ 
+    std::uniform_real_distribution<double> dis(-1,1);
+    return dis(gen); 
+  }
+  
+  template <>
+  inline std::complex<double> generate(){ 
+    std::uniform_real_distribution<double> dis(-1,1);
+    return std::complex<double>(dis(gen),dis(gen)); 
+  }
+
+  template <>
+  inline float generate(){ 
+    std::uniform_real_distribution<float> dis(-1,1);
+    return dis(gen); 
+  }
+  
+  template <>
+  inline std::complex<float> generate(){ 
+    std::uniform_real_distribution<float> dis(-1,1);
+    return std::complex<float>(dis(gen),dis(gen)); 
+  }
+}
+
+// Random Hermitian matrix (+ SHIFT * I) on root
+template <typename Field>
+std::vector<Field> hermitian(CB_INT N, double SHIFT = 0.) {
+
+  std::vector<Field> A;
+  RootExecute(MPI_COMM_WORLD,[&](){
+    A.resize(N*N);
+    for( CB_INT j = 0; j < N; j++ ) 
+    for( CB_INT i = j; i < N; i++ ) {
+      A[i + j*N] = generate<Field>();
+      A[j + i*N] = FieldConj(A[i + j*N]);
+    }
+    for( CB_INT i = 0; i < N; i++ ) 
+      A[i*(N+1)] = std::real(A[i*(N+1)]) + SHIFT;
+  });
+
+  return A;
+
+}
+
+// Wall time of a distributed operation (max over processes)
+template <typename Op>
+inline double time_op( const Op &op ) {
+
+  MPI_Barrier(MPI_COMM_WORLD);
+  double t = MPI_Wtime();
+  op();
+  t = MPI_Wtime() - t;
+
+  MPI_Allreduce(MPI_IN_PLACE,&t,1,MPI_DOUBLE,MPI_MAX,MPI_COMM_WORLD);
+  return t;
+
+}
@@ -0,0 +1,143 @@
+/*
+ *  A simple C++ Wrapper for BLACS along with minimal extra functionality to 
+ *  aid the the high-level development of distributed memory linear algebra.
+ *  Copyright (C) 2016-2018 David Williams-Young
+
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "algorithms_ut.hpp"
+
+#include <cctype>
+
+template <typename Field, typename RealType>
+void batched_test( CB_INT NGROUPS ) {
+
+  // Synchronize processes
+  MPI_Barrier(MPI_COMM_WORLD);
+
+  BlacsGrid grid(MPI_COMM_WORLD,16,16);
+
+  const Field ALPHA = 0.5, BETA = 2.;
+
+  // Problems of varying size and shape
+  const std::vector<std::array<CB_INT,3>> dims = {
+    {{ CXXBLACS_M, CXXBLACS_N, CXXBLACS_M }}, 
+    {{ CXXBLACS_N, CXXBLACS_N, CXXBLACS_K }},
+    {{ 40        , 70        , 30         }},
+    {{ CXXBLACS_M, 20        , CXXBLACS_N }},
+    {{ 10        , 10        , 10         }},
+    {{ 64        , 64        , 64         }},
+    {{ CXXBLACS_K, CXXBLACS_M, CXXBLACS_N }}
+  };
+  const CB_INT NPROB = dims.size();
+
+  std::vector<std::vector<Field>> ALoc(NPROB), BLoc(NPROB), CLoc(NPROB), 
+    CRef(NPROB);
+  std::vector<GEMMBatchEntry<Field>> batch;
+
+  for( CB_INT i = 0; i < NPROB; i++ ) {
+
+    const CB_INT M = dims[i][0], N = dims[i][1], K = dims[i][2];
+
+    // Alternate transposition of A (and the case of TRANS)
+    const char TRANSA = "NTnt"[i % 4];
+    const char TRANSB = (i % 4 < 2) ? 'N' : 'n';
+    const CB_INT MA = (std::toupper(TRANSA) == 'N') ? M : K;
+    const CB_INT NA = (std::toupper(TRANSA) == 'N') ? K : M;
+
+    CB_INT MLocA, NLocA, MLocB, NLocB, MLocC, NLocC;
+    std::tie(MLocA,NLocA) = grid.getLocalDims(MA,NA);
+    std::tie(MLocB,NLocB) = grid.getLocalDims(K,N);
+    std::tie(MLocC,NLocC) = grid.getLocalDims(M,N);
+
+    std::vector<Field> A, B, C;
+    RootExecute(MPI_COMM_WORLD,[&](){
+      A.resize(M*K); B.resize(K*N); C.resize(M*N);
+      for(auto &x : A) x = generate<Field>();
+      for(auto &x : B) x = generate<Field>();
+      for(auto &x : C) x = generate<Field>();
+    });
+
+    ALoc[i].resize(MLocA * NLocA);
+    BLoc[i].resize(MLocB * NLocB);
+    CLoc[i].resize(MLocC * NLocC);
+
+    grid.Scatter(MA,NA,A.data(),MA,ALoc[i].data(),MLocA,0,0);
+    grid.Scatter(K ,N ,B.data(),K ,BLoc[i].data(),MLocB,0,0);
+    grid.Scatter(M ,N ,C.data(),M ,CLoc[i].data(),MLocC,0,0);
+
+    CRef[i] = CLoc[i];
+
+    batch.push_back({ TRANSA, TRANSB, M, N, K, ALPHA, ALoc[i].data(), MLocA,
+      BLoc[i].data(), MLocB, BETA, CLoc[i].data(), MLocC });
+
+  }
+
+  PGEMMBatched(grid,batch,NGROUPS);
+
+  for( CB_INT i = 0; i < NPROB; i++ ) {
+
+    const auto &P = batch[i];
+    const CB_INT MA = (std::toupper(P.TRANSA) == 'N') ? P.M : P.K;
+    const CB_INT NA = (std::toupper(P.TRANSA) == 'N') ? P.K : P.M;
+
+    PGEMM(P.TRANSA,P.TRANSB,P.M,P.N,P.K,ALPHA,P.A,1,1,
+      grid.descInit(MA,NA,0,0,P.LDA),P.B,1,1,
+      grid.descInit(P.K,P.N,0,0,P.LDB),BETA,CRef[i].data(),1,1,
+      grid.descInit(P.M,P.N,0,0,P.LDC));
+
+  }
+
+  // Compare against sequential PGEMM on the full grid
+  for( CB_INT i = 0; i < NPROB; i++ ) 
+    EXPECT_NEAR( (grid.DiffMaxAbs(batch[i].M,batch[i].N,CLoc[i].data(),
+      batch[i].LDC,CRef[i].data(),batch[i].LDC)), 0., 1e-10 );
+
+  // Synchronize processes
+  MPI_Barrier(MPI_COMM_WORLD);
+
+}
+
+
+TEST(GEMM_BATCHED,SCHEDULE_LPT) {
+
+  // Equal groups: classic LPT
+  auto assign = ScheduleLPT({ 7., 5., 4., 3., 3., 2. },{ 1, 1 });
+  std::vector<double> load(2,0.);
+  for( CB_INT i = 0; i < 6; i++ ) 
+    load[assign[i]] += std::vector<double>{ 7., 5., 4., 3., 3., 2. }[i];
+
+  EXPECT_EQ( assign[0], 0 );
+  EXPECT_EQ( assign[1], 1 );
+  EXPECT_EQ( load[0], 12. );
+  EXPECT_EQ( load[1], 12. );
+
+  // Larger groups receive proportionally more work
+  assign = ScheduleLPT({ 4., 4., 4. },{ 2, 1 });
+  EXPECT_EQ( assign[0], 0 );
+  EXPECT_EQ( assign[1], 0 );
+  EXPECT_EQ( assign[2], 1 );
+
+}
+
+#define GEMM_BATCHED_TEST_IMPL(NAME,F,RF)\
+  TEST(GEMM_BATCHED,GEMM_BATCHED_DEFAULT_##NAME) {\
+    batched_test<F,RF>(0); }\
+  TEST(GEMM_BATCHED,GEMM_BATCHED_TWO_GROUPS_##NAME) {\
+    batched_test<F,RF>(2); }\
+  TEST(GEMM_BATCHED,GEMM_BATCHED_ONE_GROUP_##NAME) {\
+    batched_test<F,RF>(1); }
+
+GEMM_BATCHED_TEST_IMPL(Double ,double              ,double);
+GEMM_BATCHED_TEST_IMPL(CDouble,std::complex<double>,double);
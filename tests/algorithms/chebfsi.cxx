@@ -0,0 +1,154 @@
+/*
+ *  A simple C++ Wrapper for BLACS along with minimal extra functionality to 
+ *  aid the the high-level development of distributed memory linear algebra.
+ *  Copyright (C) 2016-2018 David Williams-Young
+
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "algorithms_ut.hpp"
+
+// Reference eigenvalues
+inline void Reference(CB_INT N, double *A, const ScaLAPACK_Desc_t DescA, 
+  double *W, double *Z) {
+  PSYEVD('V','L',N,A,1,1,DescA,W,Z,1,1,DescA);
+}
+
+inline void Reference(CB_INT N, std::complex<double> *A, 
+  const ScaLAPACK_Desc_t DescA, double *W, std::complex<double> *Z) {
+  PHEEVD('V','L',N,A,1,1,DescA,W,Z,1,1,DescA);
+}
+
+template <typename Field, typename RealType, CB_INT MB>
+void chebfsi_test( CB_INT N, CB_INT NEV, CB_INT NGUARD ) {
+
+  // Synchronize processes
+  MPI_Barrier(MPI_COMM_WORLD);
+
+  BlacsGrid grid(MPI_COMM_WORLD,MB,MB);
+
+  const CB_INT K = NEV + NGUARD;
+
+  std::vector<Field> A, X, ALoc, ACpy, ZLoc, XLoc;
+  std::vector<RealType> W(K), WRef(N);
+
+  // Allocate local buffers
+  CB_INT NLoc,MLoc,KLoc;
+  std::tie(MLoc,NLoc) = grid.getLocalDims(N,N);
+  std::tie(MLoc,KLoc) = grid.getLocalDims(N,K);
+
+  ALoc.resize(MLoc * NLoc);
+  ZLoc.resize(MLoc * NLoc);
+  XLoc.resize(MLoc * KLoc);
+
+
+  // Get DESC
+  auto DescA = grid.descInit(N,N,0,0,MLoc);
+  auto DescX = grid.descInit(N,K,0,0,MLoc);
+
+  // Form a diagonally dominant Hermetian matrix and a random guess on 
+  // the root process
+  RootExecute(MPI_COMM_WORLD,[&]() {
+
+    A.resize(N*N);
+    X.resize(N*K);
+    for(auto i = 0; i < N; i++)
+    for(auto j = 0; j <= i; j++) {
+
+      A[i + j*N] = RealType(0.1) * generate<Field>();
+      A[j + i*N] = FieldConj(A[i + j*N]);
+      if( i == j ) A[i + j*N] = RealType(i) + std::real(A[i + j*N]);
+
+    }
+
+    for(auto &x : X) x = generate<Field>();
+
+  });
+
+  ChebFSISettings<RealType> settings;
+  settings.degree = 15;
+  settings.tol    = 1e-10;
+  settings.nGuard = NGUARD;
+
+  auto checkEig = [&]( CB_INT nUnconv ) {
+
+    // Reference eigenvalues
+    grid.Scatter(N,N,A.data(),N,ALoc.data(),MLoc,0,0);
+    ACpy = ALoc;
+    Reference(N,ACpy.data(),DescA,WRef.data(),ZLoc.data());
+
+    RootExecute(MPI_COMM_WORLD,[&](){
+
+      EXPECT_EQ( nUnconv, 0 );
+      for(auto k = 0; k < NEV; k++) 
+        EXPECT_NEAR( W[k], WRef[k], 1e-10 ) << "EIGENVALUE " << k;
+
+    });
+
+    NotRootExecute(MPI_COMM_WORLD,[&](){ EXPECT_TRUE(true); });
+
+  };
+
+
+  // Cold start
+  grid.Scatter(N,N,A.data(),N,ALoc.data(),MLoc,0,0);
+  grid.Scatter(N,K,X.data(),N,XLoc.data(),MLoc,0,0);
+
+  CB_INT nUnconv = 
+    ChebFSI(N,K,ALoc.data(),DescA,W.data(),XLoc.data(),DescX,settings);
+
+  checkEig(nUnconv);
+
+
+  // Perturb the matrix and warm start from the previous solution
+  RootExecute(MPI_COMM_WORLD,[&]() {
+
+    for(auto i = 0; i < N; i++)
+    for(auto j = 0; j <= i; j++) {
+
+      A[i + j*N] += RealType(1e-3) * generate<Field>();
+      A[j + i*N] = FieldConj(A[i + j*N]);
+      A[i + i*N] = std::real(A[i + i*N]);
+
+    }
+
+  });
+
+  grid.Scatter(N,N,A.data(),N,ALoc.data(),MLoc,0,0);
+
+  settings.warmStart = true;
+  nUnconv = 
+    ChebFSI(N,K,ALoc.data(),DescA,W.data(),XLoc.data(),DescX,settings);
+
+  checkEig(nUnconv);
+
+
+  // Synchronize processes
+  MPI_Barrier(MPI_COMM_WORLD);
+
+};
+
+
+#define TEST_IMPL_F(NAME,F,RF,MB,N,NEV,NGUARD)\
+  TEST(CHEBFSI,NAME) { chebfsi_test<F,RF,MB>(N,NEV,NGUARD); };
+
+#define TEST_IMPL(NAME,MB,N,NEV,NGUARD)\
+  TEST_IMPL_F(NAME##_Double, double, double, MB, N, NEV, NGUARD)\
+  TEST_IMPL_F(NAME##_CDouble, std::complex<double>, double, MB, N, NEV, NGUARD)\
+
+
+TEST_IMPL(CHEBFSI_2x2,2,CXXBLACS_N,10,6);
+TEST_IMPL(CHEBFSI_8x8,8,CXXBLACS_N,10,6);
+
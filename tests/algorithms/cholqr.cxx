@@ -0,0 +1,116 @@
+/*
+ *  A simple C++ Wrapper for BLACS along with minimal extra functionality to 
+ *  aid the the high-level development of distributed memory linear algebra.
+ *  Copyright (C) 2016-2018 David Williams-Young
+
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "algorithms_ut.hpp"
+
+template <typename Field, typename RealType, CB_INT MB>
+void cholqr_test( CB_INT M, CB_INT N, bool shifted, RealType logCond ) {
+
+  // Synchronize processes
+  MPI_Barrier(MPI_COMM_WORLD);
+
+  BlacsGrid grid(MPI_COMM_WORLD,MB,MB);
+
+  std::vector<Field> A, Q, R, ALoc, RLoc;
+
+  // Allocate local buffers
+  CB_INT NLoc,MLoc,NLocR;
+  std::tie(MLoc ,NLoc) = grid.getLocalDims(M,N);
+  std::tie(NLocR,NLoc) = grid.getLocalDims(N,N);
+
+  ALoc.resize(MLoc * NLoc);
+  RLoc.resize(NLocR * NLoc);
+
+  // Get DESC
+  auto DescA = grid.descInit(M,N,0,0,MLoc);
+  auto DescR = grid.descInit(N,N,0,0,NLocR);
+
+  // Form Random matrix with geometrically graded columns on root process
+  RootExecute(MPI_COMM_WORLD,[&]() {
+
+    A.resize(M*N);
+    Q.resize(M*N);
+    R.resize(N*N);
+    for(auto j = 0; j < N; j++) 
+    for(auto i = 0; i < M; i++) 
+      A[i + j*M] = std::pow(10.,-logCond*j/(N-1)) * generate<Field>();
+
+  });
+
+  // Distribute to Grid 
+  grid.Scatter(M,N,A.data(),M,ALoc.data(),MLoc,0,0);
+
+  // Factor
+  CB_INT INFO = shifted ?
+    ShiftedCholeskyQR3(M,N,ALoc.data(),1,1,DescA,RLoc.data(),1,1,DescR) :
+    CholeskyQR2(M,N,ALoc.data(),1,1,DescA,RLoc.data(),1,1,DescR);
+
+  EXPECT_EQ( INFO, 0 );
+
+  // Gather Q and R to root process
+  grid.Gather(M,N,Q.data(),M,ALoc.data(),MLoc,0,0);
+  grid.Gather(N,N,R.data(),N,RLoc.data(),NLocR,0,0);
+
+
+  // Check Q**H * Q = I and Q * R = A on the root process
+  RootExecute(MPI_COMM_WORLD,[&](){
+
+    std::vector<Field> QtQ(N*N);
+    GEMM('C','N',N,N,M,Field(1.),Q.data(),M,Q.data(),M,Field(0.),
+      QtQ.data(),N);
+    for(auto k = 0; k < N; k++) QtQ[k*(N+1)] -= Field(1.);
+
+    GEMM('N','N',M,N,N,Field(-1.),Q.data(),M,R.data(),N,Field(1.),
+      A.data(),M);
+
+    RealType maxOrth = 0., maxDiff = 0.;
+    for(auto &x : QtQ) maxOrth = std::max(maxOrth,RealType(std::abs(x)));
+    for(auto &x : A  ) maxDiff = std::max(maxDiff,RealType(std::abs(x)));
+
+    EXPECT_NEAR( maxOrth, 0., 1e-10 ) << "MAX ORTH " << maxOrth;
+    EXPECT_NEAR( maxDiff, 0., 1e-10 ) << "MAX DIFF " << maxDiff;
+
+    for(auto j = 0; j < N; j++)
+    for(auto i = j+1; i < N; i++) EXPECT_EQ( std::abs(R[i + j*N]), 0. );
+
+  });
+
+  NotRootExecute(MPI_COMM_WORLD,[&](){ EXPECT_TRUE(true); });
+
+
+  // Synchronize processes
+  MPI_Barrier(MPI_COMM_WORLD);
+
+};
+
+
+#define TEST_IMPL_F(NAME,F,RF,MB,M,N,SHIFT,LOGCOND)\
+  TEST(CHOLQR,NAME) { cholqr_test<F,RF,MB>(M,N,SHIFT,LOGCOND); };
+
+#define TEST_IMPL(NAME,MB,M,N,SHIFT,LOGCOND)\
+  TEST_IMPL_F(NAME##_Double, double, double, MB, M, N, SHIFT, LOGCOND)\
+  TEST_IMPL_F(NAME##_CDouble, std::complex<double>, double, MB, M, N, SHIFT,\
+    LOGCOND)\
+
+
+TEST_IMPL(CHOLQR2_2x2,2,CXXBLACS_M,CXXBLACS_K,false,2.);
+TEST_IMPL(SCHOLQR3_2x2,2,CXXBLACS_M,CXXBLACS_K,true,2.);
+TEST_IMPL(SCHOLQR3_2x2_IllCond,2,CXXBLACS_M,CXXBLACS_K,true,10.);
+
@@ -0,0 +1,107 @@
+/*
+ *  A simple C++ Wrapper for BLACS along with minimal extra functionality to 
+ *  aid the the high-level development of distributed memory linear algebra.
+ *  Copyright (C) 2016-2018 David Williams-Young
+
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "algorithms_ut.hpp"
+
+#include <iostream>
+
+template <typename Field, typename RealType, CB_INT MB, CB_INT NB>
+void gemm25d_test( CB_INT REPLICATION, CB_INT M, CB_INT N, CB_INT K ) {
+
+  // Synchronize processes
+  MPI_Barrier(MPI_COMM_WORLD);
+
+  BlacsGrid grid(MPI_COMM_WORLD,MB,NB);
+
+  // Replication factor must divide the number of processes
+  if( grid.nProc() % REPLICATION != 0 ) {
+    EXPECT_THROW( (GEMM25D(grid,REPLICATION,M,N,K,Field(1.),
+      (Field*)nullptr,1,(Field*)nullptr,1,Field(0.),(Field*)nullptr,1)),
+      std::runtime_error );
+    return;
+  }
+
+  const Field ALPHA = 0.5, BETA = 2.;
+
+  std::vector<Field> A, B, C, ALoc, BLoc, CLoc;
+
+  CB_INT MLocA, NLocA, MLocB, NLocB, MLocC, NLocC;
+  std::tie(MLocA,NLocA) = grid.getLocalDims(M,K);
+  std::tie(MLocB,NLocB) = grid.getLocalDims(K,N);
+  std::tie(MLocC,NLocC) = grid.getLocalDims(M,N);
+
+  ALoc.resize(MLocA * NLocA);
+  BLoc.resize(MLocB * NLocB);
+  CLoc.resize(MLocC * NLocC);
+
+  auto DescA = grid.descInit(M,K,0,0,MLocA);
+  auto DescB = grid.descInit(K,N,0,0,MLocB);
+  auto DescC = grid.descInit(M,N,0,0,MLocC);
+
+  RootExecute(MPI_COMM_WORLD,[&](){
+    A.resize(M*K); B.resize(K*N); C.resize(M*N);
+    for(auto &x : A) x = generate<Field>();
+    for(auto &x : B) x = generate<Field>();
+    for(auto &x : C) x = generate<Field>();
+  });
+
+  grid.Scatter(M,K,A.data(),M,ALoc.data(),MLocA,0,0);
+  grid.Scatter(K,N,B.data(),K,BLoc.data(),MLocB,0,0);
+  grid.Scatter(M,N,C.data(),M,CLoc.data(),MLocC,0,0);
+
+  std::vector<Field> CLocRef(CLoc);
+
+  double t25D = time_op([&](){
+    GEMM25D(grid,REPLICATION,M,N,K,ALPHA,ALoc.data(),MLocA,BLoc.data(),
+      MLocB,BETA,CLoc.data(),MLocC);
+  });
+
+  double tPGEMM = time_op([&](){
+    PGEMM('N','N',M,N,K,ALPHA,ALoc.data(),1,1,DescA,BLoc.data(),1,1,DescB,
+      BETA,CLocRef.data(),1,1,DescC);
+  });
+
+  // Compare against PGEMM
+  EXPECT_NEAR( (grid.DiffMaxAbs(M,N,CLoc.data(),MLocC,CLocRef.data(),
+    MLocC)), 0., 1e-10 );
+
+  RootExecute(MPI_COMM_WORLD,[&](){
+    std::cout << "  GEMM25D c = " << REPLICATION << " (" << grid.nProc() 
+              << " processes): " << std::scientific << std::setprecision(3) 
+              << t25D << " s, PGEMM: " << tPGEMM << " s" << std::endl;
+  });
+
+  // Synchronize processes
+  MPI_Barrier(MPI_COMM_WORLD);
+
+}
+
+
+
+#define GEMM25D_TEST_IMPL(NAME,F,RF)\
+  TEST(GEMM25D,GEMM25D_C1_##NAME) {\
+    gemm25d_test<F,RF,16,16>(1,CXXBLACS_M,CXXBLACS_N,CXXBLACS_M); }\
+  TEST(GEMM25D,GEMM25D_C2_##NAME) {\
+    gemm25d_test<F,RF,16,16>(2,CXXBLACS_M,CXXBLACS_N,CXXBLACS_M); }\
+  TEST(GEMM25D,GEMM25D_C4_##NAME) {\
+    gemm25d_test<F,RF,16,16>(4,CXXBLACS_M,CXXBLACS_N,CXXBLACS_M); }\
+  TEST(GEMM25D,GEMM25D_RECT_BLOCK_##NAME) {\
+    gemm25d_test<F,RF,2,3>  (2,CXXBLACS_M,CXXBLACS_N,CXXBLACS_K); }
+
+GEMM25D_TEST_IMPL(Double ,double              ,double);
+GEMM25D_TEST_IMPL(CDouble,std::complex<double>,double);
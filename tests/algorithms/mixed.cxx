@@ -0,0 +1,270 @@
+/*
+ *  A simple C++ Wrapper for BLACS along with minimal extra functionality to 
+ *  aid the the high-level development of distributed memory linear algebra.
+ *  Copyright (C) 2016-2018 David Williams-Young
+
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "algorithms_ut.hpp"
+
+template <typename Field>
+void mixed_gesv_test(CB_INT N, CB_INT NRHS, CB_INT MB = 4) {
+
+  // Synchronize processes
+  MPI_Barrier(MPI_COMM_WORLD);
+
+  BlacsGrid grid(MPI_COMM_WORLD,MB,MB);
+
+  std::vector<Field> A, B, ALoc, ARef, BLoc, XLoc, XRef;
+  std::vector<CB_INT> IPIV, IPIVRef;
+
+  CB_INT MLoc, NLoc, NRHSLoc;
+  std::tie(MLoc,NLoc)    = grid.getLocalDims(N,N);
+  std::tie(MLoc,NRHSLoc) = grid.getLocalDims(N,NRHS);
+
+  ALoc.resize(MLoc * NLoc);
+  BLoc.resize(MLoc * NRHSLoc);
+  XLoc.resize(MLoc * NRHSLoc);
+  IPIV.resize(MLoc + grid.MB());
+  IPIVRef.resize(MLoc + grid.MB());
+
+  auto DescA = grid.descInit(N,N,0,0,MLoc);
+  auto DescB = grid.descInit(N,NRHS,0,0,MLoc);
+
+  // Diagonally dominant (well conditioned) system on root
+  RootExecute(MPI_COMM_WORLD,[&](){
+    A.resize(N*N); B.resize(N*NRHS);
+    for( auto &x : A ) x = generate<Field>();
+    for( auto &x : B ) x = generate<Field>();
+    for( CB_INT i = 0; i < N; i++ ) A[i*(N+1)] += Field(N);
+  });
+
+  grid.Scatter(N,N,A.data(),N,ALoc.data(),MLoc,0,0);
+  grid.Scatter(N,NRHS,B.data(),N,BLoc.data(),MLoc,0,0);
+
+  ARef = ALoc;
+  XRef = BLoc;
+  std::vector<Field> BOrig(BLoc), AOrig(ALoc);
+
+  CB_INT ITER;
+  EXPECT_EQ( (PGESV_MIXED(N,NRHS,ALoc.data(),1,1,DescA,IPIV.data(),
+    BLoc.data(),1,1,DescB,XLoc.data(),1,1,DescB,ITER)), 0 );
+
+  EXPECT_EQ( (PGESV(N,NRHS,ARef.data(),1,1,DescA,IPIVRef.data(),
+    XRef.data(),1,1,DescB)), 0 );
+
+  // Refinement converged without the fallback, A and B untouched
+  EXPECT_GE( ITER, 0 );
+  EXPECT_EQ( (grid.DiffMaxAbs(N,N,ALoc.data(),MLoc,AOrig.data(),MLoc)), 0. );
+  EXPECT_EQ( (grid.DiffMaxAbs(N,NRHS,BLoc.data(),MLoc,BOrig.data(),MLoc)), 
+    0. );
+
+  // Solution agrees with the working precision solve
+  EXPECT_NEAR( (grid.DiffMaxAbs(N,NRHS,XLoc.data(),MLoc,XRef.data(),MLoc)), 
+    0., 1e-12 );
+
+  // Synchronize processes
+  MPI_Barrier(MPI_COMM_WORLD);
+
+}
+
+
+template <typename Field>
+void mixed_gesv_fallback_test(CB_INT N) {
+
+  // Synchronize processes
+  MPI_Barrier(MPI_COMM_WORLD);
+
+  BlacsGrid grid(MPI_COMM_WORLD,4,4);
+
+  std::vector<Field> A, ALoc, BLoc, XLoc;
+  std::vector<CB_INT> IPIV;
+
+  CB_INT MLoc, NLoc;
+  std::tie(MLoc,NLoc) = grid.getLocalDims(N,N);
+
+  ALoc.resize(MLoc * NLoc);
+  BLoc.resize(MLoc * NLoc);
+  XLoc.resize(MLoc * NLoc);
+  IPIV.resize(MLoc + grid.MB());
+
+  auto DescA = grid.descInit(N,N,0,0,MLoc);
+
+  // A = 1e300 * I overflows in single precision, X = 1e-300 * I
+  RootExecute(MPI_COMM_WORLD,[&](){
+    A.resize(N*N);
+    for( CB_INT i = 0; i < N; i++ ) A[i*(N+1)] = Field(1e300);
+  });
+
+  grid.Scatter(N,N,A.data(),N,ALoc.data(),MLoc,0,0);
+  PLASET('A',N,N,Field(0.),Field(1.),BLoc.data(),1,1,DescA);
+
+  CB_INT ITER;
+  EXPECT_EQ( (PGESV_MIXED(N,N,ALoc.data(),1,1,DescA,IPIV.data(),
+    BLoc.data(),1,1,DescA,XLoc.data(),1,1,DescA,ITER)), 0 );
+  EXPECT_EQ( ITER, -2 );
+
+  PLASET('A',N,N,Field(0.),Field(1e-300),BLoc.data(),1,1,DescA);
+  EXPECT_NEAR( (grid.DiffMaxAbs(N,N,XLoc.data(),MLoc,BLoc.data(),MLoc)),
+    0., 1e-310 );
+
+  // Synchronize processes
+  MPI_Barrier(MPI_COMM_WORLD);
+
+}
+
+
+template <typename Field>
+void mixed_posv_test(CB_INT N, CB_INT NRHS, CB_INT MB = 4) {
+
+  // Synchronize processes
+  MPI_Barrier(MPI_COMM_WORLD);
+
+  BlacsGrid grid(MPI_COMM_WORLD,MB,MB);
+
+  std::vector<Field> A, B, ALoc, ARef, BLoc, XLoc, XRef;
+
+  CB_INT MLoc, NLoc, NRHSLoc;
+  std::tie(MLoc,NLoc)    = grid.getLocalDims(N,N);
+  std::tie(MLoc,NRHSLoc) = grid.getLocalDims(N,NRHS);
+
+  ALoc.resize(MLoc * NLoc);
+  BLoc.resize(MLoc * NRHSLoc);
+  XLoc.resize(MLoc * NRHSLoc);
+
+  auto DescA = grid.descInit(N,N,0,0,MLoc);
+  auto DescB = grid.descInit(N,NRHS,0,0,MLoc);
+
+  // Hermitian positive definite system on root
+  A = hermitian<Field>(N,2. * N);
+  RootExecute(MPI_COMM_WORLD,[&](){
+    B.resize(N*NRHS);
+    for( auto &x : B ) x = generate<Field>();
+  });
+
+  grid.Scatter(N,N,A.data(),N,ALoc.data(),MLoc,0,0);
+  grid.Scatter(N,NRHS,B.data(),N,BLoc.data(),MLoc,0,0);
+
+  ARef = ALoc;
+  XRef = BLoc;
+  std::vector<Field> AOrig(ALoc);
+
+  CB_INT ITER;
+  EXPECT_EQ( (PPOSV_MIXED('L',N,NRHS,ALoc.data(),1,1,DescA,BLoc.data(),
+    1,1,DescB,XLoc.data(),1,1,DescB,ITER)), 0 );
+
+  EXPECT_EQ( (PPOTRF('L',N,ARef.data(),1,1,DescA)), 0 );
+  EXPECT_EQ( (PPOTRS('L',N,NRHS,ARef.data(),1,1,DescA,XRef.data(),1,1,
+    DescB)), 0 );
+
+  // Refinement converged without the fallback, A untouched
+  EXPECT_GE( ITER, 0 );
+  EXPECT_EQ( (grid.DiffMaxAbs(N,N,ALoc.data(),MLoc,AOrig.data(),MLoc)), 0. );
+
+  // Solution agrees with the working precision solve
+  EXPECT_NEAR( (grid.DiffMaxAbs(N,NRHS,XLoc.data(),MLoc,XRef.data(),MLoc)), 
+    0., 1e-12 );
+
+  // Synchronize processes
+  MPI_Barrier(MPI_COMM_WORLD);
+
+}
+
+
+template <typename Field, typename RealType>
+void mixed_eig_test(CB_INT N, CB_INT MB = 4) {
+
+  // Synchronize processes
+  MPI_Barrier(MPI_COMM_WORLD);
+
+  BlacsGrid grid(MPI_COMM_WORLD,MB,MB);
+
+  std::vector<Field> A, ALoc, ARef, ZLoc, ZRef, AZ, ZZ;
+  std::vector<RealType> W(N), WRef(N);
+
+  CB_INT MLoc, NLoc;
+  std::tie(MLoc,NLoc) = grid.getLocalDims(N,N);
+
+  ALoc.resize(MLoc * NLoc);
+  ZLoc.resize(MLoc * NLoc);
+  ZRef.resize(MLoc * NLoc);
+  AZ.resize(MLoc * NLoc);
+  ZZ.resize(MLoc * NLoc);
+
+  auto DescA = grid.descInit(N,N,0,0,MLoc);
+
+  // Hermitian matrix on root
+  A = hermitian<Field>(N);
+
+  grid.Scatter(N,N,A.data(),N,ALoc.data(),MLoc,0,0);
+  ARef = ALoc;
+  std::vector<Field> AOrig(ALoc);
+
+  CB_INT ITER;
+  EXPECT_EQ( (PHEEVD_MIXED('L',N,ALoc.data(),1,1,DescA,W.data(),
+    ZLoc.data(),1,1,DescA,ITER)), 0 );
+
+  EXPECT_EQ( (PHEEVD('V','L',N,ARef.data(),1,1,DescA,WRef.data(),
+    ZRef.data(),1,1,DescA)), 0 );
+
+  EXPECT_GT( ITER, 0 );
+  EXPECT_EQ( (grid.DiffMaxAbs(N,N,ALoc.data(),MLoc,AOrig.data(),MLoc)), 0. );
+
+  // Eigenvalues agree with the working precision solve
+  for( CB_INT i = 0; i < N; i++ ) EXPECT_NEAR( W[i], WRef[i], 1e-10 );
+
+  // Z**H * Z = I
+  PLASET('A',N,N,Field(0.),Field(1.),ZZ.data(),1,1,DescA);
+  PGEMM('C','N',N,N,N,Field(-1.),ZLoc.data(),1,1,DescA,ZLoc.data(),1,1,
+    DescA,Field(1.),ZZ.data(),1,1,DescA);
+  EXPECT_NEAR( (PLANGE('M',N,N,ZZ.data(),1,1,DescA)), 0., 1e-12 );
+
+  // A * Z = Z * diag(W)
+  PGEMM('N','N',N,N,N,Field(1.),AOrig.data(),1,1,DescA,ZLoc.data(),1,1,
+    DescA,Field(0.),AZ.data(),1,1,DescA);
+
+  for( CB_INT jLoc = 0; jLoc < NLoc; jLoc++ ) {
+    const CB_INT j = IndxL2G(jLoc,grid.NB(),grid.iProcCol(),0,
+      grid.nProcCol());
+    for( CB_INT iLoc = 0; iLoc < MLoc; iLoc++ )
+      ZLoc[iLoc + jLoc*MLoc] *= W[j];
+  }
+
+  EXPECT_NEAR( (grid.DiffMaxAbs(N,N,AZ.data(),MLoc,ZLoc.data(),MLoc)), 0.,
+    1e-10 );
+
+  // Synchronize processes
+  MPI_Barrier(MPI_COMM_WORLD);
+
+}
+
+
+#define MIXED_TEST_IMPL(NAME,F,RF)\
+  TEST(MIXED_PRECISION,PGESV_MIXED_##NAME) {\
+    mixed_gesv_test<F>(CXXBLACS_M,CXXBLACS_NRHS); }\
+  TEST(MIXED_PRECISION,PGESV_MIXED_EMPTY_LOCAL_##NAME) {\
+    mixed_gesv_test<F>(CXXBLACS_K,3,16); }\
+  TEST(MIXED_PRECISION,PGESV_MIXED_FALLBACK_##NAME) {\
+    mixed_gesv_fallback_test<F>(CXXBLACS_K); }\
+  TEST(MIXED_PRECISION,PPOSV_MIXED_##NAME) {\
+    mixed_posv_test<F>(CXXBLACS_M,CXXBLACS_NRHS); }\
+  TEST(MIXED_PRECISION,PPOSV_MIXED_EMPTY_LOCAL_##NAME) {\
+    mixed_posv_test<F>(CXXBLACS_K,3,16); }\
+  TEST(MIXED_PRECISION,PHEEVD_MIXED_##NAME) {\
+    mixed_eig_test<F,RF>(CXXBLACS_M); }\
+  TEST(MIXED_PRECISION,PHEEVD_MIXED_EMPTY_LOCAL_##NAME) {\
+    mixed_eig_test<F,RF>(CXXBLACS_K,16); }
+
+MIXED_TEST_IMPL(Double ,double              ,double);
+MIXED_TEST_IMPL(CDouble,std::complex<double>,double);
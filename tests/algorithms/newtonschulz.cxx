@@ -0,0 +1,186 @@
+/*
+ *  A simple C++ Wrapper for BLACS along with minimal extra functionality to 
+ *  aid the the high-level development of distributed memory linear algebra.
+ *  Copyright (C) 2016-2018 David Williams-Young
+
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "algorithms_ut.hpp"
+
+template <typename Field, typename RealType>
+void ns_sqrt_test(CB_INT N, CB_INT MB = 4) {
+
+  // Synchronize processes
+  MPI_Barrier(MPI_COMM_WORLD);
+
+  BlacsGrid grid(MPI_COMM_WORLD,MB,MB);
+
+  CB_INT MLoc, NLoc;
+  std::tie(MLoc,NLoc) = grid.getLocalDims(N,N);
+
+  std::vector<Field> ALoc(MLoc * NLoc), YLoc(ALoc.size()), ZLoc(ALoc.size()),
+    YRef(ALoc.size()), ZRef(ALoc.size()), T(ALoc.size());
+  std::vector<RealType> W(N);
+
+  auto DescA = grid.descInit(N,N,0,0,MLoc);
+
+  // Positive definite
+  auto A = hermitian<Field>(N,2. * std::sqrt(N));
+  grid.Scatter(N,N,A.data(),N,ALoc.data(),MLoc,0,0);
+  std::vector<Field> AOrig(ALoc);
+
+  CB_INT ITER;
+  EXPECT_EQ( (PHESQRT_NS(N,ALoc.data(),1,1,DescA,YLoc.data(),1,1,DescA,
+    ZLoc.data(),1,1,DescA,ITER)), 0 );
+
+  EXPECT_EQ( (PHEFUNC(N,ALoc.data(),1,1,DescA,
+    [](RealType x){ return 1. / std::sqrt(x); },ZRef.data(),1,1,DescA,
+    W.data())), 0 );
+
+  PHEFUNC(N,ALoc.data(),1,1,DescA,[](RealType x){ return std::sqrt(x); },
+    YRef.data(),1,1,DescA,W.data());
+
+  EXPECT_GT( ITER, 0 );
+  EXPECT_EQ( (grid.DiffMaxAbs(N,N,ALoc.data(),MLoc,AOrig.data(),MLoc)), 0. );
+
+  // Agrees with the eigendecomposition
+  EXPECT_NEAR( (grid.DiffMaxAbs(N,N,YLoc.data(),MLoc,YRef.data(),MLoc)), 
+    0., 1e-10 );
+  EXPECT_NEAR( (grid.DiffMaxAbs(N,N,ZLoc.data(),MLoc,ZRef.data(),MLoc)), 
+    0., 1e-10 );
+
+  // Y * Y = A
+  PGEMM('N','N',N,N,N,Field(1.),YLoc.data(),1,1,DescA,YLoc.data(),1,1,
+    DescA,Field(0.),T.data(),1,1,DescA);
+  EXPECT_NEAR( (grid.DiffMaxAbs(N,N,T.data(),MLoc,AOrig.data(),MLoc)), 
+    0., 1e-10 );
+
+  // Z * Y = I
+  PLASET('A',N,N,Field(0.),Field(1.),T.data(),1,1,DescA);
+  PGEMM('N','N',N,N,N,Field(-1.),ZLoc.data(),1,1,DescA,YLoc.data(),1,1,
+    DescA,Field(1.),T.data(),1,1,DescA);
+  EXPECT_NEAR( (PLANGE('M',N,N,T.data(),1,1,DescA)), 0., 1e-12 );
+
+  // Inverse square root only
+  std::fill(ZLoc.begin(),ZLoc.end(),Field(0.));
+  EXPECT_EQ( (PHESQRT_NS(N,ALoc.data(),1,1,DescA,(Field*)nullptr,1,1,DescA,
+    ZLoc.data(),1,1,DescA,ITER)), 0 );
+  EXPECT_NEAR( (grid.DiffMaxAbs(N,N,ZLoc.data(),MLoc,ZRef.data(),MLoc)), 
+    0., 1e-10 );
+
+  // Synchronize processes
+  MPI_Barrier(MPI_COMM_WORLD);
+
+}
+
+
+template <typename Field, typename RealType>
+void ns_sqrt_fallback_test(CB_INT N) {
+
+  // Synchronize processes
+  MPI_Barrier(MPI_COMM_WORLD);
+
+  BlacsGrid grid(MPI_COMM_WORLD,4,4);
+
+  CB_INT MLoc, NLoc;
+  std::tie(MLoc,NLoc) = grid.getLocalDims(N,N);
+
+  std::vector<Field> ALoc(MLoc * NLoc), ZLoc(ALoc.size()), ZRef(ALoc.size());
+  std::vector<RealType> W(N);
+
+  auto DescA = grid.descInit(N,N,0,0,MLoc);
+
+  // Positive definite, cond(A) = 1e12
+  PLASET('A',N,N,Field(0.),Field(1.),ALoc.data(),1,1,DescA);
+  PLASET('A',1,1,Field(0.),Field(1e-12),ALoc.data(),1,1,DescA);
+
+  CB_INT ITER;
+  EXPECT_EQ( (PHESQRT_NS(N,ALoc.data(),1,1,DescA,(Field*)nullptr,1,1,DescA,
+    ZLoc.data(),1,1,DescA,ITER,20)), 0 );
+  EXPECT_EQ( ITER, -21 );
+
+  PLASET('A',N,N,Field(0.),Field(1.),ZRef.data(),1,1,DescA);
+  PLASET('A',1,1,Field(0.),Field(1e6),ZRef.data(),1,1,DescA);
+  EXPECT_NEAR( (grid.DiffMaxAbs(N,N,ZLoc.data(),MLoc,ZRef.data(),MLoc)), 
+    0., 1e-6 );
+
+  // Indefinite
+  PLASET('A',1,1,Field(0.),Field(-1.),ALoc.data(),1,1,DescA);
+  EXPECT_EQ( (PHESQRT_NS(N,ALoc.data(),1,1,DescA,(Field*)nullptr,1,1,DescA,
+    ZLoc.data(),1,1,DescA,ITER)), N+1 );
+  EXPECT_EQ( ITER, -2 );
+
+  // Synchronize processes
+  MPI_Barrier(MPI_COMM_WORLD);
+
+}
+
+
+template <typename Field, typename RealType>
+void ns_sign_test(CB_INT N) {
+
+  // Synchronize processes
+  MPI_Barrier(MPI_COMM_WORLD);
+
+  BlacsGrid grid(MPI_COMM_WORLD,4,4);
+
+  CB_INT MLoc, NLoc;
+  std::tie(MLoc,NLoc) = grid.getLocalDims(N,N);
+
+  std::vector<Field> ALoc(MLoc * NLoc), SLoc(ALoc.size()), SRef(ALoc.size()), 
+    T(ALoc.size());
+  std::vector<RealType> W(N);
+
+  auto DescA = grid.descInit(N,N,0,0,MLoc);
+
+  // Indefinite
+  auto A = hermitian<Field>(N,0.);
+  grid.Scatter(N,N,A.data(),N,ALoc.data(),MLoc,0,0);
+
+  CB_INT ITER;
+  EXPECT_EQ( (PHESIGN_NS(N,ALoc.data(),1,1,DescA,SLoc.data(),1,1,DescA,
+    ITER)), 0 );
+
+  EXPECT_EQ( (PHEFUNC(N,ALoc.data(),1,1,DescA,
+    [](RealType x){ return RealType( (x > 0.) - (x < 0.) ); },
+    SRef.data(),1,1,DescA,W.data())), 0 );
+
+  EXPECT_GT( ITER, 0 );
+  EXPECT_NEAR( (grid.DiffMaxAbs(N,N,SLoc.data(),MLoc,SRef.data(),MLoc)), 
+    0., 1e-8 );
+
+  // S * S = I
+  PLASET('A',N,N,Field(0.),Field(1.),T.data(),1,1,DescA);
+  PGEMM('N','N',N,N,N,Field(-1.),SLoc.data(),1,1,DescA,SLoc.data(),1,1,
+    DescA,Field(1.),T.data(),1,1,DescA);
+  EXPECT_NEAR( (PLANGE('M',N,N,T.data(),1,1,DescA)), 0., 1e-10 );
+
+  // Synchronize processes
+  MPI_Barrier(MPI_COMM_WORLD);
+
+}
+
+
+#define NS_TEST_IMPL(NAME,F,RF)\
+  TEST(NEWTON_SCHULZ,PHESQRT_NS_##NAME) {\
+    ns_sqrt_test<F,RF>(CXXBLACS_M); }\
+  TEST(NEWTON_SCHULZ,PHESQRT_NS_EMPTY_LOCAL_##NAME) {\
+    ns_sqrt_test<F,RF>(CXXBLACS_K,16); }\
+  TEST(NEWTON_SCHULZ,PHESQRT_NS_FALLBACK_##NAME) {\
+    ns_sqrt_fallback_test<F,RF>(CXXBLACS_K); }\
+  TEST(NEWTON_SCHULZ,PHESIGN_NS_##NAME) {\
+    ns_sign_test<F,RF>(CXXBLACS_M); }
+
+NS_TEST_IMPL(Double ,double              ,double);
+NS_TEST_IMPL(CDouble,std::complex<double>,double);
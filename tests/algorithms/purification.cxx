@@ -0,0 +1,132 @@
+/*
+ *  A simple C++ Wrapper for BLACS along with minimal extra functionality to 
+ *  aid the the high-level development of distributed memory linear algebra.
+ *  Copyright (C) 2016-2018 David Williams-Young
+
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "algorithms_ut.hpp"
+
+template <typename Field, typename RealType>
+void purification_test(const char METHOD, CB_INT N, CB_INT NOCC) {
+
+  // Synchronize processes
+  MPI_Barrier(MPI_COMM_WORLD);
+
+  BlacsGrid grid(MPI_COMM_WORLD,4,4);
+
+  CB_INT MLoc, NLoc;
+  std::tie(MLoc,NLoc) = grid.getLocalDims(N,N);
+
+  std::vector<Field> H, HLoc(MLoc * NLoc), PLoc(HLoc.size()), 
+    PRef(HLoc.size()), Z(HLoc.size()), T(HLoc.size());
+  std::vector<RealType> W(N);
+
+  auto DescH = grid.descInit(N,N,0,0,MLoc);
+
+  // Hermitian with a gap about 0 between the NOCC lowest states and the
+  // rest
+  const double SHIFT = 2. * std::sqrt(N);
+  H = hermitian<Field>(N,SHIFT);
+  RootExecute(MPI_COMM_WORLD,[&](){
+    for( CB_INT i = 0; i < NOCC; i++ ) H[i*(N+1)] -= 2. * SHIFT;
+  });
+
+  grid.Scatter(N,N,H.data(),N,HLoc.data(),MLoc,0,0);
+  std::vector<Field> HOrig(HLoc);
+
+  // Reference: P = Z(:,1:NOCC) * Z(:,1:NOCC)**H
+  std::vector<Field> HW(HLoc);
+  EXPECT_EQ( (PHEEVD('V','L',N,HW.data(),1,1,DescH,W.data(),Z.data(),1,1,
+    DescH)), 0 );
+  PGEMM('N','C',N,N,NOCC,Field(1.),Z.data(),1,1,DescH,Z.data(),1,1,DescH,
+    Field(0.),PRef.data(),1,1,DescH);
+
+  CB_INT ITER;
+  std::vector<PurificationStep> stats;
+
+  CB_INT INFO;
+  if( METHOD == 'M' )
+    INFO = PHEPURIFY_MCWEENY(N,RealType(0.),HLoc.data(),1,1,DescH,
+      PLoc.data(),1,1,DescH,ITER,&stats);
+  else if( METHOD == 'T' )
+    INFO = PHEPURIFY_TRS4(N,NOCC,HLoc.data(),1,1,DescH,PLoc.data(),1,1,
+      DescH,ITER,&stats);
+  else
+    INFO = PHEPURIFY_CANONICAL(N,NOCC,HLoc.data(),1,1,DescH,PLoc.data(),
+      1,1,DescH,ITER,&stats);
+  EXPECT_EQ( INFO, 0 );
+
+  EXPECT_EQ( (grid.DiffMaxAbs(N,N,HLoc.data(),MLoc,HOrig.data(),MLoc)), 0. );
+
+  // Agrees with the diagonalization
+  EXPECT_NEAR( (grid.DiffMaxAbs(N,N,PLoc.data(),MLoc,PRef.data(),MLoc)), 
+    0., 1e-10 );
+
+  // Convergence monitor
+  EXPECT_EQ( stats.size(), size_t(ITER + 1) );
+  EXPECT_NEAR( stats.back().trace, NOCC, 1e-10 );
+  EXPECT_LT( stats.back().idempotency, 1e-6 );
+  for( auto &s : stats ) EXPECT_GT( s.flops, 0. );
+
+  // P * P = P
+  T = PLoc;
+  PGEMM('N','N',N,N,N,Field(1.),PLoc.data(),1,1,DescH,PLoc.data(),1,1,
+    DescH,Field(-1.),T.data(),1,1,DescH);
+  EXPECT_NEAR( (PLANGE('M',N,N,T.data(),1,1,DescH)), 0., 1e-10 );
+
+  // Synchronize processes
+  MPI_Barrier(MPI_COMM_WORLD);
+
+}
+
+
+template <typename Field, typename RealType>
+void gershgorin_test(CB_INT N) {
+
+  BlacsGrid grid(MPI_COMM_WORLD,4,4);
+
+  CB_INT MLoc, NLoc;
+  std::tie(MLoc,NLoc) = grid.getLocalDims(N,N);
+
+  std::vector<Field> HLoc(MLoc * NLoc);
+  auto DescH = grid.descInit(N,N,0,0,MLoc);
+
+  // Tridiagonal (-1, 2, -1)
+  PLASET('A',N,N,Field(0.),Field(2.),HLoc.data(),1,1,DescH);
+  PLASET('A',N-1,N-1,Field(0.),Field(-1.),HLoc.data(),1,2,DescH);
+  PLASET('A',N-1,N-1,Field(0.),Field(-1.),HLoc.data(),2,1,DescH);
+
+  RealType EMIN, EMAX, TRACE;
+  GershgorinBounds(N,HLoc.data(),1,1,DescH,EMIN,EMAX,TRACE);
+
+  EXPECT_NEAR( EMIN , 0.     , 1e-14 );
+  EXPECT_NEAR( EMAX , 4.     , 1e-14 );
+  EXPECT_NEAR( TRACE, 2. * N , 1e-12 );
+
+}
+
+
+#define PURIFICATION_TEST_IMPL(NAME,F,RF)\
+  TEST(PURIFICATION,GERSHGORIN_##NAME) {\
+    gershgorin_test<F,RF>(CXXBLACS_M); }\
+  TEST(PURIFICATION,MCWEENY_##NAME) {\
+    purification_test<F,RF>('M',CXXBLACS_M,CXXBLACS_M/4); }\
+  TEST(PURIFICATION,TRS4_##NAME) {\
+    purification_test<F,RF>('T',CXXBLACS_M,CXXBLACS_M/4); }\
+  TEST(PURIFICATION,CANONICAL_##NAME) {\
+    purification_test<F,RF>('C',CXXBLACS_M,CXXBLACS_M/4); }
+
+PURIFICATION_TEST_IMPL(Double ,double              ,double);
+PURIFICATION_TEST_IMPL(CDouble,std::complex<double>,double);
@@ -0,0 +1,155 @@
+/*
+ *  A simple C++ Wrapper for BLACS along with minimal extra functionality to 
+ *  aid the the high-level development of distributed memory linear algebra.
+ *  Copyright (C) 2016-2018 David Williams-Young
+
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "algorithms_ut.hpp"
+
+// One-stage reference eigenvalues
+inline void OneStage(CB_INT N, double *A, const ScaLAPACK_Desc_t DescA, 
+  double *W, double *Z) {
+  PSYEVD('V','L',N,A,1,1,DescA,W,Z,1,1,DescA);
+}
+
+inline void OneStage(CB_INT N, std::complex<double> *A, 
+  const ScaLAPACK_Desc_t DescA, double *W, std::complex<double> *Z) {
+  PHEEVD('V','L',N,A,1,1,DescA,W,Z,1,1,DescA);
+}
+
+template <typename Field, typename RealType, CB_INT MB>
+void two_stage_test( CB_INT N, char UPLO ) {
+
+  // Synchronize processes
+  MPI_Barrier(MPI_COMM_WORLD);
+
+  BlacsGrid grid(MPI_COMM_WORLD,MB,MB);
+
+  std::vector<Field> A, ALoc, ACpy, Z, ZLoc;
+  std::vector<RealType> W, WRef;
+
+  // Allocate local buffers
+  CB_INT NLoc,MLoc;
+  std::tie(MLoc,NLoc) = grid.getLocalDims(N,N);
+
+  ALoc.resize(MLoc * NLoc);
+  ZLoc.resize(MLoc * NLoc);
+  W.resize(N);
+  WRef.resize(N);
+
+
+  // Get DESC
+  auto DescA = grid.descInit(N,N,0,0,MLoc);
+
+  // Form Random hermetian matrix on root process
+  A = hermitian<Field>(N);
+  RootExecute(MPI_COMM_WORLD,[&]() { Z.resize(N*N); });
+
+  // Distribute to Grid 
+  grid.Scatter(N,N,A.data(),N,ALoc.data(),MLoc,0,0);
+  ACpy = ALoc;
+
+  // Only the UPLO triangle may be referenced
+  if( UPLO == 'L' ) 
+    PLASET('U',N-1,N-1,Field(-7.),Field(-7.),ALoc.data(),1,2,DescA);
+  else
+    PLASET('L',N-1,N-1,Field(-7.),Field(-7.),ALoc.data(),2,1,DescA);
+
+  // Reference eigenvalues from the one-stage solver
+  OneStage(N,ACpy.data(),DescA,WRef.data(),ZLoc.data());
+
+  // Diagonalize the matrix
+  CXXBLACS::PHEEVD_2STAGE('V',UPLO,N,ALoc.data(),1,1,DescA,W.data(),
+    ZLoc.data(),1,1,DescA);
+
+  // Gather the eigenvectors to root process
+  grid.Gather(N,N,Z.data(),N,ZLoc.data(),MLoc,0,0);
+
+
+  // Check results on root process
+  RootExecute(MPI_COMM_WORLD,[&](){
+
+    std::vector<Field> TMP(Z);
+    GEMM('N','N',N,N,N,Field(1.),A.data(),N,Z.data(),N,Field(0.),TMP.data(),N);
+    GEMM('C','N',N,N,N,Field(1.),Z.data(),N,TMP.data(),N,Field(0.),A.data(),N);
+    
+    for(auto k = 0; k < N; k++) A[k*(N+1)] -= W[k];
+
+    std::vector<RealType> DIFF(N*N,0.);
+    for(auto k = 0; k < N*N; k++) DIFF[k] = std::abs(A[k]);
+
+    RealType maxDiff = *std::max_element(DIFF.begin(),DIFF.end());
+
+    EXPECT_NEAR( maxDiff, 0., 1e-10 ) << "MAX DIFF " << maxDiff;
+
+    for(auto k = 0; k < N; k++) 
+      EXPECT_NEAR( W[k], WRef[k], 1e-10 ) << "EIGENVALUE " << k;
+
+  });
+
+  NotRootExecute(MPI_COMM_WORLD,[&](){ EXPECT_TRUE(true); });
+
+
+  // Synchronize processes
+  MPI_Barrier(MPI_COMM_WORLD);
+
+};
+
+
+TEST(TWO_STAGE,TWO_STAGE_DESCZ_MISMATCH) {
+
+  BlacsGrid grid(MPI_COMM_WORLD,2,2);
+
+  const CB_INT N = CXXBLACS_K;
+  CB_INT MLoc, NLoc;
+  std::tie(MLoc,NLoc) = grid.getLocalDims(N,N);
+
+  std::vector<double> ALoc(MLoc * NLoc), ZLoc(ALoc.size()), W(N);
+  auto DescA = grid.descInit(N,N,0,0,MLoc);
+
+  // Z must share the row blocking / source process of A
+  auto DescZ = DescInit(N,N,4,2,0,0,grid.iContxt(),MLoc);
+  EXPECT_EQ( (PHEEVD_2STAGE('V','L',N,ALoc.data(),1,1,DescA,W.data(),
+    ZLoc.data(),1,1,DescZ)), -(1200 + 5) );
+
+  DescZ = DescInit(N,N,2,2,grid.nProcRow()-1,0,grid.iContxt(),MLoc);
+  if( grid.nProcRow() > 1 ) {
+    EXPECT_EQ( (PHEEVD_2STAGE('V','L',N,ALoc.data(),1,1,DescA,W.data(),
+      ZLoc.data(),1,1,DescZ)), -(1200 + 7) );
+  }
+
+  EXPECT_EQ( (PHEEVD_2STAGE('V','L',N-1,ALoc.data(),1,1,DescA,W.data(),
+    ZLoc.data(),2,1,DescA)), -10 );
+
+}
+
+
+#define TEST_IMPL_F(NAME,F,RF,MB,N,UPLO)\
+  TEST(TWO_STAGE,NAME) { two_stage_test<F,RF,MB>(N,UPLO); };
+
+#define TEST_IMPL(NAME,MB,N,UPLO)\
+  TEST_IMPL_F(NAME##_Double, double, double, MB, N, UPLO)\
+  TEST_IMPL_F(NAME##_CDouble, std::complex<double>, double, MB, N, UPLO)\
+//FIXME: Need to determine proper error criteria for single precision
+//TEST_IMPL_F(NAME##_Float , float , float, MB, N, UPLO)\
+//TEST_IMPL_F(NAME##_CFloat , std::complex<float> , float, MB, N, UPLO)\
+
+
+TEST_IMPL(TWO_STAGE_2x2_Lower,2,CXXBLACS_N,'L');
+TEST_IMPL(TWO_STAGE_2x2_Upper,2,CXXBLACS_N,'U');
+TEST_IMPL(TWO_STAGE_8x8_Lower,8,CXXBLACS_N,'L');
+TEST_IMPL(TWO_STAGE_8x8_Small_Lower,8,CXXBLACS_K,'L');
+TEST_IMPL(TWO_STAGE_8x8_Small_Upper,8,CXXBLACS_K,'U');
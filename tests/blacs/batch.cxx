@@ -0,0 +1,103 @@
+/*
+ *  A simple C++ Wrapper for BLACS along with minimal extra functionality to 
+ *  aid the the high-level development of distributed memory linear algebra.
+ *  Copyright (C) 2016-2018 David Williams-Young
+
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <ut.hpp>
+#include <cxxblacs.hpp>
+
+using namespace CXXBLACS;
+
+constexpr CB_INT CXXBLACS_NBLOCKS = 500;
+
+// Deterministic payload for block k sent from process SRC to DEST
+template <typename Field>
+Field payload( CB_INT SRC, CB_INT DEST, CB_INT k, CB_INT i, CB_INT j ) {
+  return Field(SRC + 10*DEST + 100*k + 1e5*i + 1e6*j);
+}
+
+// Deterministic block shape
+inline INDX block_shape( CB_INT SRC, CB_INT DEST, CB_INT k ) {
+  return { 1 + (SRC + DEST + k) % 3, 1 + (SRC * DEST + k) % 4 };
+}
+
+
+
+template <typename Field>
+void batch_test() {
+
+  // Synchronize processes
+  MPI_Barrier(MPI_COMM_WORLD);
+
+  BlacsGrid grid(MPI_COMM_WORLD,2,2);
+  auto batch = grid.messageBatch<Field>();
+
+  const CB_INT NPROW = grid.nProcRow(), NPCOL = grid.nProcCol();
+  const CB_INT ME    = grid.iProcRow() * NPCOL + grid.iProcCol();
+  const CB_INT NPROC = NPROW * NPCOL;
+  const CB_INT LDA   = 5;
+
+  // Send / Recv buffers for every (peer, block), padded to LDA rows
+  std::vector<std::vector<Field>> sendBufs, recvBufs;
+
+  for(auto p = 0; p < NPROC; p++) 
+  for(auto k = 0; k < CXXBLACS_NBLOCKS; k++) {
+
+    CB_INT M, N;
+
+    std::tie(M,N) = block_shape(ME,p,k);
+    sendBufs.emplace_back(LDA * N);
+    for(auto j = 0; j < N; j++)
+    for(auto i = 0; i < M; i++)
+      sendBufs.back()[i + j*LDA] = payload<Field>(ME,p,k,i,j);
+
+    batch.Send(M,N,sendBufs.back().data(),LDA,p / NPCOL,p % NPCOL);
+
+    std::tie(M,N) = block_shape(p,ME,k);
+    recvBufs.emplace_back(LDA * N, Field(-1.));
+    batch.Recv(M,N,recvBufs.back().data(),LDA,p / NPCOL,p % NPCOL);
+
+  }
+
+  batch.Flush();
+
+  // One message per remote peer
+  EXPECT_EQ( batch.nMessages(), size_t(NPROC - 1) );
+  EXPECT_EQ( batch.nBlocks()  , size_t(NPROC * CXXBLACS_NBLOCKS) );
+
+  for(auto p = 0; p < NPROC; p++) 
+  for(auto k = 0; k < CXXBLACS_NBLOCKS; k++) {
+
+    CB_INT M, N;
+    std::tie(M,N) = block_shape(p,ME,k);
+    auto &A = recvBufs[p * CXXBLACS_NBLOCKS + k];
+
+    for(auto j = 0; j < N; j++)
+    for(auto i = 0; i < LDA; i++)
+      EXPECT_EQ( A[i + j*LDA], 
+        i < M ? payload<Field>(p,ME,k,i,j) : Field(-1.) );
+
+  }
+
+  // Synchronize processes
+  MPI_Barrier(MPI_COMM_WORLD);
+
+}
+
+
+
+TEST(BATCH,BATCH_Double ) { batch_test<double>();               }
+TEST(BATCH,BATCH_CDouble) { batch_test<std::complex<double>>(); }
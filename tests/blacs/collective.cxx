@@ -0,0 +1,511 @@
+/*
+ *  A simple C++ Wrapper for BLACS along with minimal extra functionality to 
+ *  aid the the high-level development of distributed memory linear algebra.
+ *  Copyright (C) 2016-2018 David Williams-Young
+
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <ut.hpp>
+#include <cxxblacs.hpp>
+
+#include <numeric>
+#include <cstdio>
+#include <cstdlib>
+
+using namespace CXXBLACS;
+
+constexpr CB_INT CXXBLACS_N = 15;
+
+// Value owned by process (iRow,iCol), distinct in magnitude per process
+template <typename Field>
+Field proc_value( const BlacsGrid &grid, CB_INT iRow, CB_INT iCol ) {
+  return Field(-(1. + iRow * grid.nProcCol() + iCol));
+}
+
+
+
+template <typename Field>
+void gamxn_test() {
+
+  // Synchronize processes
+  MPI_Barrier(MPI_COMM_WORLD);
+
+  BlacsGrid grid(MPI_COMM_WORLD,2,2);
+
+  Field  AMX = proc_value<Field>(grid,grid.iProcRow(),grid.iProcCol());
+  Field  AMN = AMX;
+  CB_INT RA, CA;
+
+  GAMX2D(grid.iContxt(),"All"," ",1,1,&AMX,1,&RA,&CA,1,-1,-1);
+
+  EXPECT_EQ( AMX, proc_value<Field>(grid,grid.nProcRow()-1,grid.nProcCol()-1) );
+  EXPECT_EQ( RA, grid.nProcRow()-1 );
+  EXPECT_EQ( CA, grid.nProcCol()-1 );
+
+  // Row scope without location
+  GAMN2D(grid.iContxt(),"Row"," ",1,1,&AMN,1,-1,-1);
+
+  EXPECT_EQ( AMN, proc_value<Field>(grid,grid.iProcRow(),0) );
+
+  // Synchronize processes
+  MPI_Barrier(MPI_COMM_WORLD);
+
+}
+
+
+
+template <typename Field>
+void trbs_test( const char *UPLO, CB_INT N ) {
+
+  // Synchronize processes
+  MPI_Barrier(MPI_COMM_WORLD);
+
+  BlacsGrid grid(MPI_COMM_WORLD,2,2);
+
+  const Field SENTINEL = 7.;
+  const bool  LOWER    = UPLO[0] == 'L';
+  std::vector<Field> A(N*N, SENTINEL);
+
+  auto value = [&](CB_INT i, CB_INT j) { return Field(i + j*N); };
+
+  if( grid.iProcRow() == 0 and grid.iProcCol() == 0 ) {
+
+    for(auto j = 0; j < N; j++)
+    for(auto i = 0; i < N; i++) A[i + j*N] = value(i,j);
+
+    TRBS2D(grid.iContxt(),"All"," ",UPLO,"N",N,N,A.data(),N);
+
+  } else {
+    
+    TRBR2D(grid.iContxt(),"All"," ",UPLO,"N",N,N,A.data(),N,0,0);
+
+    for(auto j = 0; j < N; j++)
+    for(auto i = 0; i < N; i++) {
+      const bool inTri = LOWER ? i >= j : i <= j;
+      EXPECT_EQ( A[i + j*N], inTri ? value(i,j) : SENTINEL );
+    }
+
+  }
+
+  // Integer broadcast
+  std::vector<CB_INT> IA(N, grid.iProcRow());
+  if( grid.iProcRow() == 0 and grid.iProcCol() == 0 ) {
+    std::iota(IA.begin(),IA.end(),0);
+    GEBS2D(grid.iContxt(),"All"," ",N,1,IA.data(),N);
+  } else {
+    GEBR2D(grid.iContxt(),"All"," ",N,1,IA.data(),N,0,0);
+    for(auto i = 0; i < N; i++) EXPECT_EQ( IA[i], i );
+  }
+
+  // Synchronize processes
+  MPI_Barrier(MPI_COMM_WORLD);
+
+}
+
+
+
+template <typename Field>
+void trsd_test( const char *UPLO, CB_INT N ) {
+
+  // Synchronize processes
+  MPI_Barrier(MPI_COMM_WORLD);
+
+  BlacsGrid grid(MPI_COMM_WORLD,2,2);
+
+  const Field SENTINEL = 7.;
+  const bool  LOWER    = UPLO[0] == 'L';
+  const CB_INT lastRow = grid.nProcRow() - 1, lastCol = grid.nProcCol() - 1;
+
+  std::vector<Field> A(N*N, SENTINEL);
+
+  auto value = [&](CB_INT i, CB_INT j) { return Field(i + j*N); };
+
+  const bool iAmSrc  = grid.iProcRow() == 0       and grid.iProcCol() == 0;
+  const bool iAmDest = grid.iProcRow() == lastRow and grid.iProcCol() == lastCol;
+
+  if( iAmSrc and not iAmDest ) {
+
+    for(auto j = 0; j < N; j++)
+    for(auto i = 0; i < N; i++) A[i + j*N] = value(i,j);
+
+    // Unit diagonal is not transferred
+    TRSD2D(grid.iContxt(),UPLO,"U",N,N,A.data(),N,lastRow,lastCol);
+
+  } else if( iAmDest and not iAmSrc ) {
+
+    TRRV2D(grid.iContxt(),UPLO,"U",N,N,A.data(),N,0,0);
+
+    for(auto j = 0; j < N; j++)
+    for(auto i = 0; i < N; i++) {
+      const bool inTri = LOWER ? i > j : i < j;
+      EXPECT_EQ( A[i + j*N], inTri ? value(i,j) : SENTINEL );
+    }
+
+  } else EXPECT_TRUE(true);
+
+  // Synchronize processes
+  MPI_Barrier(MPI_COMM_WORLD);
+
+}
+
+
+
+template <typename Field>
+void nonblocking_test( CB_INT N ) {
+
+  // Synchronize processes
+  MPI_Barrier(MPI_COMM_WORLD);
+
+  BlacsGrid grid(MPI_COMM_WORLD,2,2);
+
+  const Field val = proc_value<Field>(grid,grid.iProcRow(),grid.iProcCol());
+
+  std::vector<Field> ARow(N,val), ACol(N,val), AAll(N,val), ABcast(N,val);
+
+  // Post all operations before completing any of them
+  std::vector<MPIRequest> reqs;
+  reqs.emplace_back(grid.IAllReduce("Row"   ,N,ARow.data()));
+  reqs.emplace_back(grid.IAllReduce("Column",N,ACol.data()));
+  reqs.emplace_back(grid.IAllReduce("All"   ,N,AAll.data()));
+  reqs.emplace_back(
+    grid.IBroadcast("All",N,ABcast.data(),grid.nProcRow()-1,0));
+
+  WaitAll(reqs);
+
+  Field refRow = 0., refCol = 0., refAll = 0.;
+  for(auto j = 0; j < grid.nProcCol(); j++)
+    refRow += proc_value<Field>(grid,grid.iProcRow(),j);
+  for(auto i = 0; i < grid.nProcRow(); i++)
+    refCol += proc_value<Field>(grid,i,grid.iProcCol());
+  for(auto i = 0; i < grid.nProcRow(); i++)
+  for(auto j = 0; j < grid.nProcCol(); j++)
+    refAll += proc_value<Field>(grid,i,j);
+
+  const Field refBcast = proc_value<Field>(grid,grid.nProcRow()-1,0);
+
+  for(auto k = 0; k < N; k++) {
+    EXPECT_EQ( ARow[k],   refRow   );
+    EXPECT_EQ( ACol[k],   refCol   );
+    EXPECT_EQ( AAll[k],   refAll   );
+    EXPECT_EQ( ABcast[k], refBcast );
+  }
+
+  // Synchronize processes
+  MPI_Barrier(MPI_COMM_WORLD);
+
+}
+
+
+
+TEST(GRID_COMM,GRID_COMM) {
+
+  // Synchronize processes
+  MPI_Barrier(MPI_COMM_WORLD);
+
+  BlacsGrid grid(MPI_COMM_WORLD,2,2);
+
+  int rowSize, rowRank, colSize, colRank;
+  MPI_Comm_size(grid.rowComm(),&rowSize);
+  MPI_Comm_rank(grid.rowComm(),&rowRank);
+  MPI_Comm_size(grid.colComm(),&colSize);
+  MPI_Comm_rank(grid.colComm(),&colRank);
+
+  EXPECT_EQ( rowSize, grid.nProcCol() );
+  EXPECT_EQ( colSize, grid.nProcRow() );
+  EXPECT_EQ( rowRank, grid.iProcCol() );
+  EXPECT_EQ( colRank, grid.iProcRow() );
+
+  EXPECT_EQ( grid.scopeComm("Row"),    grid.rowComm() );
+  EXPECT_EQ( grid.scopeComm("Column"), grid.colComm() );
+  EXPECT_EQ( grid.scopeComm("All"),    grid.comm()    );
+
+  // Scope ranks agree with the ranks of the scope communicators
+  int allRank; MPI_Comm_rank(grid.comm(),&allRank);
+  EXPECT_EQ( grid.scopeRank("Row",   grid.iProcRow(),grid.iProcCol()), rowRank );
+  EXPECT_EQ( grid.scopeRank("Column",grid.iProcRow(),grid.iProcCol()), colRank );
+  EXPECT_EQ( grid.scopeRank("All",   grid.iProcRow(),grid.iProcCol()), allRank );
+
+  // Synchronize processes
+  MPI_Barrier(MPI_COMM_WORLD);
+
+}
+
+
+
+TEST(GRID_SPLIT,GRID_SPLIT) {
+
+  // Synchronize processes
+  MPI_Barrier(MPI_COMM_WORLD);
+
+  BlacsGrid grid(MPI_COMM_WORLD,2,2);
+
+  // Even / odd ranks
+  BlacsGrid parity = grid.split(grid.iProc() % 2);
+
+  EXPECT_TRUE( parity.i_participate() );
+  EXPECT_EQ( parity.nProc(), (grid.nProc() + 1 - grid.iProc() % 2) / 2 );
+  EXPECT_EQ( parity.iProc(), grid.iProc() / 2 );
+  EXPECT_EQ( parity.MB(), grid.MB() );
+  EXPECT_EQ( parity.NB(), grid.NB() );
+
+  // Only rank 0
+  BlacsGrid root = grid.split(grid.iProc() == 0 ? 0 : -1);
+
+  EXPECT_EQ( root.i_participate(), grid.iProc() == 0 );
+  if( not root.i_participate() ) {
+    EXPECT_EQ( root.getLocalDims(CXXBLACS_N,CXXBLACS_N), INDX(0,0) );
+    EXPECT_EQ( root.descInit(CXXBLACS_N,CXXBLACS_N,0,0,1)[1], -1 );
+  }
+
+  // Grids may be moved, but the BLACS context is not duplicated
+  BlacsGrid moved(std::move(parity));
+  EXPECT_TRUE ( moved.i_participate()  );
+  EXPECT_FALSE( parity.i_participate() );
+
+  // Synchronize processes
+  MPI_Barrier(MPI_COMM_WORLD);
+
+}
+
+TEST(GRID_SPLIT,GRID_SUBGRID) {
+
+  // Synchronize processes
+  MPI_Barrier(MPI_COMM_WORLD);
+
+  BlacsGrid grid(MPI_COMM_WORLD,2,2);
+
+  // First process row, last process column
+  auto row = grid.subgrid({0,1},{0,grid.nProcCol()});
+  auto col = grid.subgrid({0,grid.nProcRow()},
+    {grid.nProcCol()-1,grid.nProcCol()});
+
+  EXPECT_EQ( row.i_participate(), grid.iProcRow() == 0 );
+  EXPECT_EQ( col.i_participate(), grid.iProcCol() == grid.nProcCol()-1 );
+
+  if( row.i_participate() ) {
+    EXPECT_EQ( row.nProcRow(), 1 );
+    EXPECT_EQ( row.nProcCol(), grid.nProcCol() );
+    EXPECT_EQ( row.iProcCol(), grid.iProcCol() );
+  }
+
+  if( col.i_participate() ) {
+    EXPECT_EQ( col.nProcRow(), grid.nProcRow() );
+    EXPECT_EQ( col.nProcCol(), 1 );
+    EXPECT_EQ( col.iProcRow(), grid.iProcRow() );
+  }
+
+  EXPECT_THROW( grid.subgrid({0,grid.nProcRow()+1},{0,1}), 
+    std::runtime_error );
+
+  // Synchronize processes
+  MPI_Barrier(MPI_COMM_WORLD);
+
+}
+
+TEST(GRID_SPLIT,GRID_SPLIT_REDISTRIBUTE) {
+
+  // Synchronize processes
+  MPI_Barrier(MPI_COMM_WORLD);
+
+  BlacsGrid grid(MPI_COMM_WORLD,2,2);
+
+  const CB_INT M = CXXBLACS_N, N = CXXBLACS_N + 2;
+
+  CB_INT MLoc, NLoc;
+  std::tie(MLoc,NLoc) = grid.getLocalDims(M,N);
+
+  std::vector<double> A(MLoc * NLoc), B(MLoc * NLoc, 0.);
+  for( CB_INT j = 0; j < NLoc; j++ )
+  for( CB_INT i = 0; i < MLoc; i++ ) {
+
+    CB_INT I, J;
+    std::tie(I,J) = grid.globalFromLocal(i,j);
+    A[i + j*MLoc] = I + J*M;
+
+  }
+
+  auto DescA = grid.descInit(M,N,0,0,MLoc);
+
+  // Parent context redistributes between the independent halves
+  BlacsGrid lo = grid.split(grid.iProc() <  (grid.nProc()+1)/2 ? 0 : -1);
+  BlacsGrid hi = grid.split(grid.iProc() >= (grid.nProc()+1)/2 ? 0 : -1);
+
+  CB_INT MLo, NLo, MHi, NHi;
+  std::tie(MLo,NLo) = lo.getLocalDims(M,N);
+  std::tie(MHi,NHi) = hi.getLocalDims(M,N);
+
+  std::vector<double> ALo(MLo * NLo), AHi(MHi * NHi);
+  auto DescLo = lo.descInit(M,N,0,0,MLo);
+  auto DescHi = hi.descInit(M,N,0,0,MHi);
+
+  PGEMR2D(M,N,A.data()  ,1,1,DescA ,ALo.data(),1,1,DescLo,grid.iContxt());
+  if( grid.nProc() > 1 )
+    PGEMR2D(M,N,ALo.data(),1,1,DescLo,AHi.data(),1,1,DescHi,grid.iContxt());
+  else AHi = ALo;
+
+  if( grid.nProc() > 1 )
+    PGEMR2D(M,N,AHi.data(),1,1,DescHi,B.data(),1,1,DescA,grid.iContxt());
+  else B = AHi;
+
+  EXPECT_EQ( grid.DiffMaxAbs(M,N,A.data(),MLoc,B.data(),MLoc), 0. );
+
+  // Synchronize processes
+  MPI_Barrier(MPI_COMM_WORLD);
+
+}
+
+
+TEST(TOPOLOGY,TOPOLOGY_SELECT) {
+
+  BroadcastTopology top;
+
+  EXPECT_EQ( top.select("All",4,1024), ' ' );
+
+  top.set("Row",2,8   ,'I');
+  top.set("Row",2,1024,'H');
+  top.set("All",4,64  ,'S');
+
+  EXPECT_TRUE ( top.covers("Row",2)    );
+  EXPECT_FALSE( top.covers("Column",2) );
+
+  // Largest calibrated bucket not exceeding the request
+  EXPECT_EQ( top.select("Row",2,1     ), 'I' );
+  EXPECT_EQ( top.select("Row",2,512   ), 'I' );
+  EXPECT_EQ( top.select("Row",2,1024  ), 'H' );
+  EXPECT_EQ( top.select("Row",2,1<<20 ), 'H' );
+  EXPECT_EQ( top.select("All",4,8     ), 'S' );
+  EXPECT_EQ( top.select("All",2,8     ), ' ' );
+  EXPECT_EQ( top.select("Column",2,8  ), ' ' );
+
+  // Round trip through the cache format
+  top.set("Column",3,8,' ');
+  std::stringstream ss;
+  top.save(ss);
+
+  BroadcastTopology top2;
+  top2.load(ss);
+  for( CB_INT b : {1, 512, 1024, 1<<20} ) 
+    EXPECT_EQ( top2.select("Row",2,b), top.select("Row",2,b) );
+  EXPECT_EQ( top2.select("All",4,8), 'S' );
+  EXPECT_TRUE( top2.covers("Column",3) );
+  EXPECT_EQ( top2.select("Column",3,8), ' ' );
+
+}
+
+TEST(TOPOLOGY,TOPOLOGY_TUNE) {
+
+  // Synchronize processes
+  MPI_Barrier(MPI_COMM_WORLD);
+
+  const std::string cache = "cxxblacs_topology_test.cache";
+  setenv("CXXBLACS_TOPOLOGY_CACHE",cache.c_str(),1);
+
+  BlacsGrid grid(MPI_COMM_WORLD,2,2);
+  grid.tuneBroadcast(false,12);
+
+  // Broadcast with the selected topology
+  const CB_INT N = 100;
+  std::vector<double> A(N, grid.iProcRow() + grid.iProcCol());
+  grid.Broadcast("Row",N,1,A.data(),N,grid.iProcRow(),0);
+  for(auto &a : A) EXPECT_EQ( a, grid.iProcRow() );
+
+  grid.Broadcast("All",N,1,A.data(),N,0,0);
+  for(auto &a : A) EXPECT_EQ( a, 0. );
+
+  // Every process selects the same topology
+  char top = grid.broadcastTopology("All",N*sizeof(double));
+  char topRoot = top;
+  MPI_Bcast(&topRoot,1,MPI_CHAR,0,MPI_COMM_WORLD);
+  EXPECT_EQ( top, topRoot );
+
+  // The cache now covers this grid
+  BroadcastTopology cached;
+  EXPECT_TRUE( cached.loadFile(cache,MPI_COMM_WORLD) );
+  if( grid.nProc() > 1 ) { EXPECT_FALSE( cached.empty() ); }
+
+  MPI_Barrier(MPI_COMM_WORLD);
+  RootExecute(MPI_COMM_WORLD,[&](){ std::remove(cache.c_str()); });
+
+  // Synchronize processes
+  MPI_Barrier(MPI_COMM_WORLD);
+
+}
+
+
+
+template <typename Field>
+void nonblocking_p2p_test() {
+
+  // Synchronize processes
+  MPI_Barrier(MPI_COMM_WORLD);
+
+  BlacsGrid grid(MPI_COMM_WORLD,2,2);
+
+  const CB_INT NPCOL = grid.nProcCol();
+  const CB_INT NPROC = grid.nProcRow() * NPCOL;
+  const CB_INT ME    = grid.iProcRow() * NPCOL + grid.iProcCol();
+  const CB_INT NEXT  = (ME + 1) % NPROC, PREV = (ME + NPROC - 1) % NPROC;
+
+  // Strided 3 x 4 submatrices in both send and receive buffers
+  const CB_INT M = 3, N = 4, LDS = 7, LDR = 5;
+  const Field  SENTINEL = -1.;
+
+  auto value = [&](CB_INT p, CB_INT i, CB_INT j) { 
+    return Field(p + 10*i + 100*j); 
+  };
+
+  std::vector<Field> S(LDS*N, SENTINEL), R(LDR*N, SENTINEL);
+  for(auto j = 0; j < N; j++)
+  for(auto i = 0; i < M; i++) S[i + j*LDS] = value(ME,i,j);
+
+  {
+    auto rreq = grid.Irecv(M,N,R.data(),LDR,PREV / NPCOL,PREV % NPCOL);
+    auto sreq = grid.Isend(M,N,S.data(),LDS,NEXT / NPCOL,NEXT % NPCOL);
+    rreq.wait();
+    EXPECT_TRUE( rreq.test() );
+  } // sreq completed on destruction
+
+  for(auto j = 0; j < N; j++)
+  for(auto i = 0; i < LDR; i++)
+    EXPECT_EQ( R[i + j*LDR], i < M ? value(PREV,i,j) : SENTINEL );
+
+  // Strided row broadcast from the last process column
+  std::vector<Field> B(LDS*N, SENTINEL);
+  if( grid.iProcCol() == NPCOL - 1 ) B = S;
+
+  grid.IBroadcast("Row",M,N,B.data(),LDS,grid.iProcRow(),NPCOL-1).wait();
+
+  const CB_INT ROOT = grid.iProcRow() * NPCOL + NPCOL - 1;
+  for(auto j = 0; j < N; j++)
+  for(auto i = 0; i < LDS; i++)
+    EXPECT_EQ( B[i + j*LDS], i < M ? value(ROOT,i,j) : SENTINEL );
+
+  // Synchronize processes
+  MPI_Barrier(MPI_COMM_WORLD);
+
+}
+
+
+
+#define BLACS_TEST_IMPL(NAME,F)\
+  TEST(BLACS_COLLECTIVE,GAMXN2D_##NAME) { gamxn_test<F>(); }\
+  TEST(BLACS_COLLECTIVE,TRBS2D_L_##NAME) { trbs_test<F>("L",CXXBLACS_N); }\
+  TEST(BLACS_COLLECTIVE,TRBS2D_U_##NAME) { trbs_test<F>("U",CXXBLACS_N); }\
+  TEST(BLACS_P2P,TRSD2D_L_##NAME) { trsd_test<F>("L",CXXBLACS_N); }\
+  TEST(BLACS_P2P,TRSD2D_U_##NAME) { trsd_test<F>("U",CXXBLACS_N); }\
+  TEST(NONBLOCKING,NONBLOCKING_##NAME) { nonblocking_test<F>(CXXBLACS_N); }\
+  TEST(NONBLOCKING,NONBLOCKING_P2P_##NAME) { nonblocking_p2p_test<F>(); }
+
+BLACS_TEST_IMPL(Double ,double              );
+BLACS_TEST_IMPL(CDouble,std::complex<double>);
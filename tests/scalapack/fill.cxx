@@ -0,0 +1,140 @@
+/*
+ *  A simple C++ Wrapper for BLACS along with minimal extra functionality to 
+ *  aid the the high-level development of distributed memory linear algebra.
+ *  Copyright (C) 2016-2018 David Williams-Young
+
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "scalapack_ut.hpp"
+#include <numeric>
+
+template <typename Field, typename RealType>
+void compare_mat( CB_INT M, CB_INT N, const std::vector<Field> &A, 
+  const std::vector<Field> &B ) {
+
+  RealType maxDiff = 0.;
+  for(auto k = 0; k < M*N; k++)
+    maxDiff = std::max(maxDiff,RealType(std::abs(A[k] - B[k])));
+
+  EXPECT_NEAR( maxDiff, 0., 1e-10 ) << "MAX DIFF " << maxDiff;
+
+}
+
+
+
+template <typename Field, typename RealType, CB_INT MB>
+void placpy_test( char UPLO, CB_INT M, CB_INT N ) {
+
+  // Synchronize processes
+  MPI_Barrier(MPI_COMM_WORLD);
+
+  BlacsGrid grid(MPI_COMM_WORLD,MB,MB);
+
+  const Field ALPHA = 2., BETA = 3.;
+
+  std::vector<Field> A, B, Ref, ALoc, BLoc;
+
+  CB_INT ALocR, ALocC;
+  std::tie(ALocR,ALocC) = grid.getLocalDims(M,N);
+  ALoc.resize(ALocR * ALocC);
+  BLoc.resize(ALocR * ALocC);
+  auto DescA = grid.descInit(M,N,0,0,ALocR);
+
+  RootExecute(MPI_COMM_WORLD,[&](){
+    A.resize(M*N); B.resize(M*N);
+    for(auto &x : A) x = generate<Field>();
+
+    Ref.resize(M*N);
+    for(auto j = 0; j < N; j++)
+    for(auto i = 0; i < M; i++) {
+      const bool inTri = (UPLO == 'L') ? i >= j : 
+                         (UPLO == 'U') ? i <= j : true;
+      Ref[i + j*M] = (i == j) ? BETA : ALPHA;
+      if( inTri ) Ref[i + j*M] = A[i + j*M];
+    }
+  });
+
+  grid.Scatter(M,N,A.data(),M,ALoc.data(),ALocR,0,0);
+
+  PLASET('A',M,N,ALPHA,BETA,BLoc.data(),1,1,DescA);
+  PLACPY(UPLO,M,N,ALoc.data(),1,1,DescA,BLoc.data(),1,1,DescA);
+
+  grid.Gather(M,N,B.data(),M,BLoc.data(),ALocR,0,0);
+
+  RootExecute(MPI_COMM_WORLD,[&](){ compare_mat<Field,RealType>(M,N,B,Ref); });
+  NotRootExecute(MPI_COMM_WORLD,[&](){ EXPECT_TRUE(true); });
+
+  // Synchronize processes
+  MPI_Barrier(MPI_COMM_WORLD);
+
+}
+
+
+
+template <typename Field, typename RealType, CB_INT MB>
+void permute_test( char ROWCOL, CB_INT M, CB_INT N ) {
+
+  // Synchronize processes
+  MPI_Barrier(MPI_COMM_WORLD);
+
+  BlacsGrid grid(MPI_COMM_WORLD,MB,MB);
+
+  std::vector<Field> A, Ref, ALoc;
+
+  CB_INT ALocR, ALocC;
+  std::tie(ALocR,ALocC) = grid.getLocalDims(M,N);
+  ALoc.resize(ALocR * ALocC);
+
+  // Same permutation on every process
+  const CB_INT NP = ROWCOL == 'R' ? M : N;
+  std::vector<CB_INT> PERM(NP);
+  std::iota(PERM.begin(),PERM.end(),0);
+  std::shuffle(PERM.begin(),PERM.end(),std::default_random_engine(5));
+
+  RootExecute(MPI_COMM_WORLD,[&](){
+    A.resize(M*N);
+    for(auto &x : A) x = generate<Field>();
+
+    Ref.resize(M*N);
+    for(auto j = 0; j < N; j++)
+    for(auto i = 0; i < M; i++) 
+      Ref[i + j*M] = (ROWCOL == 'R') ? A[PERM[i] + j*M] : A[i + PERM[j]*M];
+  });
+
+  grid.Scatter(M,N,A.data(),M,ALoc.data(),ALocR,0,0);
+
+  if( ROWCOL == 'R' ) grid.PermuteRows(M,N,ALoc.data(),ALocR,PERM.data());
+  else                grid.PermuteColumns(M,N,ALoc.data(),ALocR,PERM.data());
+
+  grid.Gather(M,N,A.data(),M,ALoc.data(),ALocR,0,0);
+
+  RootExecute(MPI_COMM_WORLD,[&](){ compare_mat<Field,RealType>(M,N,A,Ref); });
+  NotRootExecute(MPI_COMM_WORLD,[&](){ EXPECT_TRUE(true); });
+
+  // Synchronize processes
+  MPI_Barrier(MPI_COMM_WORLD);
+
+}
+
+
+
+#define FILL_TEST_IMPL(NAME,F,RF)\
+  TEST(PLACPY,PLACPY_A_##NAME) { placpy_test<F,RF,2>('A',CXXBLACS_M,CXXBLACS_N); }\
+  TEST(PLACPY,PLACPY_L_##NAME) { placpy_test<F,RF,2>('L',CXXBLACS_M,CXXBLACS_N); }\
+  TEST(PLACPY,PLACPY_U_##NAME) { placpy_test<F,RF,2>('U',CXXBLACS_M,CXXBLACS_N); }\
+  TEST(PLAPIV,PLAPIV_R_##NAME) { permute_test<F,RF,2>('R',CXXBLACS_M,CXXBLACS_N); }\
+  TEST(PLAPIV,PLAPIV_C_##NAME) { permute_test<F,RF,2>('C',CXXBLACS_M,CXXBLACS_N); }
+
+FILL_TEST_IMPL(Double ,double              ,double);
+FILL_TEST_IMPL(CDouble,std::complex<double>,double);
@@ -0,0 +1,289 @@
+/*
+ *  A simple C++ Wrapper for BLACS along with minimal extra functionality to 
+ *  aid the the high-level development of distributed memory linear algebra.
+ *  Copyright (C) 2016-2018 David Williams-Young
+
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "scalapack_ut.hpp"
+
+template <typename T> T SmartConj(const T x) { return x; }
+template <typename T> std::complex<T> SmartConj(const std::complex<T> x) {
+  return std::conj(x);
+}
+
+// Distributed N x 1 vector
+template <typename Field>
+struct DistVector {
+
+  std::vector<Field> global, local;
+  ScaLAPACK_Desc_t   desc;
+  CB_INT             NLocR;
+
+  DistVector( BlacsGrid &grid, CB_INT N ) {
+
+    CB_INT NLocC;
+    std::tie(NLocR,NLocC) = grid.getLocalDims(N,1);
+    local.resize(NLocR * NLocC);
+    desc = grid.descInit(N,1,0,0,NLocR);
+
+    RootExecute(MPI_COMM_WORLD,[&](){
+      global.resize(N);
+      for(auto &x : global) x = generate<Field>();
+    });
+
+    grid.Scatter(N,1,global.data(),N,local.data(),NLocR,0,0);
+
+  }
+
+  void gather( BlacsGrid &grid, std::vector<Field> &v ) {
+    grid.Gather(desc[2],1,v.data(),desc[2],local.data(),NLocR,0,0);
+  }
+
+};
+
+template <typename Field, typename RealType>
+void compare_vec( const std::vector<Field> &x, const std::vector<Field> &y ){
+
+  RealType maxDiff = 0.;
+  for(size_t k = 0; k < x.size(); k++) 
+    maxDiff = std::max(maxDiff,RealType(std::abs(x[k] - y[k])));
+
+  EXPECT_NEAR( maxDiff, 0., 1e-10 ) << "MAX DIFF " << maxDiff;
+
+}
+
+
+
+template <typename Field, typename RealType, CB_INT MB>
+void pgemv_test( char TRANS, CB_INT M, CB_INT N ) {
+
+  // Synchronize processes
+  MPI_Barrier(MPI_COMM_WORLD);
+
+  BlacsGrid grid(MPI_COMM_WORLD,MB,MB);
+
+  const Field  ALPHA = 0.5, BETA = 2.;
+  const CB_INT NX = TRANS == 'N' ? N : M;
+  const CB_INT NY = TRANS == 'N' ? M : N;
+
+  std::vector<Field> A, ALoc, Ref, Y(NY);
+
+  CB_INT ALocR, ALocC;
+  std::tie(ALocR,ALocC) = grid.getLocalDims(M,N);
+  ALoc.resize(ALocR * ALocC);
+  auto DescA = grid.descInit(M,N,0,0,ALocR);
+
+  DistVector<Field> x(grid,NX), y(grid,NY);
+
+  RootExecute(MPI_COMM_WORLD,[&](){
+    A.resize(M*N);
+    for(auto &a : A) a = generate<Field>();
+
+    Ref = y.global;
+    GEMM(TRANS,'N',NY,1,NX,ALPHA,A.data(),M,x.global.data(),NX,BETA,
+      Ref.data(),NY);
+  });
+
+  grid.Scatter(M,N,A.data(),M,ALoc.data(),ALocR,0,0);
+
+  PGEMV(TRANS,M,N,ALPHA,ALoc.data(),1,1,DescA,x.local.data(),1,1,x.desc,1,
+    BETA,y.local.data(),1,1,y.desc,1);
+
+  y.gather(grid,Y);
+
+  RootExecute(MPI_COMM_WORLD,[&](){ compare_vec<Field,RealType>(Y,Ref); });
+  NotRootExecute(MPI_COMM_WORLD,[&](){ EXPECT_TRUE(true); });
+
+  // Synchronize processes
+  MPI_Barrier(MPI_COMM_WORLD);
+
+}
+
+
+
+template <typename Field, typename RealType, CB_INT MB>
+void phemv_test( char UPLO, CB_INT N ) {
+
+  // Synchronize processes
+  MPI_Barrier(MPI_COMM_WORLD);
+
+  BlacsGrid grid(MPI_COMM_WORLD,MB,MB);
+
+  const Field  ALPHA = 0.5, BETA = 2.;
+
+  std::vector<Field> A, ALoc, Ref, Y(N);
+
+  CB_INT ALocR, ALocC;
+  std::tie(ALocR,ALocC) = grid.getLocalDims(N,N);
+  ALoc.resize(ALocR * ALocC);
+  auto DescA = grid.descInit(N,N,0,0,ALocR);
+
+  DistVector<Field> x(grid,N), y(grid,N);
+
+  RootExecute(MPI_COMM_WORLD,[&](){
+    A.resize(N*N);
+    for(auto i = 0; i < N; i++)
+    for(auto j = 0; j <= i; j++) {
+      A[i + j*N] = generate<Field>();
+      A[j + i*N] = SmartConj(A[i + j*N]);
+      if( i == j ) A[i + j*N] = std::real(A[i + j*N]);
+    }
+
+    Ref = y.global;
+    GEMM('N','N',N,1,N,ALPHA,A.data(),N,x.global.data(),N,BETA,
+      Ref.data(),N);
+  });
+
+  grid.Scatter(N,N,A.data(),N,ALoc.data(),ALocR,0,0);
+
+  PHEMV(UPLO,N,ALPHA,ALoc.data(),1,1,DescA,x.local.data(),1,1,x.desc,1,
+    BETA,y.local.data(),1,1,y.desc,1);
+
+  y.gather(grid,Y);
+
+  RootExecute(MPI_COMM_WORLD,[&](){ compare_vec<Field,RealType>(Y,Ref); });
+  NotRootExecute(MPI_COMM_WORLD,[&](){ EXPECT_TRUE(true); });
+
+  // Synchronize processes
+  MPI_Barrier(MPI_COMM_WORLD);
+
+}
+
+
+
+template <typename Field, typename RealType, CB_INT MB>
+void pger_test( bool conjugate, CB_INT M, CB_INT N ) {
+
+  // Synchronize processes
+  MPI_Barrier(MPI_COMM_WORLD);
+
+  BlacsGrid grid(MPI_COMM_WORLD,MB,MB);
+
+  const Field ALPHA = 0.5;
+
+  std::vector<Field> A, ALoc, Ref;
+
+  CB_INT ALocR, ALocC;
+  std::tie(ALocR,ALocC) = grid.getLocalDims(M,N);
+  ALoc.resize(ALocR * ALocC);
+  auto DescA = grid.descInit(M,N,0,0,ALocR);
+
+  DistVector<Field> x(grid,M), y(grid,N);
+
+  RootExecute(MPI_COMM_WORLD,[&](){
+    A.resize(M*N);
+    for(auto &a : A) a = generate<Field>();
+
+    Ref = A;
+    for(auto j = 0; j < N; j++)
+    for(auto i = 0; i < M; i++)
+      Ref[i + j*M] += ALPHA * x.global[i] * 
+        (conjugate ? SmartConj(y.global[j]) : y.global[j]);
+  });
+
+  grid.Scatter(M,N,A.data(),M,ALoc.data(),ALocR,0,0);
+
+  if( conjugate )
+    PGERC(M,N,ALPHA,x.local.data(),1,1,x.desc,1,y.local.data(),1,1,y.desc,
+      1,ALoc.data(),1,1,DescA);
+  else
+    PGER(M,N,ALPHA,x.local.data(),1,1,x.desc,1,y.local.data(),1,1,y.desc,
+      1,ALoc.data(),1,1,DescA);
+
+  grid.Gather(M,N,A.data(),M,ALoc.data(),ALocR,0,0);
+
+  RootExecute(MPI_COMM_WORLD,[&](){ compare_vec<Field,RealType>(A,Ref); });
+  NotRootExecute(MPI_COMM_WORLD,[&](){ EXPECT_TRUE(true); });
+
+  // Synchronize processes
+  MPI_Barrier(MPI_COMM_WORLD);
+
+}
+
+
+
+template <typename Field, typename RealType, CB_INT MB>
+void level1_test( CB_INT N ) {
+
+  // Synchronize processes
+  MPI_Barrier(MPI_COMM_WORLD);
+
+  BlacsGrid grid(MPI_COMM_WORLD,MB,MB);
+
+  // Make sure that ALPHA is the same on all processes
+  Field ALPHA = generate<Field>();
+  grid.Broadcast("All","I",1,1,&ALPHA,1,0,0);
+
+  DistVector<Field> x(grid,N), y(grid,N);
+  std::vector<Field> Y(N), Ref;
+
+  // Reductions (valid in the process column owning the vectors, which
+  // contains the root process)
+  Field    dot  = PDOT (N,x.local.data(),1,1,x.desc,1,y.local.data(),1,1,
+                        y.desc,1);
+  Field    dotc = PDOTC(N,x.local.data(),1,1,x.desc,1,y.local.data(),1,1,
+                        y.desc,1);
+  RealType nrm2 = PNRM2(N,x.local.data(),1,1,x.desc,1);
+
+  // Y = ALPHA * (ALPHA * X + Y)
+  PAXPY(N,ALPHA,x.local.data(),1,1,x.desc,1,y.local.data(),1,1,y.desc,1);
+  PSCAL(N,ALPHA,y.local.data(),1,1,y.desc,1);
+
+  y.gather(grid,Y);
+
+  RootExecute(MPI_COMM_WORLD,[&](){
+
+    Field refDot(0.), refDotc(0.);
+    RealType refNrm2(0.);
+    for(auto k = 0; k < N; k++) {
+      refDot  += x.global[k] * y.global[k];
+      refDotc += SmartConj(x.global[k]) * y.global[k];
+      refNrm2 += std::norm(x.global[k]);
+    }
+
+    EXPECT_NEAR( std::abs(dot  - refDot ), 0., 1e-10 );
+    EXPECT_NEAR( std::abs(dotc - refDotc), 0., 1e-10 );
+    EXPECT_NEAR( nrm2, std::sqrt(refNrm2), 1e-10 );
+
+    Ref = y.global;
+    for(auto k = 0; k < N; k++) 
+      Ref[k] = ALPHA * (ALPHA * x.global[k] + Ref[k]);
+
+    compare_vec<Field,RealType>(Y,Ref);
+
+  });
+
+  NotRootExecute(MPI_COMM_WORLD,[&](){ EXPECT_TRUE(true); });
+
+  // Synchronize processes
+  MPI_Barrier(MPI_COMM_WORLD);
+
+}
+
+
+
+#define LEVEL12_TEST_IMPL(NAME,F,RF)\
+  TEST(PGEMV,PGEMV_N_##NAME) { pgemv_test<F,RF,2>('N',CXXBLACS_M,CXXBLACS_N); }\
+  TEST(PGEMV,PGEMV_T_##NAME) { pgemv_test<F,RF,2>('T',CXXBLACS_M,CXXBLACS_N); }\
+  TEST(PGEMV,PGEMV_C_##NAME) { pgemv_test<F,RF,2>('C',CXXBLACS_M,CXXBLACS_N); }\
+  TEST(PHEMV,PHEMV_L_##NAME) { phemv_test<F,RF,2>('L',CXXBLACS_N); }\
+  TEST(PHEMV,PHEMV_U_##NAME) { phemv_test<F,RF,2>('U',CXXBLACS_N); }\
+  TEST(PGER,PGER_##NAME)  { pger_test<F,RF,2>(false,CXXBLACS_M,CXXBLACS_N); }\
+  TEST(PGER,PGERC_##NAME) { pger_test<F,RF,2>(true ,CXXBLACS_M,CXXBLACS_N); }\
+  TEST(PBLAS1,PBLAS1_##NAME) { level1_test<F,RF,2>(CXXBLACS_M); }
+
+LEVEL12_TEST_IMPL(Double ,double              ,double);
+LEVEL12_TEST_IMPL(CDouble,std::complex<double>,double);
+
@@ -0,0 +1,424 @@
+/*
+ *  A simple C++ Wrapper for BLACS along with minimal extra functionality to 
+ *  aid the the high-level development of distributed memory linear algebra.
+ *  Copyright (C) 2016-2018 David Williams-Young
+
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "scalapack_ut.hpp"
+
+#include <iostream>
+
+template <typename T> T SmartConj(const T x) { return x; }
+template <typename T> std::complex<T> SmartConj(const std::complex<T> x) {
+  return std::conj(x);
+}
+
+// Wall time of a distributed operation (max over processes)
+template <typename Op>
+double time_op( const Op &op ) {
+
+  MPI_Barrier(MPI_COMM_WORLD);
+  double t = MPI_Wtime();
+  op();
+  t = MPI_Wtime() - t;
+
+  MPI_Allreduce(MPI_IN_PLACE,&t,1,MPI_DOUBLE,MPI_MAX,MPI_COMM_WORLD);
+  return t;
+
+}
+
+inline void report_timing( const std::string &name, double t, 
+  double tGEMM ) {
+
+  RootExecute(MPI_COMM_WORLD,[&](){
+    std::cout << "  " << std::setw(8) << name << ": " << std::scientific 
+              << std::setprecision(3) << t << " s, PGEMM equivalent: " 
+              << tGEMM << " s" << std::endl;
+  });
+
+}
+
+// Form a random symmetric (Hermitian) N x N matrix
+template <typename Field>
+void generate_sym( bool herm, CB_INT N, std::vector<Field> &A ) {
+
+  A.resize(N*N);
+  for(auto i = 0; i < N; i++)
+  for(auto j = 0; j <= i; j++) {
+
+    A[i + j*N] = generate<Field>();
+    A[j + i*N] = herm ? SmartConj(A[i + j*N]) : A[i + j*N];
+    if( herm and i == j ) A[i + j*N] = std::real(A[i + j*N]);
+
+  }
+
+}
+
+// Compare the UPLO triangle ('A' for all) of two N x N matricies
+template <typename Field, typename RealType>
+void compare_tri( char UPLO, CB_INT M, CB_INT N, const std::vector<Field> &A,
+  const std::vector<Field> &B ) {
+
+  RealType maxDiff = 0.;
+  for(auto j = 0; j < N; j++)
+  for(auto i = 0; i < M; i++) 
+  if( UPLO == 'A' or (UPLO == 'U' and i <= j) or (UPLO == 'L' and i >= j) )
+    maxDiff = std::max(maxDiff,RealType(std::abs(A[i + j*M] - B[i + j*M])));
+
+  EXPECT_NEAR( maxDiff, 0., 1e-10 ) << "MAX DIFF " << maxDiff;
+
+}
+
+
+
+// C = ALPHA * op(A) * op(A)**T(H) + BETA * C
+template <typename Field, typename RealType, CB_INT MB>
+void rank_k_test( bool herm, char UPLO, char TRANS, CB_INT N, CB_INT K ) {
+
+  // Synchronize processes
+  MPI_Barrier(MPI_COMM_WORLD);
+
+  BlacsGrid grid(MPI_COMM_WORLD,MB,MB);
+
+  const RealType ALPHA = 0.5, BETA = 2.;
+  const bool     NOTRANS = TRANS == 'N';
+  const char     TC      = herm ? 'C' : 'T';
+  const CB_INT   AR      = NOTRANS ? N : K;
+  const CB_INT   AC      = NOTRANS ? K : N;
+
+  std::vector<Field> A, ALoc, C, CLoc, CGEMM, Ref;
+
+  CB_INT ALocR, ALocC, CLocR, CLocC;
+  std::tie(ALocR,ALocC) = grid.getLocalDims(AR,AC);
+  std::tie(CLocR,CLocC) = grid.getLocalDims(N,N);
+
+  ALoc.resize(ALocR * ALocC);
+  CLoc.resize(CLocR * CLocC);
+
+  auto DescA = grid.descInit(AR,AC,0,0,ALocR);
+  auto DescC = grid.descInit(N,N,0,0,CLocR);
+
+  RootExecute(MPI_COMM_WORLD,[&](){
+
+    A.resize(AR*AC);
+    for(auto &x : A) x = generate<Field>();
+    generate_sym(herm,N,C);
+
+    Ref = C;
+    GEMM(NOTRANS ? 'N' : TC, NOTRANS ? TC : 'N',N,N,K,Field(ALPHA),A.data(),
+      AR,A.data(),AR,Field(BETA),Ref.data(),N);
+
+  });
+
+  grid.Scatter(AR,AC,A.data(),AR,ALoc.data(),ALocR,0,0);
+  grid.Scatter(N,N,C.data(),N,CLoc.data(),CLocR,0,0);
+  CGEMM = CLoc;
+
+  double t = time_op([&](){
+    if( herm )
+      PHERK(UPLO,TRANS,N,K,ALPHA,ALoc.data(),1,1,DescA,BETA,CLoc.data(),
+        1,1,DescC);
+    else
+      PSYRK(UPLO,TRANS,N,K,Field(ALPHA),ALoc.data(),1,1,DescA,Field(BETA),
+        CLoc.data(),1,1,DescC);
+  });
+
+  double tGEMM = time_op([&](){
+    PGEMM(NOTRANS ? 'N' : TC, NOTRANS ? TC : 'N',N,N,K,Field(ALPHA),
+      ALoc.data(),1,1,DescA,ALoc.data(),1,1,DescA,Field(BETA),
+      CGEMM.data(),1,1,DescC);
+  });
+
+  report_timing(herm ? "PHERK" : "PSYRK",t,tGEMM);
+
+  grid.Gather(N,N,C.data(),N,CLoc.data(),CLocR,0,0);
+
+  RootExecute(MPI_COMM_WORLD,[&](){ 
+    compare_tri<Field,RealType>(UPLO,N,N,C,Ref); 
+  });
+
+  NotRootExecute(MPI_COMM_WORLD,[&](){ EXPECT_TRUE(true); });
+
+  // Synchronize processes
+  MPI_Barrier(MPI_COMM_WORLD);
+
+}
+
+
+
+// C = ALPHA * op(A) * op(B)**T(H) + ALPHA * op(B) * op(A)**T(H) + BETA * C
+template <typename Field, typename RealType, CB_INT MB>
+void rank_2k_test( bool herm, char UPLO, char TRANS, CB_INT N, CB_INT K ) {
+
+  // Synchronize processes
+  MPI_Barrier(MPI_COMM_WORLD);
+
+  BlacsGrid grid(MPI_COMM_WORLD,MB,MB);
+
+  const RealType ALPHA = 0.5, BETA = 2.;
+  const bool     NOTRANS = TRANS == 'N';
+  const char     TC      = herm ? 'C' : 'T';
+  const char     TA      = NOTRANS ? 'N' : TC;
+  const char     TB      = NOTRANS ? TC : 'N';
+  const CB_INT   AR      = NOTRANS ? N : K;
+  const CB_INT   AC      = NOTRANS ? K : N;
+
+  std::vector<Field> A, ALoc, B, BLoc, C, CLoc, CGEMM, Ref;
+
+  CB_INT ALocR, ALocC, CLocR, CLocC;
+  std::tie(ALocR,ALocC) = grid.getLocalDims(AR,AC);
+  std::tie(CLocR,CLocC) = grid.getLocalDims(N,N);
+
+  ALoc.resize(ALocR * ALocC);
+  BLoc.resize(ALocR * ALocC);
+  CLoc.resize(CLocR * CLocC);
+
+  auto DescA = grid.descInit(AR,AC,0,0,ALocR);
+  auto DescC = grid.descInit(N,N,0,0,CLocR);
+
+  RootExecute(MPI_COMM_WORLD,[&](){
+
+    A.resize(AR*AC);
+    B.resize(AR*AC);
+    for(auto &x : A) x = generate<Field>();
+    for(auto &x : B) x = generate<Field>();
+    generate_sym(herm,N,C);
+
+    Ref = C;
+    GEMM(TA,TB,N,N,K,Field(ALPHA),A.data(),AR,B.data(),AR,Field(BETA),
+      Ref.data(),N);
+    GEMM(TA,TB,N,N,K,Field(ALPHA),B.data(),AR,A.data(),AR,Field(1.),
+      Ref.data(),N);
+
+  });
+
+  grid.Scatter(AR,AC,A.data(),AR,ALoc.data(),ALocR,0,0);
+  grid.Scatter(AR,AC,B.data(),AR,BLoc.data(),ALocR,0,0);
+  grid.Scatter(N,N,C.data(),N,CLoc.data(),CLocR,0,0);
+  CGEMM = CLoc;
+
+  double t = time_op([&](){
+    if( herm )
+      PHER2K(UPLO,TRANS,N,K,Field(ALPHA),ALoc.data(),1,1,DescA,BLoc.data(),
+        1,1,DescA,BETA,CLoc.data(),1,1,DescC);
+    else
+      PSYR2K(UPLO,TRANS,N,K,Field(ALPHA),ALoc.data(),1,1,DescA,BLoc.data(),
+        1,1,DescA,Field(BETA),CLoc.data(),1,1,DescC);
+  });
+
+  double tGEMM = time_op([&](){
+    PGEMM(TA,TB,N,N,K,Field(ALPHA),ALoc.data(),1,1,DescA,BLoc.data(),1,1,
+      DescA,Field(BETA),CGEMM.data(),1,1,DescC);
+    PGEMM(TA,TB,N,N,K,Field(ALPHA),BLoc.data(),1,1,DescA,ALoc.data(),1,1,
+      DescA,Field(1.),CGEMM.data(),1,1,DescC);
+  });
+
+  report_timing(herm ? "PHER2K" : "PSYR2K",t,tGEMM);
+
+  grid.Gather(N,N,C.data(),N,CLoc.data(),CLocR,0,0);
+
+  RootExecute(MPI_COMM_WORLD,[&](){ 
+    compare_tri<Field,RealType>(UPLO,N,N,C,Ref); 
+  });
+
+  NotRootExecute(MPI_COMM_WORLD,[&](){ EXPECT_TRUE(true); });
+
+  // Synchronize processes
+  MPI_Barrier(MPI_COMM_WORLD);
+
+}
+
+
+
+// C = ALPHA * A * B + BETA * C (SIDE = 'L') or 
+// C = ALPHA * B * A + BETA * C (SIDE = 'R'), A symmetric (Hermitian)
+template <typename Field, typename RealType, CB_INT MB>
+void symm_test( bool herm, char SIDE, char UPLO, CB_INT M, CB_INT N ) {
+
+  // Synchronize processes
+  MPI_Barrier(MPI_COMM_WORLD);
+
+  BlacsGrid grid(MPI_COMM_WORLD,MB,MB);
+
+  const Field  ALPHA = 0.5, BETA = 2.;
+  const CB_INT NA    = SIDE == 'L' ? M : N;
+
+  std::vector<Field> A, ALoc, B, BLoc, C, CLoc, CGEMM, Ref;
+
+  CB_INT ALocR, ALocC, CLocR, CLocC;
+  std::tie(ALocR,ALocC) = grid.getLocalDims(NA,NA);
+  std::tie(CLocR,CLocC) = grid.getLocalDims(M,N);
+
+  ALoc.resize(ALocR * ALocC);
+  BLoc.resize(CLocR * CLocC);
+  CLoc.resize(CLocR * CLocC);
+
+  auto DescA = grid.descInit(NA,NA,0,0,ALocR);
+  auto DescC = grid.descInit(M,N,0,0,CLocR);
+
+  RootExecute(MPI_COMM_WORLD,[&](){
+
+    generate_sym(herm,NA,A);
+    B.resize(M*N);
+    C.resize(M*N);
+    for(auto &x : B) x = generate<Field>();
+    for(auto &x : C) x = generate<Field>();
+
+    Ref = C;
+    if( SIDE == 'L' ) 
+      GEMM('N','N',M,N,M,ALPHA,A.data(),M,B.data(),M,BETA,Ref.data(),M);
+    else
+      GEMM('N','N',M,N,N,ALPHA,B.data(),M,A.data(),N,BETA,Ref.data(),M);
+
+  });
+
+  grid.Scatter(NA,NA,A.data(),NA,ALoc.data(),ALocR,0,0);
+  grid.Scatter(M,N,B.data(),M,BLoc.data(),CLocR,0,0);
+  grid.Scatter(M,N,C.data(),M,CLoc.data(),CLocR,0,0);
+  CGEMM = CLoc;
+
+  double t = time_op([&](){
+    if( herm )
+      PHEMM(SIDE,UPLO,M,N,ALPHA,ALoc.data(),1,1,DescA,BLoc.data(),1,1,DescC,
+        BETA,CLoc.data(),1,1,DescC);
+    else
+      PSYMM(SIDE,UPLO,M,N,ALPHA,ALoc.data(),1,1,DescA,BLoc.data(),1,1,DescC,
+        BETA,CLoc.data(),1,1,DescC);
+  });
+
+  double tGEMM = time_op([&](){
+    if( SIDE == 'L' )
+      PGEMM('N','N',M,N,M,ALPHA,ALoc.data(),1,1,DescA,BLoc.data(),1,1,DescC,
+        BETA,CGEMM.data(),1,1,DescC);
+    else
+      PGEMM('N','N',M,N,N,ALPHA,BLoc.data(),1,1,DescC,ALoc.data(),1,1,DescA,
+        BETA,CGEMM.data(),1,1,DescC);
+  });
+
+  report_timing(herm ? "PHEMM" : "PSYMM",t,tGEMM);
+
+  grid.Gather(M,N,C.data(),M,CLoc.data(),CLocR,0,0);
+
+  RootExecute(MPI_COMM_WORLD,[&](){ 
+    compare_tri<Field,RealType>('A',M,N,C,Ref); 
+  });
+
+  NotRootExecute(MPI_COMM_WORLD,[&](){ EXPECT_TRUE(true); });
+
+  // Synchronize processes
+  MPI_Barrier(MPI_COMM_WORLD);
+
+}
+
+
+
+// B = ALPHA * inv(op(A)) * B (SIDE = 'L') or 
+// B = ALPHA * B * inv(op(A)) (SIDE = 'R'), A triangular
+template <typename Field, typename RealType, CB_INT MB>
+void ptrsm_test( char SIDE, char UPLO, char TRANS, CB_INT M, CB_INT N ) {
+
+  // Synchronize processes
+  MPI_Barrier(MPI_COMM_WORLD);
+
+  BlacsGrid grid(MPI_COMM_WORLD,MB,MB);
+
+  const Field  ALPHA = 0.5;
+  const CB_INT NA    = SIDE == 'L' ? M : N;
+
+  std::vector<Field> A, ALoc, B, BLoc, X;
+
+  CB_INT ALocR, ALocC, BLocR, BLocC;
+  std::tie(ALocR,ALocC) = grid.getLocalDims(NA,NA);
+  std::tie(BLocR,BLocC) = grid.getLocalDims(M,N);
+
+  ALoc.resize(ALocR * ALocC);
+  BLoc.resize(BLocR * BLocC);
+
+  auto DescA = grid.descInit(NA,NA,0,0,ALocR);
+  auto DescB = grid.descInit(M,N,0,0,BLocR);
+
+  // Well conditioned triangular A
+  RootExecute(MPI_COMM_WORLD,[&](){
+
+    A.resize(NA*NA);
+    B.resize(M*N);
+    X.resize(M*N);
+    for(auto &x : A) x = generate<Field>();
+    for(auto &x : B) x = generate<Field>();
+    for(auto k = 0; k < NA; k++) A[k*(NA+1)] += Field(NA);
+
+  });
+
+  grid.Scatter(NA,NA,A.data(),NA,ALoc.data(),ALocR,0,0);
+  grid.Scatter(M,N,B.data(),M,BLoc.data(),BLocR,0,0);
+
+  PTRSM(SIDE,UPLO,TRANS,'N',M,N,ALPHA,ALoc.data(),1,1,DescA,BLoc.data(),
+    1,1,DescB);
+
+  grid.Gather(M,N,X.data(),M,BLoc.data(),BLocR,0,0);
+
+  // op(A) * X = ALPHA * B (X * op(A) = ALPHA * B)
+  RootExecute(MPI_COMM_WORLD,[&](){ 
+
+    TRMM(SIDE,UPLO,TRANS,'N',M,N,Field(1.),A.data(),NA,X.data(),M);
+    for(auto &x : B) x *= ALPHA;
+    compare_tri<Field,RealType>('A',M,N,X,B); 
+
+  });
+
+  NotRootExecute(MPI_COMM_WORLD,[&](){ EXPECT_TRUE(true); });
+
+  // Synchronize processes
+  MPI_Barrier(MPI_COMM_WORLD);
+
+}
+
+
+
+
+#define RANK_K_TEST_IMPL(NAME,F,RF,HERM,UPLO,TRANS)\
+  TEST(PSYRK,NAME) { \
+    rank_k_test<F,RF,2>(HERM,UPLO,TRANS,CXXBLACS_N,CXXBLACS_M); };
+#define RANK_2K_TEST_IMPL(NAME,F,RF,HERM,UPLO,TRANS)\
+  TEST(PSYR2K,NAME) { \
+    rank_2k_test<F,RF,2>(HERM,UPLO,TRANS,CXXBLACS_N,CXXBLACS_M); };
+#define SYMM_TEST_IMPL(NAME,F,RF,HERM,SIDE,UPLO)\
+  TEST(PSYMM,NAME) { \
+    symm_test<F,RF,2>(HERM,SIDE,UPLO,CXXBLACS_M,CXXBLACS_N); };
+#define PTRSM_TEST_IMPL(NAME,F,RF,SIDE,UPLO,TRANS)\
+  TEST(PTRSM,NAME) { \
+    ptrsm_test<F,RF,2>(SIDE,UPLO,TRANS,CXXBLACS_M,CXXBLACS_N); };
+
+#define LEVEL3_TEST_IMPL(NAME,F,RF)\
+  RANK_K_TEST_IMPL(PSYRK_L_N_##NAME,F,RF,false,'L','N')\
+  RANK_K_TEST_IMPL(PSYRK_U_T_##NAME,F,RF,false,'U','T')\
+  RANK_K_TEST_IMPL(PHERK_L_N_##NAME,F,RF,true ,'L','N')\
+  RANK_K_TEST_IMPL(PHERK_U_C_##NAME,F,RF,true ,'U','C')\
+  RANK_2K_TEST_IMPL(PSYR2K_L_N_##NAME,F,RF,false,'L','N')\
+  RANK_2K_TEST_IMPL(PSYR2K_U_T_##NAME,F,RF,false,'U','T')\
+  RANK_2K_TEST_IMPL(PHER2K_L_N_##NAME,F,RF,true ,'L','N')\
+  RANK_2K_TEST_IMPL(PHER2K_U_C_##NAME,F,RF,true ,'U','C')\
+  SYMM_TEST_IMPL(PSYMM_L_L_##NAME,F,RF,false,'L','L')\
+  SYMM_TEST_IMPL(PSYMM_R_U_##NAME,F,RF,false,'R','U')\
+  SYMM_TEST_IMPL(PHEMM_L_L_##NAME,F,RF,true ,'L','L')\
+  SYMM_TEST_IMPL(PHEMM_R_U_##NAME,F,RF,true ,'R','U')\
+  PTRSM_TEST_IMPL(PTRSM_L_L_N_##NAME,F,RF,'L','L','N')\
+  PTRSM_TEST_IMPL(PTRSM_L_U_C_##NAME,F,RF,'L','U','C')\
+  PTRSM_TEST_IMPL(PTRSM_R_U_N_##NAME,F,RF,'R','U','N')\
+  PTRSM_TEST_IMPL(PTRSM_R_L_T_##NAME,F,RF,'R','L','T')
+
+LEVEL3_TEST_IMPL(Double ,double              ,double);
+LEVEL3_TEST_IMPL(CDouble,std::complex<double>,double);
+
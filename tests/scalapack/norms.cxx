@@ -0,0 +1,176 @@
+/*
+ *  A simple C++ Wrapper for BLACS along with minimal extra functionality to 
+ *  aid the the high-level development of distributed memory linear algebra.
+ *  Copyright (C) 2016-2018 David Williams-Young
+
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "scalapack_ut.hpp"
+
+template <typename T> T SmartConj(const T x) { return x; }
+template <typename T> std::complex<T> SmartConj(const std::complex<T> x) {
+  return std::conj(x);
+}
+
+// Serial reference norms of a general M x N matrix
+template <typename Field, typename RealType>
+RealType ref_norm( char NORM, CB_INT M, CB_INT N, const std::vector<Field> &A ){
+
+  RealType nrm = 0.;
+
+  if( NORM == 'M' ) 
+    for(auto &a : A) nrm = std::max(nrm,RealType(std::abs(a)));
+
+  else if( NORM == 'F' ) {
+    for(auto &a : A) nrm += std::norm(a);
+    nrm = std::sqrt(nrm);
+  
+  } else if( NORM == '1' ) 
+    for(auto j = 0; j < N; j++) {
+      RealType s = 0.;
+      for(auto i = 0; i < M; i++) s += std::abs(A[i + j*M]);
+      nrm = std::max(nrm,s);
+    }
+
+  else if( NORM == 'I' ) 
+    for(auto i = 0; i < M; i++) {
+      RealType s = 0.;
+      for(auto j = 0; j < N; j++) s += std::abs(A[i + j*M]);
+      nrm = std::max(nrm,s);
+    }
+
+  return nrm;
+
+}
+
+
+
+template <typename Field, typename RealType, CB_INT MB>
+void plan_test( char NORM, char UPLO, CB_INT N ) {
+
+  // Synchronize processes
+  MPI_Barrier(MPI_COMM_WORLD);
+
+  BlacsGrid grid(MPI_COMM_WORLD,MB,MB);
+
+  std::vector<Field> A, AHer, ATri, ALoc, AHerLoc, ATriLoc;
+
+  CB_INT ALocR, ALocC;
+  std::tie(ALocR,ALocC) = grid.getLocalDims(N,N);
+  ALoc.resize(ALocR * ALocC);
+  AHerLoc.resize(ALocR * ALocC);
+  ATriLoc.resize(ALocR * ALocC);
+  auto DescA = grid.descInit(N,N,0,0,ALocR);
+
+  RootExecute(MPI_COMM_WORLD,[&](){
+    A.resize(N*N);
+    for(auto &x : A) x = generate<Field>();
+
+    // Hermitian / triangular matrices referenced by UPLO of A
+    AHer = A; ATri = A;
+    for(auto j = 0; j < N; j++) 
+    for(auto i = 0; i < N; i++) {
+      const bool inTri = (UPLO == 'L') ? i >= j : i <= j;
+      if( not inTri ) {
+        AHer[i + j*N] = SmartConj(A[j + i*N]);
+        ATri[i + j*N] = 0.;
+      }
+    }
+    for(auto i = 0; i < N; i++) 
+      AHer[i + i*N] = std::real(A[i + i*N]);
+  });
+
+  grid.Scatter(N,N,A.data(),N,ALoc.data(),ALocR,0,0);
+  grid.Scatter(N,N,AHer.data(),N,AHerLoc.data(),ALocR,0,0);
+
+  RealType nrmHE = PLANHE(NORM,UPLO,N,AHerLoc.data(),1,1,DescA);
+  RealType nrmTR = PLANTR(NORM,UPLO,'N',N,N,ALoc.data(),1,1,DescA);
+  RealType nrmGE = PLANGE(NORM,N,N,ALoc.data(),1,1,DescA);
+
+  RootExecute(MPI_COMM_WORLD,[&](){ 
+    EXPECT_NEAR( nrmHE, (ref_norm<Field,RealType>(NORM,N,N,AHer)), 1e-10 );
+    EXPECT_NEAR( nrmTR, (ref_norm<Field,RealType>(NORM,N,N,ATri)), 1e-10 );
+    EXPECT_NEAR( nrmGE, (ref_norm<Field,RealType>(NORM,N,N,A   )), 1e-10 );
+  });
+  NotRootExecute(MPI_COMM_WORLD,[&](){ EXPECT_TRUE(true); });
+
+  // Synchronize processes
+  MPI_Barrier(MPI_COMM_WORLD);
+
+}
+
+
+
+template <typename Field, typename RealType, CB_INT MB>
+void grid_reduce_test( CB_INT N ) {
+
+  // Synchronize processes
+  MPI_Barrier(MPI_COMM_WORLD);
+
+  BlacsGrid grid(MPI_COMM_WORLD,MB,MB);
+
+  std::vector<Field> A, B, ALoc, BLoc;
+
+  CB_INT ALocR, ALocC;
+  std::tie(ALocR,ALocC) = grid.getLocalDims(N,N);
+  ALoc.resize(ALocR * ALocC);
+  BLoc.resize(ALocR * ALocC);
+
+  RealType refNrmF = 0., refMax = 0.;
+  Field    refTr   = 0.;
+
+  RootExecute(MPI_COMM_WORLD,[&](){
+    A.resize(N*N); B.resize(N*N);
+    for(auto &x : A) x = generate<Field>();
+    for(auto &x : B) x = generate<Field>();
+
+    for(auto k = 0; k < N*N; k++) {
+      refNrmF += std::norm(A[k] - B[k]);
+      refMax   = std::max(refMax,RealType(std::abs(A[k] - B[k])));
+    }
+    refNrmF = std::sqrt(refNrmF);
+
+    for(auto i = 0; i < N; i++) refTr += A[i + i*N];
+  });
+
+  grid.Scatter(N,N,A.data(),N,ALoc.data(),ALocR,0,0);
+  grid.Scatter(N,N,B.data(),N,BLoc.data(),ALocR,0,0);
+
+  RealType nrmF = grid.DiffNormF(N,N,ALoc.data(),ALocR,BLoc.data(),ALocR);
+  RealType mx   = grid.DiffMaxAbs(N,N,ALoc.data(),ALocR,BLoc.data(),ALocR);
+  Field    tr   = grid.Trace(N,ALoc.data(),ALocR);
+
+  RootExecute(MPI_COMM_WORLD,[&](){ 
+    EXPECT_NEAR( nrmF, refNrmF, 1e-10 );
+    EXPECT_NEAR( mx  , refMax , 1e-10 );
+    EXPECT_NEAR( std::abs(tr - refTr), 0., 1e-10 );
+  });
+  NotRootExecute(MPI_COMM_WORLD,[&](){ EXPECT_TRUE(true); });
+
+  // Synchronize processes
+  MPI_Barrier(MPI_COMM_WORLD);
+
+}
+
+
+
+#define NORMS_TEST_IMPL(NAME,F,RF)\
+  TEST(PLAN,PLAN_M_L_##NAME) { plan_test<F,RF,2>('M','L',CXXBLACS_N); }\
+  TEST(PLAN,PLAN_F_U_##NAME) { plan_test<F,RF,2>('F','U',CXXBLACS_N); }\
+  TEST(PLAN,PLAN_1_L_##NAME) { plan_test<F,RF,2>('1','L',CXXBLACS_N); }\
+  TEST(PLAN,PLAN_I_U_##NAME) { plan_test<F,RF,2>('I','U',CXXBLACS_N); }\
+  TEST(GRIDREDUCE,GRIDREDUCE_##NAME) { grid_reduce_test<F,RF,2>(CXXBLACS_N); }
+
+NORMS_TEST_IMPL(Double ,double              ,double);
+NORMS_TEST_IMPL(CDouble,std::complex<double>,double);
@@ -0,0 +1,110 @@
+/*
+ *  A simple C++ Wrapper for BLACS along with minimal extra functionality to 
+ *  aid the the high-level development of distributed memory linear algebra.
+ *  Copyright (C) 2016-2018 David Williams-Young
+
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "scalapack_ut.hpp"
+
+
+// Check Q**H * Q = I and Q * R = A on the root process
+template <typename Field, typename RealType>
+void check_qr( CB_INT M, CB_INT N, std::vector<Field> &A, 
+  std::vector<Field> &Q, std::vector<Field> &R, CB_INT LDR ) {
+
+  std::vector<Field> QtQ(N*N);
+  GEMM('C','N',N,N,M,Field(1.),Q.data(),M,Q.data(),M,Field(0.),
+    QtQ.data(),N);
+  for(auto k = 0; k < N; k++) QtQ[k*(N+1)] -= Field(1.);
+
+  // Zero out the strict lower triangle of R
+  for(auto j = 0; j < N; j++)
+  for(auto i = j+1; i < N; i++) R[i + j*LDR] = Field(0.);
+
+  GEMM('N','N',M,N,N,Field(-1.),Q.data(),M,R.data(),LDR,Field(1.),
+    A.data(),M);
+
+  RealType maxOrth = 0., maxDiff = 0.;
+  for(auto &x : QtQ) maxOrth = std::max(maxOrth,RealType(std::abs(x)));
+  for(auto &x : A  ) maxDiff = std::max(maxDiff,RealType(std::abs(x)));
+
+  EXPECT_NEAR( maxOrth, 0., 1e-10 ) << "MAX ORTH " << maxOrth;
+  EXPECT_NEAR( maxDiff, 0., 1e-10 ) << "MAX DIFF " << maxDiff;
+
+}
+
+template <typename Field, typename RealType, CB_INT MB>
+void pgeqrf_test( CB_INT M, CB_INT N ) {
+
+  // Synchronize processes
+  MPI_Barrier(MPI_COMM_WORLD);
+
+  BlacsGrid grid(MPI_COMM_WORLD,MB,MB);
+
+  std::vector<Field> A, ALoc, Q, R, TAU;
+
+  // Allocate local buffers
+  CB_INT NLoc,MLoc;
+  std::tie(MLoc,NLoc) = grid.getLocalDims(M,N);
+
+  ALoc.resize(MLoc * NLoc);
+  TAU.resize(NLoc + MB);
+
+  // Get DESC
+  auto DescA = grid.descInit(M,N,0,0,MLoc);
+
+  // Form Random matrix on root process
+  RootExecute(MPI_COMM_WORLD,[&]() {
+
+    A.resize(M*N);
+    Q.resize(M*N);
+    R.resize(M*N);
+    for(auto &x : A) x = generate<Field>();
+
+  });
+
+  // Distribute to Grid 
+  grid.Scatter(M,N,A.data(),M,ALoc.data(),MLoc,0,0);
+
+  // QR factorization
+  EXPECT_EQ( 0, PGEQRF(M,N,ALoc.data(),1,1,DescA,TAU.data()) );
+  grid.Gather(M,N,R.data(),M,ALoc.data(),MLoc,0,0);
+
+  // Form Q
+  EXPECT_EQ( 0, PUNGQR(M,N,N,ALoc.data(),1,1,DescA,TAU.data()) );
+  grid.Gather(M,N,Q.data(),M,ALoc.data(),MLoc,0,0);
+
+  RootExecute(MPI_COMM_WORLD,[&](){ 
+    check_qr<Field,RealType>(M,N,A,Q,R,M); 
+  });
+
+  NotRootExecute(MPI_COMM_WORLD,[&](){ EXPECT_TRUE(true); });
+
+  // Synchronize processes
+  MPI_Barrier(MPI_COMM_WORLD);
+
+};
+
+
+#define PGEQRF_TEST_IMPL_F(NAME,F,RF,MB,M,N)\
+  TEST(PGEQRF,NAME) { pgeqrf_test<F,RF,MB>(M,N); };
+
+#define PGEQRF_TEST_IMPL(NAME,MB,M,N)\
+  PGEQRF_TEST_IMPL_F(NAME##_Double, double, double, MB, M, N)\
+  PGEQRF_TEST_IMPL_F(NAME##_CDouble, std::complex<double>, double, MB, M, N)\
+
+
+PGEQRF_TEST_IMPL(PGEQRF_2x2,2,CXXBLACS_M,CXXBLACS_N);
+
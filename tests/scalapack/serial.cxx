@@ -0,0 +1,141 @@
+/*
+ *  A simple C++ Wrapper for BLACS along with minimal extra functionality to 
+ *  aid the the high-level development of distributed memory linear algebra.
+ *  Copyright (C) 2016-2018 David Williams-Young
+
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "scalapack_ut.hpp"
+
+// Random M x N matrix replicated on all processes
+template <typename Field>
+std::vector<Field> replicated_matrix( CB_INT M, CB_INT N ) {
+
+  std::vector<Field> A(M*N);
+  RootExecute(MPI_COMM_WORLD,[&](){ for(auto &x : A) x = generate<Field>(); });
+  MPI_Bcast(A.data(),M*N,MPIType<Field>(),0,MPI_COMM_WORLD);
+  return A;
+
+}
+
+
+template <typename Field>
+void serial_getrf_test( CB_INT N, CB_INT OFF ) {
+
+  // Synchronize processes
+  MPI_Barrier(MPI_COMM_WORLD);
+
+  // Independent 1 x 1 grid on each process
+  BlacsGrid self(MPI_COMM_SELF,4,4);
+  BlacsGrid grid(MPI_COMM_WORLD,4,4);
+
+  const CB_INT NT = N + OFF;
+  auto A = replicated_matrix<Field>(NT,NT);
+
+  // Submatrix A(OFF+1:,OFF+1:) on the 1 x 1 grid
+  std::vector<Field> ASelf(A);
+  std::vector<CB_INT> IPIV(NT + 4);
+  auto DescSelf = self.descInit(NT,NT,0,0,NT);
+
+  EXPECT_EQ( PGETRF(N,N,ASelf.data(),OFF+1,OFF+1,DescSelf,IPIV.data()), 0 );
+
+  // Reference LAPACK on a copy of the submatrix
+  std::vector<Field> ARef(N*N);
+  std::vector<CB_INT> IPIVRef(N);
+  LACOPY('A',N,N,A.data() + OFF*(NT+1),NT,ARef.data(),N);
+  EXPECT_EQ( GETRF(N,N,ARef.data(),N,IPIVRef.data()), 0 );
+
+  for( CB_INT j = 0; j < N; j++ ) {
+    // Pivots are global row indices as in ScaLAPACK
+    EXPECT_EQ( IPIV[OFF+j], IPIVRef[j] + OFF );
+    for( CB_INT i = 0; i < N; i++ )
+      EXPECT_EQ( ASelf[OFF+i + (OFF+j)*NT], ARef[i + j*N] );
+  }
+
+  // Same factorization on the distributed grid
+  CB_INT MLoc, NLoc;
+  std::tie(MLoc,NLoc) = grid.getLocalDims(NT,NT);
+  std::vector<Field> ALoc(MLoc*NLoc), LU;
+  std::vector<CB_INT> IPIVLoc(MLoc + 4);
+  auto DescA = grid.descInit(NT,NT,0,0,MLoc);
+
+  grid.Scatter(NT,NT,A.data(),NT,ALoc.data(),MLoc,0,0);
+  EXPECT_EQ( PGETRF(N,N,ALoc.data(),OFF+1,OFF+1,DescA,IPIVLoc.data()), 0 );
+
+  RootExecute(MPI_COMM_WORLD,[&](){ LU.resize(NT*NT); });
+  grid.Gather(NT,NT,LU.data(),NT,ALoc.data(),MLoc,0,0);
+
+  RootExecute(MPI_COMM_WORLD,[&](){
+    for( CB_INT j = 0; j < N; j++ )
+    for( CB_INT i = 0; i < N; i++ )
+      EXPECT_NEAR( std::abs(LU[OFF+i + (OFF+j)*NT] - ARef[i + j*N]), 0., 
+        1e-10 );
+  });
+
+  // Synchronize processes
+  MPI_Barrier(MPI_COMM_WORLD);
+
+}
+
+template <typename Field>
+void serial_trsm_test( CB_INT M, CB_INT N ) {
+
+  // Synchronize processes
+  MPI_Barrier(MPI_COMM_WORLD);
+
+  BlacsGrid self(MPI_COMM_SELF,4,4);
+  BlacsGrid grid(MPI_COMM_WORLD,4,4);
+
+  auto A = replicated_matrix<Field>(M,M);
+  auto B = replicated_matrix<Field>(M,N);
+  for( CB_INT i = 0; i < M; i++ ) A[i*(M+1)] += Field(M); 
+
+  // 1 x 1 grid
+  std::vector<Field> BSelf(B);
+  PTRSM('L','L','N','N',M,N,Field(2.),A.data(),1,1,self.descInit(M,M,0,0,M),
+    BSelf.data(),1,1,self.descInit(M,N,0,0,M));
+
+  // Distributed grid
+  CB_INT MLocA, NLocA, MLocB, NLocB;
+  std::tie(MLocA,NLocA) = grid.getLocalDims(M,M);
+  std::tie(MLocB,NLocB) = grid.getLocalDims(M,N);
+  std::vector<Field> ALoc(MLocA*NLocA), BLoc(MLocB*NLocB), X;
+
+  grid.Scatter(M,M,A.data(),M,ALoc.data(),MLocA,0,0);
+  grid.Scatter(M,N,B.data(),M,BLoc.data(),MLocB,0,0);
+
+  PTRSM('L','L','N','N',M,N,Field(2.),ALoc.data(),1,1,
+    grid.descInit(M,M,0,0,MLocA),BLoc.data(),1,1,
+    grid.descInit(M,N,0,0,MLocB));
+
+  RootExecute(MPI_COMM_WORLD,[&](){ X.resize(M*N); });
+  grid.Gather(M,N,X.data(),M,BLoc.data(),MLocB,0,0);
+
+  RootExecute(MPI_COMM_WORLD,[&](){
+    for( CB_INT k = 0; k < M*N; k++ ) 
+      EXPECT_NEAR( std::abs(X[k] - BSelf[k]), 0., 1e-10 );
+  });
+
+  // Synchronize processes
+  MPI_Barrier(MPI_COMM_WORLD);
+
+}
+
+
+TEST(SERIAL_DISPATCH,GETRF_Double)           { serial_getrf_test<double>(CXXBLACS_N,0); }
+TEST(SERIAL_DISPATCH,GETRF_SUBMATRIX_Double) { serial_getrf_test<double>(CXXBLACS_N,3); }
+TEST(SERIAL_DISPATCH,GETRF_CDouble)          { serial_getrf_test<std::complex<double>>(CXXBLACS_N,3); }
+
+TEST(SERIAL_DISPATCH,TRSM_Double)  { serial_trsm_test<double>(CXXBLACS_M,CXXBLACS_NRHS); }
+TEST(SERIAL_DISPATCH,TRSM_CDouble) { serial_trsm_test<std::complex<double>>(CXXBLACS_M,CXXBLACS_NRHS); }
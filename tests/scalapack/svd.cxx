@@ -0,0 +1,130 @@
+/*
+ *  A simple C++ Wrapper for BLACS along with minimal extra functionality to 
+ *  aid the the high-level development of distributed memory linear algebra.
+ *  Copyright (C) 2016-2018 David Williams-Young
+
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "scalapack_ut.hpp"
+
+
+template <typename Field, typename RealType, CB_INT MB>
+void pgesvd_test( CB_INT M, CB_INT N ) {
+
+  // Synchronize processes
+  MPI_Barrier(MPI_COMM_WORLD);
+
+  BlacsGrid grid(MPI_COMM_WORLD,MB,MB);
+
+  const CB_INT K = std::min(M,N);
+
+  std::vector<Field> A, ALoc, ACpy, U, ULoc, VT, VTLoc;
+  std::vector<RealType> S(K), SRef(K);
+
+  // Allocate local buffers
+  CB_INT MLoc, NLoc, KLocR, KLocC;
+  std::tie(MLoc ,NLoc ) = grid.getLocalDims(M,N);
+  std::tie(MLoc ,KLocC) = grid.getLocalDims(M,K);
+  std::tie(KLocR,NLoc ) = grid.getLocalDims(K,N);
+
+  ALoc.resize(MLoc * NLoc);
+  ULoc.resize(MLoc * KLocC);
+  VTLoc.resize(KLocR * NLoc);
+
+
+  // Get DESC
+  auto DescA  = grid.descInit(M,N,0,0,MLoc);
+  auto DescU  = grid.descInit(M,K,0,0,MLoc);
+  auto DescVT = grid.descInit(K,N,0,0,KLocR);
+
+  // Form Random matrix on root process
+  RootExecute(MPI_COMM_WORLD,[&]() {
+
+    A.resize(M*N);
+    U.resize(M*K);
+    VT.resize(K*N);
+    for(auto &x : A) x = generate<Field>();
+
+  });
+
+  // Distribute to Grid 
+  grid.Scatter(M,N,A.data(),M,ALoc.data(),MLoc,0,0);
+
+  // Singular values only
+  ACpy = ALoc;
+  EXPECT_EQ( 0, CXXBLACS::PGESVD('N','N',M,N,ACpy.data(),1,1,DescA,
+    SRef.data(),ULoc.data(),1,1,DescU,VTLoc.data(),1,1,DescVT) );
+
+  // Left / right singular vectors only
+  ACpy = ALoc;
+  EXPECT_EQ( 0, CXXBLACS::PGESVD('V','N',M,N,ACpy.data(),1,1,DescA,
+    S.data(),ULoc.data(),1,1,DescU,VTLoc.data(),1,1,DescVT) );
+  for(auto k = 0; k < K; k++) EXPECT_NEAR( S[k], SRef[k], 1e-10 );
+
+  ACpy = ALoc;
+  EXPECT_EQ( 0, CXXBLACS::PGESVD('N','V',M,N,ACpy.data(),1,1,DescA,
+    S.data(),ULoc.data(),1,1,DescU,VTLoc.data(),1,1,DescVT) );
+  for(auto k = 0; k < K; k++) EXPECT_NEAR( S[k], SRef[k], 1e-10 );
+
+  // Full SVD
+  ACpy = ALoc;
+  EXPECT_EQ( 0, CXXBLACS::PGESVD('V','V',M,N,ACpy.data(),1,1,DescA,
+    S.data(),ULoc.data(),1,1,DescU,VTLoc.data(),1,1,DescVT) );
+  for(auto k = 0; k < K; k++) EXPECT_NEAR( S[k], SRef[k], 1e-10 );
+
+  // Gather the singular vectors to root process
+  grid.Gather(M,K,U.data(),M,ULoc.data(),MLoc,0,0);
+  grid.Gather(K,N,VT.data(),K,VTLoc.data(),KLocR,0,0);
+
+
+  // Check A = U * S * VT on root process
+  RootExecute(MPI_COMM_WORLD,[&](){
+
+    for(auto j = 0; j < K; j++)
+    for(auto i = 0; i < M; i++) U[i + j*M] *= S[j];
+
+    GEMM('N','N',M,N,K,Field(-1.),U.data(),M,VT.data(),K,Field(1.),
+      A.data(),M);
+
+    std::vector<RealType> DIFF(M*N,0.);
+    for(auto k = 0; k < M*N; k++) DIFF[k] = std::abs(A[k]);
+
+    RealType maxDiff = *std::max_element(DIFF.begin(),DIFF.end());
+
+    EXPECT_NEAR( maxDiff, 0., 1e-10 ) << "MAX DIFF " << maxDiff;
+
+  });
+
+  NotRootExecute(MPI_COMM_WORLD,[&](){ EXPECT_TRUE(true); });
+
+
+  // Synchronize processes
+  MPI_Barrier(MPI_COMM_WORLD);
+
+};
+
+
+#define PGESVD_TEST_IMPL_F(NAME,F,RF,MB,M,N)\
+  TEST(PGESVD,NAME) { pgesvd_test<F,RF,MB>(M,N); };
+
+#define PGESVD_TEST_IMPL(NAME,MB,M,N)\
+  PGESVD_TEST_IMPL_F(NAME##_Double, double, double, MB, M, N)\
+  PGESVD_TEST_IMPL_F(NAME##_CDouble, std::complex<double>, double, MB, M, N)\
+//FIXME: Need to determine proper error criteria for single precision
+//PGESVD_TEST_IMPL_F(NAME##_Float , float , float, MB, M, N)\
+
+
+PGESVD_TEST_IMPL(PGESVD_2x2_Tall,2,CXXBLACS_M,CXXBLACS_N);
+PGESVD_TEST_IMPL(PGESVD_2x2_Wide,2,CXXBLACS_N,CXXBLACS_M);
+
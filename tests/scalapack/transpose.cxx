@@ -0,0 +1,206 @@
+/*
+ *  A simple C++ Wrapper for BLACS along with minimal extra functionality to 
+ *  aid the the high-level development of distributed memory linear algebra.
+ *  Copyright (C) 2016-2018 David Williams-Young
+
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "scalapack_ut.hpp"
+
+template <typename T> T SmartConj(const T x) { return x; }
+template <typename T> std::complex<T> SmartConj(const std::complex<T> x) {
+  return std::conj(x);
+}
+
+template <typename Field, typename RealType>
+void compare_mat( CB_INT M, CB_INT N, const std::vector<Field> &A, 
+  const std::vector<Field> &B ) {
+
+  RealType maxDiff = 0.;
+  for(auto k = 0; k < M*N; k++)
+    maxDiff = std::max(maxDiff,RealType(std::abs(A[k] - B[k])));
+
+  EXPECT_NEAR( maxDiff, 0., 1e-10 ) << "MAX DIFF " << maxDiff;
+
+}
+
+
+
+template <typename Field, typename RealType, CB_INT MB>
+void ptran_test( bool CONJ, CB_INT M, CB_INT N ) {
+
+  // Synchronize processes
+  MPI_Barrier(MPI_COMM_WORLD);
+
+  BlacsGrid grid(MPI_COMM_WORLD,MB,MB);
+
+  const Field ALPHA = 0.5, BETA = 2.;
+
+  std::vector<Field> A, C, Ref, ALoc, CLoc;
+
+  CB_INT ALocR, ALocC, CLocR, CLocC;
+  std::tie(ALocR,ALocC) = grid.getLocalDims(M,N);
+  std::tie(CLocR,CLocC) = grid.getLocalDims(N,M);
+  ALoc.resize(ALocR * ALocC);
+  CLoc.resize(CLocR * CLocC);
+  auto DescA = grid.descInit(M,N,0,0,ALocR);
+  auto DescC = grid.descInit(N,M,0,0,CLocR);
+
+  RootExecute(MPI_COMM_WORLD,[&](){
+    A.resize(M*N); C.resize(N*M); 
+    for(auto &x : A) x = generate<Field>();
+    for(auto &x : C) x = generate<Field>();
+
+    Ref = C;
+    for(auto j = 0; j < M; j++)
+    for(auto i = 0; i < N; i++) {
+      const Field AT = CONJ ? SmartConj(A[j + i*M]) : A[j + i*M];
+      Ref[i + j*N] = ALPHA * AT + BETA * C[i + j*N];
+    }
+  });
+
+  grid.Scatter(M,N,A.data(),M,ALoc.data(),ALocR,0,0);
+  grid.Scatter(N,M,C.data(),N,CLoc.data(),CLocR,0,0);
+
+  if( CONJ )
+    PTRANC(N,M,ALPHA,ALoc.data(),1,1,DescA,BETA,CLoc.data(),1,1,DescC);
+  else
+    PTRAN(N,M,ALPHA,ALoc.data(),1,1,DescA,BETA,CLoc.data(),1,1,DescC);
+
+  grid.Gather(N,M,C.data(),N,CLoc.data(),CLocR,0,0);
+
+  RootExecute(MPI_COMM_WORLD,[&](){ compare_mat<Field,RealType>(N,M,C,Ref); });
+  NotRootExecute(MPI_COMM_WORLD,[&](){ EXPECT_TRUE(true); });
+
+  // Synchronize processes
+  MPI_Barrier(MPI_COMM_WORLD);
+
+}
+
+
+
+template <typename Field, typename RealType, CB_INT MB>
+void pgeadd_test( char TRANS, CB_INT M, CB_INT N ) {
+
+  // Synchronize processes
+  MPI_Barrier(MPI_COMM_WORLD);
+
+  BlacsGrid grid(MPI_COMM_WORLD,MB,MB);
+
+  const Field ALPHA = 0.5, BETA = 2.;
+  const CB_INT MA = TRANS == 'N' ? M : N;
+  const CB_INT NA = TRANS == 'N' ? N : M;
+
+  std::vector<Field> A, C, Ref, ALoc, CLoc;
+
+  CB_INT ALocR, ALocC, CLocR, CLocC;
+  std::tie(ALocR,ALocC) = grid.getLocalDims(MA,NA);
+  std::tie(CLocR,CLocC) = grid.getLocalDims(M,N);
+  ALoc.resize(ALocR * ALocC);
+  CLoc.resize(CLocR * CLocC);
+  auto DescA = grid.descInit(MA,NA,0,0,ALocR);
+  auto DescC = grid.descInit(M,N,0,0,CLocR);
+
+  RootExecute(MPI_COMM_WORLD,[&](){
+    A.resize(MA*NA); C.resize(M*N); 
+    for(auto &x : A) x = generate<Field>();
+    for(auto &x : C) x = generate<Field>();
+
+    Ref = C;
+    for(auto j = 0; j < N; j++)
+    for(auto i = 0; i < M; i++) {
+      Field OPA = A[i + j*MA];
+      if( TRANS == 'T' ) OPA = A[j + i*MA];
+      if( TRANS == 'C' ) OPA = SmartConj(A[j + i*MA]);
+      Ref[i + j*M] = ALPHA * OPA + BETA * C[i + j*M];
+    }
+  });
+
+  grid.Scatter(MA,NA,A.data(),MA,ALoc.data(),ALocR,0,0);
+  grid.Scatter(M,N,C.data(),M,CLoc.data(),CLocR,0,0);
+
+  PGEADD(TRANS,M,N,ALPHA,ALoc.data(),1,1,DescA,BETA,CLoc.data(),1,1,DescC);
+
+  grid.Gather(M,N,C.data(),M,CLoc.data(),CLocR,0,0);
+
+  RootExecute(MPI_COMM_WORLD,[&](){ compare_mat<Field,RealType>(M,N,C,Ref); });
+  NotRootExecute(MPI_COMM_WORLD,[&](){ EXPECT_TRUE(true); });
+
+  // Synchronize processes
+  MPI_Barrier(MPI_COMM_WORLD);
+
+}
+
+
+
+template <typename Field, typename RealType, CB_INT MB, CB_INT NB>
+void symmetrize_test( bool HERM, std::string ORDER, CB_INT N ) {
+
+  // Synchronize processes
+  MPI_Barrier(MPI_COMM_WORLD);
+
+  BlacsGrid grid(MPI_COMM_WORLD,MB,NB,0,0,ORDER);
+
+  std::vector<Field> A, Ref, ALoc;
+
+  CB_INT ALocR, ALocC;
+  std::tie(ALocR,ALocC) = grid.getLocalDims(N,N);
+  ALoc.resize(ALocR * ALocC);
+
+  RootExecute(MPI_COMM_WORLD,[&](){
+    A.resize(N*N);
+    for(auto &x : A) x = generate<Field>();
+
+    Ref.resize(N*N);
+    for(auto j = 0; j < N; j++)
+    for(auto i = 0; i < N; i++) {
+      const Field AT = HERM ? SmartConj(A[j + i*N]) : A[j + i*N];
+      Ref[i + j*N] = Field(0.5) * (A[i + j*N] + AT);
+    }
+  });
+
+  grid.Scatter(N,N,A.data(),N,ALoc.data(),ALocR,0,0);
+
+  if( HERM ) grid.Hermitize(N,ALoc.data(),ALocR);
+  else       grid.Symmetrize(N,ALoc.data(),ALocR);
+
+  grid.Gather(N,N,A.data(),N,ALoc.data(),ALocR,0,0);
+
+  RootExecute(MPI_COMM_WORLD,[&](){ compare_mat<Field,RealType>(N,N,A,Ref); });
+  NotRootExecute(MPI_COMM_WORLD,[&](){ EXPECT_TRUE(true); });
+
+  // Synchronize processes
+  MPI_Barrier(MPI_COMM_WORLD);
+
+}
+
+
+
+#define TRANSPOSE_TEST_IMPL(NAME,F,RF)\
+  TEST(PTRAN,PTRAN_##NAME)  { ptran_test<F,RF,2>(false,CXXBLACS_M,CXXBLACS_N); }\
+  TEST(PTRAN,PTRANC_##NAME) { ptran_test<F,RF,2>(true ,CXXBLACS_M,CXXBLACS_N); }\
+  TEST(PTRAN,PGEADD_N_##NAME) { pgeadd_test<F,RF,2>('N',CXXBLACS_M,CXXBLACS_N); }\
+  TEST(PTRAN,PGEADD_T_##NAME) { pgeadd_test<F,RF,2>('T',CXXBLACS_M,CXXBLACS_N); }\
+  TEST(PTRAN,PGEADD_C_##NAME) { pgeadd_test<F,RF,2>('C',CXXBLACS_M,CXXBLACS_N); }\
+  TEST(SYMMETRIZE,SYMMETRIZE_##NAME) {\
+    symmetrize_test<F,RF,2,2>(false,"row-major",CXXBLACS_N); }\
+  TEST(SYMMETRIZE,HERMITIZE_##NAME) {\
+    symmetrize_test<F,RF,2,2>(true ,"row-major",CXXBLACS_N); }\
+  TEST(SYMMETRIZE,SYMMETRIZE_LINEAR_##NAME) {\
+    symmetrize_test<F,RF,2,2>(false,"linear",CXXBLACS_N); }\
+  TEST(SYMMETRIZE,HERMITIZE_RECT_BLOCK_##NAME) {\
+    symmetrize_test<F,RF,2,3>(true ,"row-major",CXXBLACS_N); }
+
+TRANSPOSE_TEST_IMPL(Double ,double              ,double);
+TRANSPOSE_TEST_IMPL(CDouble,std::complex<double>,double);